@@ -0,0 +1,257 @@
+// ===================================================================================
+// File:        BPlusTree.h
+// Author:      Group 4
+// Date:        2026-10-18
+// Description: Declaration of BPlusTree<T>, an ordered set of unique keys stored in
+//              a B+-tree whose nodes span several cache lines. Nodes live in two
+//              contiguous pools (leaves and inner nodes) and refer to each other by
+//              index, so the whole tree is copyable and stays compact in memory.
+//
+//              Supported operations:
+//              ----------------------------------------------------------------------
+//              bool insert(const T& value)
+//                  Inserts a key in O(log n); returns false if it was already present.
+//
+//              bool contains(const T& value) const
+//                  Checks whether a key is present in O(log n).
+//
+//              size_t size() const
+//                  Returns the number of keys stored.
+//
+//              size_t memoryUsage() const
+//                  Returns the bytes allocated for the node pools.
+//
+//              void clear()
+//                  Removes every key.
+//
+//              void assignSorted(const std::vector<T>& sorted)
+//                  Rebuilds the tree from strictly ascending keys in O(n).
+//
+//              void lookupBatch(const T* keys, size_t keyCount, Fn report) const
+//                  Searches a batch of keys with group prefetching; calls
+//                  report(i, found) for each key.
+//
+//              const_iterator begin() const / end() const
+//                  Ordered iteration over the keys through the leaf chain.
+//
+//              void forEach(Fn fn) const
+//                  Calls fn(key) for every key in ascending order.
+//
+//              void forEachLeaf(Fn fn) const
+//                  Calls fn(keys, count) for every leaf's contiguous key array.
+//
+//              T select(size_t rank) const / T back() const
+//                  Key of a given rank (leaf by leaf); largest key in O(log n).
+// ===================================================================================
+
+#ifndef BPLUSTREE_H
+#define BPLUSTREE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "Prefetch.h"
+
+/**
+ * @class BPlusTree
+ * @brief Ordered set of unique keys backed by a B+-tree with wide nodes.
+ *        Keys are kept only in the leaves, which are chained left to right
+ *        so that ordered scans never revisit inner nodes.
+ *
+ * @tparam T Key type; requires operator< and default construction.
+ */
+template <typename T>
+class BPlusTree
+{
+public:
+    static constexpr size_t CACHE_LINE = 64;     ///< Assumed cache line size in bytes.
+    static constexpr size_t NODE_BYTES = 4 * CACHE_LINE; ///< Target node footprint.
+
+    /// Keys per leaf: as many as fit in NODE_BYTES (at least 4).
+    static constexpr size_t LEAF_CAPACITY =
+        (NODE_BYTES - 2 * sizeof(uint32_t)) / sizeof(T) > 4
+            ? (NODE_BYTES - 2 * sizeof(uint32_t)) / sizeof(T)
+            : 4;
+
+    /// Separator keys per inner node (each key comes with one child index).
+    static constexpr size_t INNER_CAPACITY =
+        (NODE_BYTES - 2 * sizeof(uint32_t)) / (sizeof(T) + sizeof(uint32_t)) > 4
+            ? (NODE_BYTES - 2 * sizeof(uint32_t)) / (sizeof(T) + sizeof(uint32_t))
+            : 4;
+
+private:
+    static constexpr uint32_t NIL = UINT32_MAX; ///< Null node index.
+    static constexpr size_t BATCH_GROUP = 16;   ///< Searches advanced together by lookupBatch.
+
+    /**
+     * @brief Leaf node: sorted keys plus the index of the next leaf.
+     */
+    struct alignas(CACHE_LINE) Leaf
+    {
+        uint32_t count = 0;
+        uint32_t next = NIL;
+        T keys[LEAF_CAPACITY];
+    };
+
+    /**
+     * @brief Inner node: `count` separators and `count + 1` children.
+     *        Child i holds keys k with keys[i-1] <= k < keys[i].
+     */
+    struct alignas(CACHE_LINE) Inner
+    {
+        uint32_t count = 0;
+        T keys[INNER_CAPACITY];
+        uint32_t children[INNER_CAPACITY + 1];
+    };
+
+    /**
+     * @brief Result of inserting into a subtree that had to split.
+     */
+    struct Split
+    {
+        bool happened = false;
+        T separator{};
+        uint32_t right = NIL;
+    };
+
+    std::vector<Leaf> leaves;  ///< Pool of leaf nodes; leaf 0 is always leftmost.
+    std::vector<Inner> inners; ///< Pool of inner nodes.
+    uint32_t root;             ///< Index of the root (a leaf when height == 0).
+    uint32_t height;           ///< Number of inner levels above the leaves.
+    size_t count;              ///< Number of keys stored.
+
+    bool insertInto(uint32_t node, uint32_t level, const T &value, Split &split);
+    bool insertIntoLeaf(uint32_t leaf, const T &value, Split &split);
+    void insertIntoInner(uint32_t inner, uint32_t position, const Split &childSplit, Split &split);
+    void prefetchNode(const void *node) const;
+
+public:
+    /**
+     * @class const_iterator
+     * @brief Forward iterator over the keys in ascending order.
+     */
+    class const_iterator
+    {
+    private:
+        const BPlusTree *tree;
+        uint32_t leaf;
+        uint32_t position;
+
+    public:
+        const_iterator(const BPlusTree *owner, uint32_t leafIndex, uint32_t pos)
+            : tree(owner), leaf(leafIndex), position(pos) {}
+
+        const T &operator*() const { return tree->leaves[leaf].keys[position]; }
+
+        const_iterator &operator++()
+        {
+            if (++position == tree->leaves[leaf].count)
+            {
+                leaf = tree->leaves[leaf].next;
+                position = 0;
+            }
+            return *this;
+        }
+
+        bool operator==(const const_iterator &other) const
+        {
+            return leaf == other.leaf && position == other.position;
+        }
+
+        bool operator!=(const const_iterator &other) const { return !(*this == other); }
+    };
+
+    /**
+     * @brief Constructs an empty tree.
+     */
+    BPlusTree();
+
+    /**
+     * @brief Inserts a key if it is not already present.
+     * @param value The key to insert.
+     * @return True if the key was added, false if it already existed.
+     */
+    bool insert(const T &value);
+
+    /**
+     * @brief Checks whether a key is present.
+     * @param value The key to search.
+     * @return True if found.
+     */
+    bool contains(const T &value) const;
+
+    /**
+     * @brief Searches many keys level by level in groups of BATCH_GROUP. After
+     *        each step the next node of every search is prefetched, so the
+     *        group's cache misses overlap instead of being paid one by one.
+     * @param keys Keys to search.
+     * @param keyCount Number of keys.
+     * @param report Callable invoked as report(index, found) for every key.
+     */
+    template <typename Fn>
+    void lookupBatch(const T *keys, size_t keyCount, Fn &&report) const;
+
+    /**
+     * @brief Returns the number of keys in the tree.
+     */
+    size_t size() const;
+
+    /**
+     * @brief Returns the bytes allocated for the leaf and inner node pools.
+     */
+    size_t memoryUsage() const;
+
+    /**
+     * @brief Removes every key and releases the node pools.
+     */
+    void clear();
+
+    /**
+     * @brief Rebuilds the tree bottom-up from strictly ascending keys.
+     * @param sorted Keys in ascending order without duplicates.
+     */
+    void assignSorted(const std::vector<T> &sorted);
+
+    /**
+     * @brief Returns an iterator to the smallest key.
+     */
+    const_iterator begin() const;
+
+    /**
+     * @brief Returns the past-the-end iterator.
+     */
+    const_iterator end() const;
+
+    /**
+     * @brief Calls fn(key) for every key in ascending order (leaf scan).
+     * @param fn Callable taking const T&.
+     */
+    template <typename Fn>
+    void forEach(Fn &&fn) const;
+
+    /**
+     * @brief Calls fn(keys, count) for every leaf in ascending order, where
+     *        keys[0..count) is the leaf's contiguous array of sorted keys.
+     * @param fn Callable taking (const T*, size_t).
+     */
+    template <typename Fn>
+    void forEachLeaf(Fn &&fn) const;
+
+    /**
+     * @brief Returns the key of rank `rank` (0 = smallest). Nodes keep no
+     *        subtree counts, so whole leaves are skipped along the leaf chain:
+     *        O(n / LEAF_CAPACITY) hops, no key compared.
+     * @param rank Rank below size().
+     */
+    T select(size_t rank) const;
+
+    /**
+     * @brief Returns the largest key (the tree must not be empty), descending
+     *        the rightmost path in O(log n).
+     */
+    T back() const;
+};
+
+#include "BPlusTree.hxx"
+
+#endif // BPLUSTREE_H
@@ -0,0 +1,462 @@
+// ===================================================================================
+// File:        BPlusTree.hxx
+// Author:      Group 4
+// Date:        2026-10-18
+// Description: Implementation of the templated class BPlusTree<T>.
+// ===================================================================================
+// Group 4 | Joel Felipe Martinez | Xamuel Perez | Rafael Held
+
+#ifndef BPLUSTREE_HXX
+#define BPLUSTREE_HXX
+
+#include "BPlusTree.h"
+#include <algorithm> // For std::lower_bound, std::upper_bound, std::copy
+
+/**
+ * @brief Constructs an empty tree.
+ */
+template <typename T>
+BPlusTree<T>::BPlusTree()
+    : leaves(), inners(), root(NIL), height(0), count(0) {}
+
+/**
+ * @brief Inserts a key if it is not already present.
+ *        Splits propagate upwards; a split root grows the tree by one level.
+ * @param value The key to insert.
+ * @return True if the key was added, false if it already existed.
+ */
+template <typename T>
+bool BPlusTree<T>::insert(const T &value)
+{
+    if (root == NIL)
+    {
+        leaves.emplace_back();
+        root = 0;
+        height = 0;
+    }
+
+    Split split;
+    bool inserted = insertInto(root, height, value, split);
+    if (split.happened)
+    {
+        Inner newRoot;
+        newRoot.count = 1;
+        newRoot.keys[0] = split.separator;
+        newRoot.children[0] = root;
+        newRoot.children[1] = split.right;
+        inners.push_back(newRoot);
+        root = static_cast<uint32_t>(inners.size() - 1);
+        ++height;
+    }
+    if (inserted)
+    {
+        ++count;
+    }
+    return inserted;
+}
+
+/**
+ * @brief Recursive insertion below `node`, which sits `level` levels above the leaves.
+ */
+template <typename T>
+bool BPlusTree<T>::insertInto(uint32_t node, uint32_t level, const T &value, Split &split)
+{
+    if (level == 0)
+    {
+        return insertIntoLeaf(node, value, split);
+    }
+
+    const Inner &inner = inners[node];
+    uint32_t position = static_cast<uint32_t>(
+        std::upper_bound(inner.keys, inner.keys + inner.count, value) - inner.keys);
+    uint32_t child = inner.children[position];
+
+    Split childSplit;
+    bool inserted = insertInto(child, level - 1, value, childSplit);
+    if (childSplit.happened)
+    {
+        insertIntoInner(node, position, childSplit, split);
+    }
+    return inserted;
+}
+
+/**
+ * @brief Inserts into a leaf, splitting it in half when it is full.
+ */
+template <typename T>
+bool BPlusTree<T>::insertIntoLeaf(uint32_t leafIndex, const T &value, Split &split)
+{
+    Leaf *leaf = &leaves[leafIndex];
+    T *position = std::lower_bound(leaf->keys, leaf->keys + leaf->count, value);
+    if (position != leaf->keys + leaf->count && !(value < *position))
+    {
+        return false; // Already present
+    }
+
+    if (leaf->count < LEAF_CAPACITY)
+    {
+        std::copy_backward(position, leaf->keys + leaf->count, leaf->keys + leaf->count + 1);
+        *position = value;
+        ++leaf->count;
+        return true;
+    }
+
+    // Full leaf: move the upper half into a new right sibling
+    size_t offset = static_cast<size_t>(position - leaf->keys);
+    leaves.emplace_back();
+    leaf = &leaves[leafIndex]; // The pool may have reallocated
+    uint32_t rightIndex = static_cast<uint32_t>(leaves.size() - 1);
+    Leaf &right = leaves[rightIndex];
+
+    uint32_t half = static_cast<uint32_t>(LEAF_CAPACITY / 2);
+    std::copy(leaf->keys + half, leaf->keys + leaf->count, right.keys);
+    right.count = leaf->count - half;
+    leaf->count = half;
+    right.next = leaf->next;
+    leaf->next = rightIndex;
+
+    Leaf &target = offset <= half ? *leaf : right;
+    size_t targetOffset = offset <= half ? offset : offset - half;
+    std::copy_backward(target.keys + targetOffset, target.keys + target.count,
+                       target.keys + target.count + 1);
+    target.keys[targetOffset] = value;
+    ++target.count;
+
+    split.happened = true;
+    split.separator = right.keys[0];
+    split.right = rightIndex;
+    return true;
+}
+
+/**
+ * @brief Adds a child split into an inner node, splitting the inner node if needed.
+ *        On an inner split the middle separator moves up into `split`.
+ */
+template <typename T>
+void BPlusTree<T>::insertIntoInner(uint32_t innerIndex, uint32_t position,
+                                   const Split &childSplit, Split &split)
+{
+    Inner *inner = &inners[innerIndex];
+    if (inner->count < INNER_CAPACITY)
+    {
+        std::copy_backward(inner->keys + position, inner->keys + inner->count,
+                           inner->keys + inner->count + 1);
+        std::copy_backward(inner->children + position + 1, inner->children + inner->count + 1,
+                           inner->children + inner->count + 2);
+        inner->keys[position] = childSplit.separator;
+        inner->children[position + 1] = childSplit.right;
+        ++inner->count;
+        return;
+    }
+
+    // Full inner node: lay out the INNER_CAPACITY + 1 keys in scratch space first
+    std::vector<T> keys(inner->keys, inner->keys + inner->count);
+    std::vector<uint32_t> children(inner->children, inner->children + inner->count + 1);
+    keys.insert(keys.begin() + position, childSplit.separator);
+    children.insert(children.begin() + position + 1, childSplit.right);
+
+    inners.emplace_back();
+    inner = &inners[innerIndex]; // The pool may have reallocated
+    uint32_t rightIndex = static_cast<uint32_t>(inners.size() - 1);
+    Inner &right = inners[rightIndex];
+
+    size_t middle = keys.size() / 2;
+    inner->count = static_cast<uint32_t>(middle);
+    std::copy(keys.begin(), keys.begin() + middle, inner->keys);
+    std::copy(children.begin(), children.begin() + middle + 1, inner->children);
+
+    right.count = static_cast<uint32_t>(keys.size() - middle - 1);
+    std::copy(keys.begin() + middle + 1, keys.end(), right.keys);
+    std::copy(children.begin() + middle + 1, children.end(), right.children);
+
+    split.happened = true;
+    split.separator = keys[middle];
+    split.right = rightIndex;
+}
+
+/**
+ * @brief Checks whether a key is present.
+ * @param value The key to search.
+ * @return True if found.
+ */
+template <typename T>
+bool BPlusTree<T>::contains(const T &value) const
+{
+    if (root == NIL)
+    {
+        return false;
+    }
+
+    uint32_t node = root;
+    for (uint32_t level = height; level > 0; --level)
+    {
+        const Inner &inner = inners[node];
+        uint32_t position = static_cast<uint32_t>(
+            std::upper_bound(inner.keys, inner.keys + inner.count, value) - inner.keys);
+        node = inner.children[position];
+    }
+
+    const Leaf &leaf = leaves[node];
+    const T *position = std::lower_bound(leaf.keys, leaf.keys + leaf.count, value);
+    return position != leaf.keys + leaf.count && !(value < *position);
+}
+
+/**
+ * @brief Prefetches every cache line of a node.
+ */
+template <typename T>
+void BPlusTree<T>::prefetchNode(const void *node) const
+{
+    const char *bytes = static_cast<const char *>(node);
+    for (size_t offset = 0; offset < NODE_BYTES; offset += CACHE_LINE)
+    {
+        prefetchRead(bytes + offset);
+    }
+}
+
+/**
+ * @brief Searches many keys level by level in groups of BATCH_GROUP. After
+ *        each step the next node of every search is prefetched, so the
+ *        group's cache misses overlap instead of being paid one by one.
+ * @param keys Keys to search.
+ * @param keyCount Number of keys.
+ * @param report Callable invoked as report(index, found) for every key.
+ */
+template <typename T>
+template <typename Fn>
+void BPlusTree<T>::lookupBatch(const T *keys, size_t keyCount, Fn &&report) const
+{
+    uint32_t nodes[BATCH_GROUP];
+    for (size_t base = 0; base < keyCount; base += BATCH_GROUP)
+    {
+        size_t group = std::min(BATCH_GROUP, keyCount - base);
+        if (root == NIL)
+        {
+            for (size_t g = 0; g < group; ++g)
+            {
+                report(base + g, false);
+            }
+            continue;
+        }
+
+        for (size_t g = 0; g < group; ++g)
+        {
+            nodes[g] = root;
+        }
+        for (uint32_t level = height; level > 0; --level)
+        {
+            for (size_t g = 0; g < group; ++g)
+            {
+                const Inner &inner = inners[nodes[g]];
+                uint32_t position = static_cast<uint32_t>(
+                    std::upper_bound(inner.keys, inner.keys + inner.count, keys[base + g]) -
+                    inner.keys);
+                nodes[g] = inner.children[position];
+                if (level > 1)
+                {
+                    prefetchNode(&inners[nodes[g]]);
+                }
+                else
+                {
+                    prefetchNode(&leaves[nodes[g]]);
+                }
+            }
+        }
+
+        for (size_t g = 0; g < group; ++g)
+        {
+            const Leaf &leaf = leaves[nodes[g]];
+            const T &key = keys[base + g];
+            const T *position = std::lower_bound(leaf.keys, leaf.keys + leaf.count, key);
+            report(base + g, position != leaf.keys + leaf.count && !(key < *position));
+        }
+    }
+}
+
+/**
+ * @brief Returns the number of keys in the tree.
+ */
+template <typename T>
+size_t BPlusTree<T>::size() const
+{
+    return count;
+}
+
+/**
+ * @brief Returns the bytes allocated for the leaf and inner node pools.
+ */
+template <typename T>
+size_t BPlusTree<T>::memoryUsage() const
+{
+    return leaves.capacity() * sizeof(Leaf) + inners.capacity() * sizeof(Inner);
+}
+
+/**
+ * @brief Removes every key and releases the node pools.
+ */
+template <typename T>
+void BPlusTree<T>::clear()
+{
+    leaves.clear();
+    inners.clear();
+    root = NIL;
+    height = 0;
+    count = 0;
+}
+
+/**
+ * @brief Rebuilds the tree bottom-up from strictly ascending keys.
+ *        Leaves are packed full and each inner level is built from the one below.
+ * @param sorted Keys in ascending order without duplicates.
+ */
+template <typename T>
+void BPlusTree<T>::assignSorted(const std::vector<T> &sorted)
+{
+    clear();
+    if (sorted.empty())
+    {
+        return;
+    }
+
+    // Leaf level, remembering the smallest key of every node as its separator
+    std::vector<uint32_t> level;
+    std::vector<T> firstKeys;
+    for (size_t i = 0; i < sorted.size(); i += LEAF_CAPACITY)
+    {
+        size_t n = std::min(LEAF_CAPACITY, sorted.size() - i);
+        leaves.emplace_back();
+        Leaf &leaf = leaves.back();
+        std::copy(sorted.begin() + i, sorted.begin() + i + n, leaf.keys);
+        leaf.count = static_cast<uint32_t>(n);
+        if (leaves.size() > 1)
+        {
+            leaves[leaves.size() - 2].next = static_cast<uint32_t>(leaves.size() - 1);
+        }
+        level.push_back(static_cast<uint32_t>(leaves.size() - 1));
+        firstKeys.push_back(sorted[i]);
+    }
+
+    // Inner levels until a single root remains
+    height = 0;
+    while (level.size() > 1)
+    {
+        std::vector<uint32_t> parents;
+        std::vector<T> parentKeys;
+        for (size_t i = 0; i < level.size(); i += INNER_CAPACITY + 1)
+        {
+            size_t n = std::min(INNER_CAPACITY + 1, level.size() - i);
+            inners.emplace_back();
+            Inner &inner = inners.back();
+            inner.count = static_cast<uint32_t>(n - 1);
+            for (size_t c = 0; c < n; ++c)
+            {
+                inner.children[c] = level[i + c];
+                if (c > 0)
+                {
+                    inner.keys[c - 1] = firstKeys[i + c];
+                }
+            }
+            parents.push_back(static_cast<uint32_t>(inners.size() - 1));
+            parentKeys.push_back(firstKeys[i]);
+        }
+        level.swap(parents);
+        firstKeys.swap(parentKeys);
+        ++height;
+    }
+
+    root = level[0];
+    count = sorted.size();
+}
+
+/**
+ * @brief Returns an iterator to the smallest key.
+ */
+template <typename T>
+typename BPlusTree<T>::const_iterator BPlusTree<T>::begin() const
+{
+    if (count == 0)
+    {
+        return end();
+    }
+    return const_iterator(this, 0, 0);
+}
+
+/**
+ * @brief Returns the past-the-end iterator.
+ */
+template <typename T>
+typename BPlusTree<T>::const_iterator BPlusTree<T>::end() const
+{
+    return const_iterator(this, NIL, 0);
+}
+
+/**
+ * @brief Calls fn(key) for every key in ascending order (leaf scan).
+ * @param fn Callable taking const T&.
+ */
+template <typename T>
+template <typename Fn>
+void BPlusTree<T>::forEach(Fn &&fn) const
+{
+    if (count == 0)
+    {
+        return;
+    }
+    for (uint32_t leaf = 0; leaf != NIL; leaf = leaves[leaf].next)
+    {
+        const Leaf &node = leaves[leaf];
+        for (uint32_t i = 0; i < node.count; ++i)
+        {
+            fn(node.keys[i]);
+        }
+    }
+}
+
+/**
+ * @brief Calls fn(keys, count) for every leaf in ascending order.
+ * @param fn Callable taking (const T*, size_t).
+ */
+template <typename T>
+template <typename Fn>
+void BPlusTree<T>::forEachLeaf(Fn &&fn) const
+{
+    if (count == 0)
+    {
+        return;
+    }
+    for (uint32_t leaf = 0; leaf != NIL; leaf = leaves[leaf].next)
+    {
+        fn(static_cast<const T *>(leaves[leaf].keys), static_cast<size_t>(leaves[leaf].count));
+    }
+}
+
+/**
+ * @brief Returns the key of rank `rank`, skipping whole leaves by their counts.
+ */
+template <typename T>
+T BPlusTree<T>::select(size_t rank) const
+{
+    uint32_t leaf = 0;
+    while (rank >= leaves[leaf].count)
+    {
+        rank -= leaves[leaf].count;
+        leaf = leaves[leaf].next;
+    }
+    return leaves[leaf].keys[rank];
+}
+
+/**
+ * @brief Returns the largest key by following the last child of every inner node.
+ */
+template <typename T>
+T BPlusTree<T>::back() const
+{
+    uint32_t node = root;
+    for (uint32_t level = height; level > 0; --level)
+    {
+        node = inners[node].children[inners[node].count];
+    }
+    return leaves[node].keys[leaves[node].count - 1];
+}
+
+#endif // BPLUSTREE_HXX
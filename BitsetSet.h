@@ -0,0 +1,194 @@
+// ===================================================================================
+// File:        BitsetSet.h
+// Author:      Group 4
+// Date:        2026-10-18
+// Description: Declaration of BitsetSet<T>, a set of integers stored as a bitmap
+//              over the span of its values, one bit per possible value. Dense
+//              sets cost span / 8 bytes, membership is a single bit test, and set
+//              algebra combines 64 values per machine word.
+//
+//              Supported operations:
+//              ----------------------------------------------------------------------
+//              bool insert(const T& value)
+//                  Sets the bit of a value, growing the bitmap when needed.
+//
+//              bool contains(const T& value) const
+//                  Checks one bit in O(1).
+//
+//              size_t size() const
+//                  Returns the number of values stored.
+//
+//              size_t memoryUsage() const
+//                  Returns the bytes allocated for the bitmap words.
+//
+//              size_t spanWith(const T& value) const
+//                  Returns how many bits the bitmap would cover after inserting value.
+//
+//              void clear()
+//                  Removes every value.
+//
+//              void assignSorted(const std::vector<T>& sorted)
+//                  Rebuilds the bitmap from strictly ascending values.
+//
+//              static BitsetSet combine(a, b, keepOnlyA, keepBoth, keepOnlyB)
+//                  Word-wise union, intersection, difference or symmetric difference.
+//
+//              static size_t combinedSpan(const BitsetSet& a, const BitsetSet& b)
+//                  Returns the number of bits a combined bitmap would cover.
+//
+//              bool isSubsetOf(const BitsetSet& other) const
+//                  Checks inclusion word by word.
+//
+//              void forEach(Fn fn) const
+//                  Calls fn(value) for every value in ascending order.
+//
+//              Generator<T> values() const
+//                  Yields every value lazily in ascending order.
+//
+//              int64_t sum() const / T select(size_t rank) const
+//                  Sum of the values and value of a given rank, from word
+//                  popcounts (no value is expanded).
+// ===================================================================================
+
+#ifndef BITSETSET_H
+#define BITSETSET_H
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+#include "Generator.h"
+
+/**
+ * @class BitsetSet
+ * @brief Bitmap-backed set of integers. Values are mapped to an order-preserving
+ *        unsigned key (the sign bit is flipped), and bit k of word w stands for
+ *        key 64 * (firstWord + w) + k. Leading and trailing zero words are trimmed.
+ *
+ * @tparam T Integral value type.
+ */
+template <typename T>
+class BitsetSet
+{
+public:
+    /// True for value types this container accepts.
+    static constexpr bool SUPPORTED = std::is_integral<T>::value && !std::is_same<T, bool>::value;
+
+    static constexpr size_t WORD_BITS = 64; ///< Values covered by one bitmap word.
+
+private:
+    std::vector<uint64_t> words; ///< Bitmap; words[0] covers key 64 * firstWord.
+    uint64_t firstWord;          ///< Word index of words[0] in key space.
+    size_t count;                ///< Number of bits set.
+
+    static uint64_t toKey(const T &value);
+    static T fromKey(uint64_t key);
+    uint64_t wordAt(uint64_t index) const;
+    void trim();
+
+public:
+    /**
+     * @brief Constructs an empty set.
+     */
+    BitsetSet();
+
+    /**
+     * @brief Sets the bit of a value, growing the bitmap at either end if needed.
+     * @param value The value to insert.
+     * @return True if the value was added, false if it already existed.
+     */
+    bool insert(const T &value);
+
+    /**
+     * @brief Checks whether the bit of a value is set.
+     * @param value The value to search.
+     * @return True if found.
+     */
+    bool contains(const T &value) const;
+
+    /**
+     * @brief Returns the number of values stored.
+     */
+    size_t size() const;
+
+    /**
+     * @brief Returns the bytes allocated for the bitmap words.
+     */
+    size_t memoryUsage() const;
+
+    /**
+     * @brief Returns how many bits the bitmap would cover after inserting value.
+     *        Lets callers refuse inserts that would make the bitmap sparse.
+     * @param value Candidate value.
+     * @return Covered bits (a multiple of WORD_BITS), saturated to SIZE_MAX.
+     */
+    size_t spanWith(const T &value) const;
+
+    /**
+     * @brief Removes every value.
+     */
+    void clear();
+
+    /**
+     * @brief Rebuilds the bitmap from strictly ascending values.
+     * @param sorted Values in ascending order without duplicates.
+     */
+    void assignSorted(const std::vector<T> &sorted);
+
+    /**
+     * @brief Combines two bitmaps word by word, keeping the bits selected by the flags.
+     * @param a First operand.
+     * @param b Second operand.
+     * @param keepOnlyA Keep values found only in a.
+     * @param keepBoth Keep values found in both sets.
+     * @param keepOnlyB Keep values found only in b.
+     * @return The combined set.
+     */
+    static BitsetSet combine(const BitsetSet &a, const BitsetSet &b,
+                             bool keepOnlyA, bool keepBoth, bool keepOnlyB);
+
+    /**
+     * @brief Returns the number of bits a bitmap covering both operands would span.
+     * @param a First operand.
+     * @param b Second operand.
+     * @return Covered bits, saturated to SIZE_MAX.
+     */
+    static size_t combinedSpan(const BitsetSet &a, const BitsetSet &b);
+
+    /**
+     * @brief Checks whether every bit of this set is also set in the other.
+     * @param other The candidate superset.
+     * @return True if this set is a subset of other.
+     */
+    bool isSubsetOf(const BitsetSet &other) const;
+
+    /**
+     * @brief Calls fn(value) for every value in ascending order.
+     * @param fn Callable taking const T&.
+     */
+    template <typename Fn>
+    void forEach(Fn &&fn) const;
+
+    /**
+     * @brief Yields every value lazily in ascending order.
+     */
+    Generator<T> values() const;
+
+    /**
+     * @brief Returns the sum of the values with six popcounts per word (the
+     *        bit positions are summed one position bit at a time). Wraps
+     *        modulo 2^64.
+     */
+    int64_t sum() const;
+
+    /**
+     * @brief Returns the value of rank `rank` (0 = smallest): words are skipped
+     *        by popcount, from whichever end of the bitmap is closer.
+     * @param rank Rank below size().
+     */
+    T select(size_t rank) const;
+};
+
+#include "BitsetSet.hxx"
+
+#endif // BITSETSET_H
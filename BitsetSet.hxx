@@ -0,0 +1,389 @@
+// ===================================================================================
+// File:        BitsetSet.hxx
+// Author:      Group 4
+// Date:        2026-10-18
+// Description: Implementation of the templated class BitsetSet<T>.
+// ===================================================================================
+// Group 4 | Joel Felipe Martinez | Xamuel Perez | Rafael Held
+
+#ifndef BITSETSET_HXX
+#define BITSETSET_HXX
+
+#include "BitsetSet.h"
+#include <algorithm> // For std::min, std::max
+#include <bit>       // For std::popcount, std::countr_zero
+#include <cstdint>   // For SIZE_MAX
+
+/**
+ * @brief Constructs an empty set.
+ */
+template <typename T>
+BitsetSet<T>::BitsetSet()
+    : words(), firstWord(0), count(0) {}
+
+/**
+ * @brief Maps a value to an unsigned key with the same ordering.
+ */
+template <typename T>
+uint64_t BitsetSet<T>::toKey(const T &value)
+{
+    typedef typename std::make_unsigned<T>::type Unsigned;
+    Unsigned bits = static_cast<Unsigned>(value);
+    if constexpr (std::is_signed<T>::value)
+    {
+        bits ^= static_cast<Unsigned>(Unsigned(1) << (sizeof(T) * 8 - 1));
+    }
+    return static_cast<uint64_t>(bits);
+}
+
+/**
+ * @brief Inverse of toKey().
+ */
+template <typename T>
+T BitsetSet<T>::fromKey(uint64_t key)
+{
+    typedef typename std::make_unsigned<T>::type Unsigned;
+    Unsigned bits = static_cast<Unsigned>(key);
+    if constexpr (std::is_signed<T>::value)
+    {
+        bits ^= static_cast<Unsigned>(Unsigned(1) << (sizeof(T) * 8 - 1));
+    }
+    return static_cast<T>(bits);
+}
+
+/**
+ * @brief Returns the word with key-space index `index`, or 0 outside the bitmap.
+ */
+template <typename T>
+uint64_t BitsetSet<T>::wordAt(uint64_t index) const
+{
+    if (index < firstWord || index - firstWord >= words.size())
+    {
+        return 0;
+    }
+    return words[index - firstWord];
+}
+
+/**
+ * @brief Drops zero words at both ends so the bitmap spans only stored values.
+ */
+template <typename T>
+void BitsetSet<T>::trim()
+{
+    while (!words.empty() && words.back() == 0)
+    {
+        words.pop_back();
+    }
+    size_t leading = 0;
+    while (leading < words.size() && words[leading] == 0)
+    {
+        ++leading;
+    }
+    words.erase(words.begin(), words.begin() + leading);
+    firstWord += leading;
+}
+
+/**
+ * @brief Sets the bit of a value, growing the bitmap at either end if needed.
+ * @param value The value to insert.
+ * @return True if the value was added, false if it already existed.
+ */
+template <typename T>
+bool BitsetSet<T>::insert(const T &value)
+{
+    uint64_t key = toKey(value);
+    uint64_t index = key / WORD_BITS;
+    if (words.empty())
+    {
+        firstWord = index;
+        words.assign(1, 0);
+    }
+    else if (index < firstWord)
+    {
+        words.insert(words.begin(), static_cast<size_t>(firstWord - index), 0);
+        firstWord = index;
+    }
+    else if (index - firstWord >= words.size())
+    {
+        words.resize(static_cast<size_t>(index - firstWord + 1), 0);
+    }
+
+    uint64_t &word = words[static_cast<size_t>(index - firstWord)];
+    uint64_t mask = uint64_t(1) << (key % WORD_BITS);
+    if (word & mask)
+    {
+        return false;
+    }
+    word |= mask;
+    ++count;
+    return true;
+}
+
+/**
+ * @brief Checks whether the bit of a value is set.
+ * @param value The value to search.
+ * @return True if found.
+ */
+template <typename T>
+bool BitsetSet<T>::contains(const T &value) const
+{
+    uint64_t key = toKey(value);
+    return (wordAt(key / WORD_BITS) >> (key % WORD_BITS)) & 1;
+}
+
+/**
+ * @brief Returns the number of values stored.
+ */
+template <typename T>
+size_t BitsetSet<T>::size() const
+{
+    return count;
+}
+
+/**
+ * @brief Returns the bytes allocated for the bitmap words.
+ */
+template <typename T>
+size_t BitsetSet<T>::memoryUsage() const
+{
+    return words.capacity() * sizeof(uint64_t);
+}
+
+/**
+ * @brief Returns how many bits the bitmap would cover after inserting value.
+ *        Lets callers refuse inserts that would make the bitmap sparse.
+ * @param value Candidate value.
+ * @return Covered bits (a multiple of WORD_BITS), saturated to SIZE_MAX.
+ */
+template <typename T>
+size_t BitsetSet<T>::spanWith(const T &value) const
+{
+    uint64_t index = toKey(value) / WORD_BITS;
+    if (words.empty())
+    {
+        return WORD_BITS;
+    }
+    uint64_t first = std::min(firstWord, index);
+    uint64_t last = std::max(firstWord + words.size() - 1, index);
+    uint64_t span = last - first + 1;
+    return span > SIZE_MAX / WORD_BITS ? SIZE_MAX : static_cast<size_t>(span * WORD_BITS);
+}
+
+/**
+ * @brief Removes every value.
+ */
+template <typename T>
+void BitsetSet<T>::clear()
+{
+    words.clear();
+    words.shrink_to_fit();
+    firstWord = 0;
+    count = 0;
+}
+
+/**
+ * @brief Rebuilds the bitmap from strictly ascending values.
+ * @param sorted Values in ascending order without duplicates.
+ */
+template <typename T>
+void BitsetSet<T>::assignSorted(const std::vector<T> &sorted)
+{
+    clear();
+    if (sorted.empty())
+    {
+        return;
+    }
+    firstWord = toKey(sorted.front()) / WORD_BITS;
+    words.assign(static_cast<size_t>(toKey(sorted.back()) / WORD_BITS - firstWord + 1), 0);
+    for (const T &value : sorted)
+    {
+        uint64_t key = toKey(value);
+        words[static_cast<size_t>(key / WORD_BITS - firstWord)] |= uint64_t(1) << (key % WORD_BITS);
+    }
+    count = sorted.size();
+}
+
+/**
+ * @brief Combines two bitmaps word by word, keeping the bits selected by the flags.
+ * @param a First operand.
+ * @param b Second operand.
+ * @param keepOnlyA Keep values found only in a.
+ * @param keepBoth Keep values found in both sets.
+ * @param keepOnlyB Keep values found only in b.
+ * @return The combined set.
+ */
+template <typename T>
+BitsetSet<T> BitsetSet<T>::combine(const BitsetSet &a, const BitsetSet &b,
+                                   bool keepOnlyA, bool keepBoth, bool keepOnlyB)
+{
+    BitsetSet result;
+    if (a.words.empty() && b.words.empty())
+    {
+        return result;
+    }
+
+    uint64_t first = a.words.empty() ? b.firstWord
+                                     : (b.words.empty() ? a.firstWord : std::min(a.firstWord, b.firstWord));
+    uint64_t end = std::max(a.firstWord + a.words.size(), b.firstWord + b.words.size());
+    uint64_t maskOnlyA = keepOnlyA ? ~uint64_t(0) : 0;
+    uint64_t maskBoth = keepBoth ? ~uint64_t(0) : 0;
+    uint64_t maskOnlyB = keepOnlyB ? ~uint64_t(0) : 0;
+
+    result.firstWord = first;
+    result.words.resize(static_cast<size_t>(end - first));
+    for (uint64_t index = first; index < end; ++index)
+    {
+        uint64_t wa = a.wordAt(index);
+        uint64_t wb = b.wordAt(index);
+        uint64_t word = (wa & ~wb & maskOnlyA) | (wa & wb & maskBoth) | (~wa & wb & maskOnlyB);
+        result.words[static_cast<size_t>(index - first)] = word;
+        result.count += static_cast<size_t>(std::popcount(word));
+    }
+    result.trim();
+    return result;
+}
+
+/**
+ * @brief Returns the number of bits a bitmap covering both operands would span.
+ * @param a First operand.
+ * @param b Second operand.
+ * @return Covered bits, saturated to SIZE_MAX.
+ */
+template <typename T>
+size_t BitsetSet<T>::combinedSpan(const BitsetSet &a, const BitsetSet &b)
+{
+    if (a.words.empty() || b.words.empty())
+    {
+        return (a.words.size() + b.words.size()) * WORD_BITS;
+    }
+    uint64_t first = std::min(a.firstWord, b.firstWord);
+    uint64_t end = std::max(a.firstWord + a.words.size(), b.firstWord + b.words.size());
+    uint64_t span = end - first;
+    return span > SIZE_MAX / WORD_BITS ? SIZE_MAX : static_cast<size_t>(span * WORD_BITS);
+}
+
+/**
+ * @brief Checks whether every bit of this set is also set in the other.
+ * @param other The candidate superset.
+ * @return True if this set is a subset of other.
+ */
+template <typename T>
+bool BitsetSet<T>::isSubsetOf(const BitsetSet &other) const
+{
+    if (count > other.count)
+    {
+        return false;
+    }
+    for (size_t w = 0; w < words.size(); ++w)
+    {
+        if (words[w] & ~other.wordAt(firstWord + w))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Calls fn(value) for every value in ascending order.
+ * @param fn Callable taking const T&.
+ */
+template <typename T>
+template <typename Fn>
+void BitsetSet<T>::forEach(Fn &&fn) const
+{
+    for (size_t w = 0; w < words.size(); ++w)
+    {
+        uint64_t word = words[w];
+        while (word != 0)
+        {
+            uint64_t bit = static_cast<uint64_t>(std::countr_zero(word));
+            fn(fromKey((firstWord + w) * WORD_BITS + bit));
+            word &= word - 1;
+        }
+    }
+}
+
+/**
+ * @brief Yields every value lazily in ascending order.
+ */
+template <typename T>
+Generator<T> BitsetSet<T>::values() const
+{
+    for (size_t w = 0; w < words.size(); ++w)
+    {
+        uint64_t word = words[w];
+        while (word != 0)
+        {
+            uint64_t bit = static_cast<uint64_t>(std::countr_zero(word));
+            co_yield fromKey((firstWord + w) * WORD_BITS + bit);
+            word &= word - 1;
+        }
+    }
+}
+
+/**
+ * @brief Returns the sum of the values. Within a word, the positions of the set
+ *        bits add up to the sum over b of 2^b * popcount(word & POSITION_BIT[b]),
+ *        where POSITION_BIT[b] marks the positions with bit b set. Keys are
+ *        values with the sign bit flipped, so signed sums subtract 2^(W-1) per value.
+ */
+template <typename T>
+int64_t BitsetSet<T>::sum() const
+{
+    static constexpr uint64_t POSITION_BIT[6] = {0xAAAAAAAAAAAAAAAAULL, 0xCCCCCCCCCCCCCCCCULL,
+                                                 0xF0F0F0F0F0F0F0F0ULL, 0xFF00FF00FF00FF00ULL,
+                                                 0xFFFF0000FFFF0000ULL, 0xFFFFFFFF00000000ULL};
+    uint64_t total = 0;
+    for (size_t w = 0; w < words.size(); ++w)
+    {
+        uint64_t word = words[w];
+        total += static_cast<uint64_t>(std::popcount(word)) * ((firstWord + w) * WORD_BITS);
+        for (unsigned b = 0; b < 6; ++b)
+        {
+            total += static_cast<uint64_t>(std::popcount(word & POSITION_BIT[b])) << b;
+        }
+    }
+    if constexpr (std::is_signed<T>::value)
+    {
+        total -= static_cast<uint64_t>(count) * (uint64_t(1) << (sizeof(T) * 8 - 1));
+    }
+    return static_cast<int64_t>(total);
+}
+
+/**
+ * @brief Returns the value of rank `rank`, counting set bits word by word from
+ *        the nearer end of the bitmap.
+ */
+template <typename T>
+T BitsetSet<T>::select(size_t rank) const
+{
+    size_t w = 0;
+    if (rank < count / 2)
+    {
+        while (rank >= static_cast<size_t>(std::popcount(words[w])))
+        {
+            rank -= static_cast<size_t>(std::popcount(words[w]));
+            ++w;
+        }
+    }
+    else
+    {
+        size_t fromEnd = count - 1 - rank; // Rank counted from the largest value
+        w = words.size() - 1;
+        while (fromEnd >= static_cast<size_t>(std::popcount(words[w])))
+        {
+            fromEnd -= static_cast<size_t>(std::popcount(words[w]));
+            --w;
+        }
+        rank = static_cast<size_t>(std::popcount(words[w])) - 1 - fromEnd;
+    }
+    uint64_t word = words[w];
+    for (; rank > 0; --rank)
+    {
+        word &= word - 1; // Drop the lowest set bits below the wanted one
+    }
+    return fromKey((firstWord + w) * WORD_BITS + static_cast<uint64_t>(std::countr_zero(word)));
+}
+
+#endif // BITSETSET_HXX
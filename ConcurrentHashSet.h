@@ -0,0 +1,214 @@
+// ===================================================================================
+// File:        ConcurrentHashSet.h
+// Author:      Group 4
+// Date:        2026-10-18
+// Description: Declaration of ConcurrentHashSet<T>, a lock-free open-addressing
+//              hash set for small integral keys. Slots are 64-bit atomics claimed
+//              with compare-and-swap; when a table fills up, every thread that
+//              touches it helps migrate fixed-size chunks into a table twice as
+//              large (cooperative resizing), so no operation takes a lock.
+//
+//              Supported operations:
+//              ----------------------------------------------------------------------
+//              bool insert(const T& value)                     [thread-safe]
+//                  Inserts a key; returns true if this call added it.
+//
+//              bool contains(const T& value) const             [thread-safe]
+//                  Checks whether a key is present.
+//
+//              void lookupBatch(const T* keys, size_t keyCount, Fn report) const
+//                  Prefetches the home slots of a group of keys, then probes them;
+//                  calls report(i, found) for each key.            [thread-safe]
+//
+//              size_t size() const                             [quiescent]
+//                  Returns the number of keys once no insert is running.
+//
+//              void reserve(size_t keys)                       [quiescent]
+//                  Grows the table so that `keys` keys fit without a resize.
+//
+//              size_t memoryUsage() const                      [quiescent]
+//                  Returns the heap bytes held by the tables.
+//
+//              void forEach(Fn fn) const                       [quiescent]
+//                  Calls fn(key) for every key, in table order.
+//
+//              Generator<T> values() const                     [quiescent]
+//                  Yields every key lazily, in table order.
+//
+//              void clear()                                    [quiescent]
+//                  Removes every key and frees all tables.
+// ===================================================================================
+
+#ifndef CONCURRENTHASHSET_H
+#define CONCURRENTHASHSET_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include "Generator.h"
+#include "Prefetch.h"
+
+/**
+ * @class ConcurrentHashSet
+ * @brief Lock-free set of integral keys (up to 32 bits) with linear probing.
+ *        Each slot stores the encoded key, EMPTY or MOVED. A slot only ever goes
+ *        EMPTY -> key -> MOVED or EMPTY -> MOVED, and a key is copied into the
+ *        next table before its slot is frozen, so readers that finish a probe in
+ *        a resizing table can always continue in its successor.
+ *
+ *        Tables replaced by a resize stay linked until clear() or destruction,
+ *        because concurrent readers may still be probing them.
+ *
+ * @tparam T Integral key type with sizeof(T) <= 4.
+ */
+template <typename T>
+class ConcurrentHashSet
+{
+private:
+    static constexpr uint64_t EMPTY = 0;       ///< Slot never used.
+    static constexpr uint64_t MOVED = 1;       ///< Slot frozen by a migration.
+    static constexpr size_t INITIAL_CAPACITY = 16;
+    static constexpr size_t MIGRATION_CHUNK = 4096; ///< Slots migrated per claim.
+    static constexpr size_t BATCH_GROUP = 16;       ///< Keys prefetched together by lookupBatch.
+
+    /**
+     * @brief One open-addressing table plus its migration bookkeeping.
+     */
+    struct Table
+    {
+        size_t capacity;                                ///< Power of two.
+        std::unique_ptr<std::atomic<uint64_t>[]> slots; ///< Encoded keys.
+        std::atomic<size_t> used;                       ///< Keys placed in this table.
+        std::atomic<Table *> next;                      ///< Successor while/after resizing.
+        std::atomic<bool> resizeClaimed;                ///< Set by the thread allocating `next`.
+        std::atomic<size_t> claimedChunks;              ///< Migration chunks handed out.
+        std::atomic<size_t> finishedChunks;             ///< Migration chunks completed.
+
+        explicit Table(size_t cap);
+        size_t chunkCount() const { return (capacity + MIGRATION_CHUNK - 1) / MIGRATION_CHUNK; }
+    };
+
+    /**
+     * @brief Outcome of probing a single table.
+     */
+    enum class ProbeResult
+    {
+        INSERTED,
+        PRESENT,
+        MOVED,
+        FULL
+    };
+
+    Table *oldest;                ///< First table of the chain (owned; for cleanup).
+    std::atomic<Table *> current; ///< Table new operations start from.
+
+    static uint64_t encode(const T &value);
+    static T decode(uint64_t slot);
+    static size_t hash(uint64_t encoded);
+    static size_t capacityFor(size_t keys);
+
+    Table *acquireTable();
+    bool insertFrom(Table *table, uint64_t encoded);
+    ProbeResult probeInsert(Table *table, uint64_t encoded);
+    void startResize(Table *table);
+    void helpMigrate(Table *table);
+    void advanceCurrent();
+    const Table *newestTable() const;
+    void destroyTables();
+
+public:
+    /// True for key types this container accepts.
+    static constexpr bool SUPPORTED = std::is_integral<T>::value &&
+                                      !std::is_same<T, bool>::value && sizeof(T) <= 4;
+
+    /**
+     * @brief Constructs an empty set; the first table is allocated on first insert.
+     */
+    ConcurrentHashSet();
+
+    /**
+     * @brief Copies the keys of another set (the source must be quiescent).
+     */
+    ConcurrentHashSet(const ConcurrentHashSet &other);
+
+    /**
+     * @brief Takes over the tables of another set (the source must be quiescent).
+     */
+    ConcurrentHashSet(ConcurrentHashSet &&other) noexcept;
+
+    ConcurrentHashSet &operator=(const ConcurrentHashSet &other);
+    ConcurrentHashSet &operator=(ConcurrentHashSet &&other) noexcept;
+
+    ~ConcurrentHashSet();
+
+    /**
+     * @brief Inserts a key. Safe to call from many threads at once.
+     *        While a resize is in flight the return value may report true for a
+     *        key that was concurrently being migrated; the set itself stays exact.
+     * @param value The key to insert.
+     * @return True if this call added the key.
+     */
+    bool insert(const T &value);
+
+    /**
+     * @brief Checks whether a key is present. Safe to call concurrently with insert.
+     * @param value The key to search.
+     * @return True if found.
+     */
+    bool contains(const T &value) const;
+
+    /**
+     * @brief Looks up a batch of keys: the home slot of every key in a group of
+     *        BATCH_GROUP is prefetched before any of them is probed.
+     * @param keys Keys to search.
+     * @param keyCount Number of keys.
+     * @param report Callable invoked as report(index, found) for every key.
+     */
+    template <typename Fn>
+    void lookupBatch(const T *keys, size_t keyCount, Fn &&report) const;
+
+    /**
+     * @brief Returns the number of keys. Exact once no insert is running.
+     */
+    size_t size() const;
+
+    /**
+     * @brief Grows the table so that `keys` keys fit below the load-factor
+     *        limit, rehashing the present keys once (no concurrent access allowed).
+     *        Filling a table in the slot order of another one with the same
+     *        hash piles keys into long probe clusters while the target is the
+     *        smaller of the two; reserving the final size first avoids that.
+     * @param keys Number of keys the set will hold.
+     */
+    void reserve(size_t keys);
+
+    /**
+     * @brief Returns the bytes held by every table of the chain (tables
+     *        outgrown by a resize are kept until clear()). Exact once no insert is running.
+     */
+    size_t memoryUsage() const;
+
+    /**
+     * @brief Removes every key and frees all tables (no concurrent access allowed).
+     */
+    void clear();
+
+    /**
+     * @brief Calls fn(key) for every key in table order (no concurrent inserts allowed).
+     * @param fn Callable taking const T&.
+     */
+    template <typename Fn>
+    void forEach(Fn &&fn) const;
+
+    /**
+     * @brief Yields every key lazily in table order (no concurrent inserts allowed
+     *        while the generator is alive).
+     */
+    Generator<T> values() const;
+};
+
+#include "ConcurrentHashSet.hxx"
+
+#endif // CONCURRENTHASHSET_H
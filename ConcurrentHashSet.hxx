@@ -0,0 +1,534 @@
+// ===================================================================================
+// File:        ConcurrentHashSet.hxx
+// Author:      Group 4
+// Date:        2026-10-18
+// Description: Implementation of the templated class ConcurrentHashSet<T>.
+// ===================================================================================
+// Group 4 | Joel Felipe Martinez | Xamuel Perez | Rafael Held
+
+#ifndef CONCURRENTHASHSET_HXX
+#define CONCURRENTHASHSET_HXX
+
+#include "ConcurrentHashSet.h"
+#include <algorithm> // For std::min
+#include <thread>    // For std::this_thread::yield
+
+/**
+ * @brief Allocates a table with every slot EMPTY.
+ */
+template <typename T>
+ConcurrentHashSet<T>::Table::Table(size_t cap)
+    : capacity(cap), slots(new std::atomic<uint64_t>[cap]), used(0), next(nullptr),
+      resizeClaimed(false), claimedChunks(0), finishedChunks(0)
+{
+    for (size_t i = 0; i < cap; ++i)
+    {
+        slots[i].store(EMPTY, std::memory_order_relaxed);
+    }
+}
+
+/**
+ * @brief Constructs an empty set; the first table is allocated on first insert.
+ */
+template <typename T>
+ConcurrentHashSet<T>::ConcurrentHashSet() : oldest(nullptr), current(nullptr) {}
+
+/**
+ * @brief Copies the keys of another set (the source must be quiescent).
+ */
+template <typename T>
+ConcurrentHashSet<T>::ConcurrentHashSet(const ConcurrentHashSet &other)
+    : oldest(nullptr), current(nullptr)
+{
+    *this = other;
+}
+
+/**
+ * @brief Takes over the tables of another set (the source must be quiescent).
+ */
+template <typename T>
+ConcurrentHashSet<T>::ConcurrentHashSet(ConcurrentHashSet &&other) noexcept
+    : oldest(other.oldest), current(other.current.load(std::memory_order_relaxed))
+{
+    other.oldest = nullptr;
+    other.current.store(nullptr, std::memory_order_relaxed);
+}
+
+template <typename T>
+ConcurrentHashSet<T> &ConcurrentHashSet<T>::operator=(const ConcurrentHashSet &other)
+{
+    if (this == &other)
+    {
+        return *this;
+    }
+    destroyTables();
+
+    reserve(other.size()); // The copy never resizes
+    other.forEach([this](const T &value)
+                  { insert(value); });
+    return *this;
+}
+
+template <typename T>
+ConcurrentHashSet<T> &ConcurrentHashSet<T>::operator=(ConcurrentHashSet &&other) noexcept
+{
+    if (this != &other)
+    {
+        destroyTables();
+        oldest = other.oldest;
+        current.store(other.current.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        other.oldest = nullptr;
+        other.current.store(nullptr, std::memory_order_relaxed);
+    }
+    return *this;
+}
+
+template <typename T>
+ConcurrentHashSet<T>::~ConcurrentHashSet()
+{
+    destroyTables();
+}
+
+/**
+ * @brief Maps a key to a slot value that never collides with EMPTY or MOVED.
+ */
+template <typename T>
+uint64_t ConcurrentHashSet<T>::encode(const T &value)
+{
+    using Unsigned = typename std::make_unsigned<T>::type;
+    return static_cast<uint64_t>(static_cast<Unsigned>(value)) + 2;
+}
+
+/**
+ * @brief Inverse of encode().
+ */
+template <typename T>
+T ConcurrentHashSet<T>::decode(uint64_t slot)
+{
+    using Unsigned = typename std::make_unsigned<T>::type;
+    return static_cast<T>(static_cast<Unsigned>(slot - 2));
+}
+
+/**
+ * @brief 64-bit finalizer (MurmurHash3 fmix64) to spread consecutive keys.
+ */
+template <typename T>
+size_t ConcurrentHashSet<T>::hash(uint64_t encoded)
+{
+    encoded ^= encoded >> 33;
+    encoded *= 0xff51afd7ed558ccdULL;
+    encoded ^= encoded >> 33;
+    encoded *= 0xc4ceb9fe1a85ec53ULL;
+    encoded ^= encoded >> 33;
+    return static_cast<size_t>(encoded);
+}
+
+/**
+ * @brief Smallest table capacity that holds `keys` keys below the 3/4 load factor.
+ */
+template <typename T>
+size_t ConcurrentHashSet<T>::capacityFor(size_t keys)
+{
+    size_t capacity = INITIAL_CAPACITY;
+    while (capacity * 3 < keys * 4 + 4)
+    {
+        capacity *= 2;
+    }
+    return capacity;
+}
+
+/**
+ * @brief Returns the current table, installing the first one if needed.
+ */
+template <typename T>
+typename ConcurrentHashSet<T>::Table *ConcurrentHashSet<T>::acquireTable()
+{
+    Table *table = current.load(std::memory_order_acquire);
+    if (table != nullptr)
+    {
+        return table;
+    }
+    Table *fresh = new Table(INITIAL_CAPACITY);
+    if (current.compare_exchange_strong(table, fresh, std::memory_order_acq_rel))
+    {
+        oldest = fresh;
+        return fresh;
+    }
+    delete fresh; // Another thread installed the first table
+    return table;
+}
+
+/**
+ * @brief Inserts a key. Safe to call from many threads at once.
+ * @param value The key to insert.
+ * @return True if this call added the key.
+ */
+template <typename T>
+bool ConcurrentHashSet<T>::insert(const T &value)
+{
+    return insertFrom(acquireTable(), encode(value));
+}
+
+/**
+ * @brief Inserts an encoded key starting at `table`, following and helping any
+ *        resize encountered on the way.
+ */
+template <typename T>
+bool ConcurrentHashSet<T>::insertFrom(Table *table, uint64_t encoded)
+{
+    for (;;)
+    {
+        Table *next = table->next.load(std::memory_order_acquire);
+        if (next != nullptr)
+        {
+            helpMigrate(table);
+            table = next;
+            continue;
+        }
+
+        if ((table->used.load(std::memory_order_relaxed) + 1) * 4 > table->capacity * 3)
+        {
+            startResize(table);
+            if (table->next.load(std::memory_order_acquire) != nullptr)
+            {
+                continue;
+            }
+            // Another thread is still allocating the successor: keep using this one
+        }
+
+        switch (probeInsert(table, encoded))
+        {
+        case ProbeResult::INSERTED:
+            return true;
+        case ProbeResult::PRESENT:
+            return false;
+        case ProbeResult::MOVED:
+            continue;
+        case ProbeResult::FULL:
+            startResize(table);
+            std::this_thread::yield();
+            continue;
+        }
+    }
+}
+
+/**
+ * @brief Linear probing in a single table; claims an EMPTY slot with CAS.
+ */
+template <typename T>
+typename ConcurrentHashSet<T>::ProbeResult
+ConcurrentHashSet<T>::probeInsert(Table *table, uint64_t encoded)
+{
+    size_t mask = table->capacity - 1;
+    size_t index = hash(encoded) & mask;
+    for (size_t i = 0; i < table->capacity; ++i, index = (index + 1) & mask)
+    {
+        std::atomic<uint64_t> &slot = table->slots[index];
+        uint64_t seen = slot.load(std::memory_order_acquire);
+        if (seen == EMPTY)
+        {
+            if (slot.compare_exchange_strong(seen, encoded, std::memory_order_acq_rel,
+                                             std::memory_order_acquire))
+            {
+                table->used.fetch_add(1, std::memory_order_relaxed);
+                return ProbeResult::INSERTED;
+            }
+            // Lost the race: `seen` now holds the winner's value
+        }
+        if (seen == encoded)
+        {
+            return ProbeResult::PRESENT;
+        }
+        if (seen == MOVED)
+        {
+            return ProbeResult::MOVED;
+        }
+    }
+    return ProbeResult::FULL;
+}
+
+/**
+ * @brief Publishes a successor table twice as large. Only the thread that wins
+ *        `resizeClaimed` allocates, so racing threads never duplicate the work.
+ */
+template <typename T>
+void ConcurrentHashSet<T>::startResize(Table *table)
+{
+    if (table->resizeClaimed.exchange(true, std::memory_order_acq_rel))
+    {
+        return;
+    }
+    table->next.store(new Table(table->capacity * 2), std::memory_order_release);
+}
+
+/**
+ * @brief Claims migration chunks of `table` until none are left. Each slot is
+ *        copied into the successor before being frozen as MOVED, so a reader that
+ *        follows MOVED always finds the key.
+ */
+template <typename T>
+void ConcurrentHashSet<T>::helpMigrate(Table *table)
+{
+    Table *next = table->next.load(std::memory_order_acquire);
+    size_t chunks = table->chunkCount();
+
+    for (;;)
+    {
+        size_t chunk = table->claimedChunks.fetch_add(1, std::memory_order_relaxed);
+        if (chunk >= chunks)
+        {
+            break;
+        }
+
+        size_t begin = chunk * MIGRATION_CHUNK;
+        size_t end = std::min(begin + MIGRATION_CHUNK, table->capacity);
+        for (size_t i = begin; i < end; ++i)
+        {
+            std::atomic<uint64_t> &slot = table->slots[i];
+            uint64_t seen = slot.load(std::memory_order_acquire);
+            while (seen == EMPTY &&
+                   !slot.compare_exchange_weak(seen, MOVED, std::memory_order_acq_rel,
+                                               std::memory_order_acquire))
+            {
+            }
+            if (seen != EMPTY && seen != MOVED)
+            {
+                insertFrom(next, seen);
+                slot.store(MOVED, std::memory_order_release);
+            }
+        }
+        table->finishedChunks.fetch_add(1, std::memory_order_acq_rel);
+    }
+    advanceCurrent();
+}
+
+/**
+ * @brief Moves `current` past every table whose migration has completed.
+ */
+template <typename T>
+void ConcurrentHashSet<T>::advanceCurrent()
+{
+    Table *table = current.load(std::memory_order_acquire);
+    while (table != nullptr)
+    {
+        Table *next = table->next.load(std::memory_order_acquire);
+        if (next == nullptr ||
+            table->finishedChunks.load(std::memory_order_acquire) < table->chunkCount())
+        {
+            return;
+        }
+        if (current.compare_exchange_strong(table, next, std::memory_order_acq_rel))
+        {
+            table = next;
+        }
+    }
+}
+
+/**
+ * @brief Checks whether a key is present. Safe to call concurrently with insert.
+ * @param value The key to search.
+ * @return True if found.
+ */
+template <typename T>
+bool ConcurrentHashSet<T>::contains(const T &value) const
+{
+    const Table *table = current.load(std::memory_order_acquire);
+    uint64_t encoded = encode(value);
+    while (table != nullptr)
+    {
+        const Table *next = table->next.load(std::memory_order_acquire);
+        if (next != nullptr &&
+            table->finishedChunks.load(std::memory_order_acquire) == table->chunkCount())
+        {
+            table = next; // Fully migrated: every slot is MOVED
+            continue;
+        }
+
+        // MOVED slots are skipped rather than followed: later slots on the probe
+        // path may still hold keys that have not been migrated yet
+        size_t mask = table->capacity - 1;
+        size_t index = hash(encoded) & mask;
+        for (size_t i = 0; i < table->capacity; ++i, index = (index + 1) & mask)
+        {
+            uint64_t seen = table->slots[index].load(std::memory_order_acquire);
+            if (seen == encoded)
+            {
+                return true;
+            }
+            if (seen == EMPTY)
+            {
+                break;
+            }
+        }
+        // Inserts may already target the successor while this table still has
+        // EMPTY slots, so keep looking there if it exists
+        table = table->next.load(std::memory_order_acquire);
+    }
+    return false;
+}
+
+/**
+ * @brief Looks up a batch of keys: the home slot of every key in a group of
+ *        BATCH_GROUP is prefetched before any of them is probed.
+ * @param keys Keys to search.
+ * @param keyCount Number of keys.
+ * @param report Callable invoked as report(index, found) for every key.
+ */
+template <typename T>
+template <typename Fn>
+void ConcurrentHashSet<T>::lookupBatch(const T *keys, size_t keyCount, Fn &&report) const
+{
+    for (size_t base = 0; base < keyCount; base += BATCH_GROUP)
+    {
+        size_t group = std::min(BATCH_GROUP, keyCount - base);
+        const Table *table = current.load(std::memory_order_acquire);
+        if (table != nullptr)
+        {
+            size_t mask = table->capacity - 1;
+            for (size_t g = 0; g < group; ++g)
+            {
+                prefetchRead(&table->slots[hash(encode(keys[base + g])) & mask]);
+            }
+        }
+        for (size_t g = 0; g < group; ++g)
+        {
+            report(base + g, contains(keys[base + g]));
+        }
+    }
+}
+
+/**
+ * @brief Returns the last table of the chain, which holds every key once
+ *        all migrations have finished.
+ */
+template <typename T>
+const typename ConcurrentHashSet<T>::Table *ConcurrentHashSet<T>::newestTable() const
+{
+    const Table *table = current.load(std::memory_order_acquire);
+    while (table != nullptr && table->next.load(std::memory_order_acquire) != nullptr)
+    {
+        table = table->next.load(std::memory_order_acquire);
+    }
+    return table;
+}
+
+/**
+ * @brief Grows the table so that `keys` keys fit without a resize
+ *        (no concurrent access allowed).
+ * @param keys Number of keys the set will hold.
+ */
+template <typename T>
+void ConcurrentHashSet<T>::reserve(size_t keys)
+{
+    size_t capacity = capacityFor(keys);
+    const Table *table = newestTable();
+    if (keys == 0 || (table != nullptr && table->capacity >= capacity))
+    {
+        return;
+    }
+    ConcurrentHashSet<T> grown;
+    grown.oldest = new Table(capacity);
+    grown.current.store(grown.oldest, std::memory_order_relaxed);
+    forEach([&grown](const T &value)
+            { grown.insert(value); });
+    *this = std::move(grown);
+}
+
+/**
+ * @brief Returns the number of keys. Exact once no insert is running.
+ */
+template <typename T>
+size_t ConcurrentHashSet<T>::size() const
+{
+    const Table *table = newestTable();
+    return table == nullptr ? 0 : table->used.load(std::memory_order_acquire);
+}
+
+/**
+ * @brief Returns the bytes held by every table of the chain (tables
+ *        outgrown by a resize are kept until clear()). Exact once no insert is running.
+ */
+template <typename T>
+size_t ConcurrentHashSet<T>::memoryUsage() const
+{
+    size_t bytes = 0;
+    for (const Table *table = oldest; table != nullptr;
+         table = table->next.load(std::memory_order_acquire))
+    {
+        bytes += sizeof(Table) + table->capacity * sizeof(std::atomic<uint64_t>);
+    }
+    return bytes;
+}
+
+/**
+ * @brief Removes every key and frees all tables (no concurrent access allowed).
+ */
+template <typename T>
+void ConcurrentHashSet<T>::clear()
+{
+    destroyTables();
+}
+
+/**
+ * @brief Deletes the whole table chain.
+ */
+template <typename T>
+void ConcurrentHashSet<T>::destroyTables()
+{
+    Table *table = oldest;
+    while (table != nullptr)
+    {
+        Table *next = table->next.load(std::memory_order_relaxed);
+        delete table;
+        table = next;
+    }
+    oldest = nullptr;
+    current.store(nullptr, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Calls fn(key) for every key in table order (no concurrent inserts allowed).
+ * @param fn Callable taking const T&.
+ */
+template <typename T>
+template <typename Fn>
+void ConcurrentHashSet<T>::forEach(Fn &&fn) const
+{
+    const Table *table = newestTable();
+    if (table == nullptr)
+    {
+        return;
+    }
+    for (size_t i = 0; i < table->capacity; ++i)
+    {
+        uint64_t seen = table->slots[i].load(std::memory_order_relaxed);
+        if (seen != EMPTY && seen != MOVED)
+        {
+            fn(decode(seen));
+        }
+    }
+}
+
+/**
+ * @brief Yields every key lazily in table order (no concurrent inserts allowed
+ *        while the generator is alive).
+ */
+template <typename T>
+Generator<T> ConcurrentHashSet<T>::values() const
+{
+    const Table *table = newestTable();
+    if (table == nullptr)
+    {
+        co_return;
+    }
+    for (size_t i = 0; i < table->capacity; ++i)
+    {
+        uint64_t seen = table->slots[i].load(std::memory_order_relaxed);
+        if (seen != EMPTY && seen != MOVED)
+        {
+            co_yield decode(seen);
+        }
+    }
+}
+
+#endif // CONCURRENTHASHSET_HXX
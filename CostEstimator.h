@@ -0,0 +1,204 @@
+// ===================================================================================
+// File:        CostEstimator.h
+// Author:      Group 4
+// Date:        2026-10-18
+// Description: Cost model of the set queries and the admission control built on it.
+//              Before a query runs, its output size and work are predicted from
+//              the sizes of its operands alone (2^n subsets for a power set,
+//              n·m pairs for a Cartesian product, at most n + m elements for a
+//              union, ...), refined by the set statistics when the caller has
+//              them (see SetStatistics<T>::estimateOverlap). AdmissionControl compares the prediction against
+//              configured limits and decides whether the query is rejected,
+//              truncated to its first items, or streamed without buffering.
+//
+//              Counts saturate at UINT64_MAX instead of overflowing, so the
+//              power set of a set with millions of elements is still estimated
+//              (and refused) in constant time.
+//
+//              Supported operations:
+//              ----------------------------------------------------------------------
+//              QueryCost estimateSetOperation(std::string_view op, size_t sizeA, size_t sizeB,
+//                                             uint64_t overlap)
+//                  Union, intersection, difference or symmetric difference.
+//
+//              QueryCost estimatePowerSet(size_t size)
+//                  Power set of a set with `size` elements.
+//
+//              QueryCost estimateCartesianProduct(size_t sizeA, size_t sizeB)
+//                  Cartesian product of two sets.
+//
+//              QueryCost estimateScan(size_t items, size_t work)
+//                  Any other query: `items` results after `work` steps.
+//
+//              const char* limitActionName(LimitAction action)
+//              bool parseLimitAction(std::string_view text, LimitAction& action)
+//                  Convert a LimitAction to and from its command-line name.
+//
+//              AdmissionControl::Decision AdmissionControl::admit(const QueryCost& cost) const
+//                  Decides how a query with the given cost may run.
+//
+//              void AdmissionControl::require(const QueryCost& cost) const
+//                  Throws unless the cost is within both limits.
+// ===================================================================================
+
+#ifndef COSTESTIMATOR_H
+#define COSTESTIMATOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+/**
+ * @struct QueryCost
+ * @brief Predicted size of a query's result and the work needed to produce it.
+ *        Both counts are upper bounds and saturate at UINT64_MAX.
+ */
+struct QueryCost
+{
+    uint64_t items;          ///< Results printed: elements, subsets or pairs.
+    uint64_t work;           ///< Values read or produced while answering.
+    std::string description; ///< The estimate as text, e.g. "2^40 subsets".
+};
+
+/**
+ * @brief Returns a·b, or UINT64_MAX if the product does not fit.
+ */
+uint64_t saturatingMultiply(uint64_t a, uint64_t b);
+
+/**
+ * @brief Returns a + b, or UINT64_MAX if the sum does not fit.
+ */
+uint64_t saturatingAdd(uint64_t a, uint64_t b);
+
+/**
+ * @brief Estimates a binary set operation. Union and symmetric difference may
+ *        print every element of both operands; intersection at most the smaller
+ *        operand, or the estimated overlap when one is given; difference at
+ *        most the left one. Lazy intersection and difference probe the left
+ *        operand's elements into the right one, so their work is the left
+ *        size; the others read both operands.
+ * @param op "union", "intersection", "difference" or "symmetric_difference".
+ * @param sizeA Elements of the left operand.
+ * @param sizeB Elements of the right operand.
+ * @param overlap Estimated |A ∩ B| (UINT64_MAX: unknown). Being an estimate,
+ *        it makes the intersection's item count an estimate rather than a bound.
+ * @return The estimate (zero for an unknown op).
+ */
+QueryCost estimateSetOperation(std::string_view op, size_t sizeA, size_t sizeB,
+                               uint64_t overlap = UINT64_MAX);
+
+/**
+ * @brief Estimates the power set of a set with `size` elements: 2^size subsets
+ *        holding size·2^(size-1) values in total.
+ * @param size Elements of the set.
+ * @return The estimate.
+ */
+QueryCost estimatePowerSet(size_t size);
+
+/**
+ * @brief Estimates the Cartesian product A × B: sizeA·sizeB pairs.
+ * @param sizeA Elements of A.
+ * @param sizeB Elements of B.
+ * @return The estimate.
+ */
+QueryCost estimateCartesianProduct(size_t sizeA, size_t sizeB);
+
+/**
+ * @brief Estimates a query whose result and work are known directly (print,
+ *        contains, issubset, ...).
+ * @param items Results printed.
+ * @param work Values read.
+ * @return The estimate.
+ */
+QueryCost estimateScan(size_t items, size_t work);
+
+/**
+ * @enum LimitAction
+ * @brief What happens to a query whose estimate exceeds a limit.
+ */
+enum class LimitAction
+{
+    REJECT,   ///< Not run at all; a diagnostic explains why.
+    TRUNCATE, ///< Only the first items (up to the output limit) are produced.
+    STREAM    ///< Run in full, but written straight to the output, never buffered.
+};
+
+/**
+ * @brief Returns the command-line name of an action ("reject", "truncate", "stream").
+ */
+const char *limitActionName(LimitAction action);
+
+/**
+ * @brief Parses the command-line name of an action.
+ * @param text "reject", "truncate" or "stream".
+ * @param action Receives the action.
+ * @return False if the name is unknown (action is left unchanged).
+ */
+bool parseLimitAction(std::string_view text, LimitAction &action);
+
+/**
+ * @class AdmissionControl
+ * @brief Limits on the estimated output and work of a single query, and the
+ *        action taken when a query exceeds them. A default-constructed
+ *        instance has no limits and admits everything unchanged.
+ */
+class AdmissionControl
+{
+    uint64_t maxItems;  ///< Largest admitted output (UINT64_MAX: unlimited).
+    uint64_t maxWork;   ///< Largest admitted work (UINT64_MAX: unlimited).
+    LimitAction action; ///< What happens beyond a limit.
+
+public:
+    /**
+     * @brief Outcome of admit().
+     */
+    struct Decision
+    {
+        bool admitted;          ///< False if the query must not run.
+        uint64_t itemLimit;     ///< Results to produce at most (UINT64_MAX: all).
+        bool streamed;          ///< True if the output must not be buffered.
+        std::string diagnostic; ///< Why the query was limited (empty if it was not).
+    };
+
+    /**
+     * @brief Creates an admission control without limits.
+     */
+    AdmissionControl();
+
+    /**
+     * @brief Creates an admission control with the given limits.
+     * @param itemLimit Largest output in items (UINT64_MAX: unlimited).
+     * @param workLimit Largest work (UINT64_MAX: unlimited).
+     * @param overLimit Action for queries beyond a limit.
+     */
+    AdmissionControl(uint64_t itemLimit, uint64_t workLimit, LimitAction overLimit);
+
+    /**
+     * @brief True if no limit is set, so that estimating is pointless.
+     */
+    bool isUnlimited() const;
+
+    /**
+     * @brief Decides how a query may run. Within both limits it runs unchanged.
+     *        Otherwise REJECT refuses it; STREAM runs it unbuffered; TRUNCATE
+     *        keeps as many leading items as fit under the item limit and, with
+     *        the work scaled down in proportion, under the work limit. A query
+     *        that cannot produce a single item within the work limit is refused.
+     * @param cost Estimate of the query.
+     * @return The decision, with a diagnostic whenever the query is limited.
+     */
+    Decision admit(const QueryCost &cost) const;
+
+    /**
+     * @brief Checks a query whose result is materialized as a whole, which can
+     *        be neither truncated nor streamed, so any action acts as REJECT.
+     * @param cost Estimate of the query.
+     * @throws std::runtime_error if the cost exceeds a limit.
+     */
+    void require(const QueryCost &cost) const;
+};
+
+#include "CostEstimator.hxx"
+
+#endif // COSTESTIMATOR_H
@@ -0,0 +1,191 @@
+// ===================================================================================
+// File:        CostEstimator.hxx
+// Author:      Group 4
+// Date:        2026-10-18
+// Description: Implementation of the query cost model and of AdmissionControl.
+// ===================================================================================
+// Group 4 | Joel Felipe Martinez | Xamuel Perez | Rafael Held
+
+#ifndef COSTESTIMATOR_HXX
+#define COSTESTIMATOR_HXX
+
+#include "CostEstimator.h"
+#include <algorithm> // For std::min
+#include <limits>
+#include <stdexcept> // For std::runtime_error
+
+inline uint64_t saturatingMultiply(uint64_t a, uint64_t b)
+{
+    if (a != 0 && b > std::numeric_limits<uint64_t>::max() / a)
+    {
+        return std::numeric_limits<uint64_t>::max();
+    }
+    return a * b;
+}
+
+inline uint64_t saturatingAdd(uint64_t a, uint64_t b)
+{
+    if (b > std::numeric_limits<uint64_t>::max() - a)
+    {
+        return std::numeric_limits<uint64_t>::max();
+    }
+    return a + b;
+}
+
+/**
+ * @brief Prints a saturated count ("2^64 or more" once it no longer fits).
+ */
+inline std::string formatCount(uint64_t count)
+{
+    if (count == std::numeric_limits<uint64_t>::max())
+    {
+        return "2^64 or more";
+    }
+    return std::to_string(count);
+}
+
+inline QueryCost estimateSetOperation(std::string_view op, size_t sizeA, size_t sizeB,
+                                      uint64_t overlap)
+{
+    uint64_t both = saturatingAdd(sizeA, sizeB);
+    uint64_t items = 0;
+    uint64_t work = 0;
+    if (op == "union" || op == "symmetric_difference")
+    {
+        items = both;
+        work = both;
+    }
+    else if (op == "intersection")
+    {
+        items = std::min<uint64_t>({sizeA, sizeB, overlap});
+        work = sizeA;
+    }
+    else if (op == "difference")
+    {
+        items = sizeA;
+        work = sizeA;
+    }
+    return QueryCost{items, work, "up to " + formatCount(items) + " elements"};
+}
+
+inline QueryCost estimatePowerSet(size_t size)
+{
+    uint64_t subsets = size < 64 ? uint64_t(1) << size : std::numeric_limits<uint64_t>::max();
+    uint64_t values = size == 0    ? 0
+                      : size < 64 ? saturatingMultiply(size, subsets / 2)
+                                  : std::numeric_limits<uint64_t>::max();
+    return QueryCost{subsets, saturatingAdd(subsets, values),
+                     "2^" + std::to_string(size) + " subsets"};
+}
+
+inline QueryCost estimateCartesianProduct(size_t sizeA, size_t sizeB)
+{
+    uint64_t pairs = saturatingMultiply(sizeA, sizeB);
+    return QueryCost{pairs, pairs,
+                     std::to_string(sizeA) + " × " + std::to_string(sizeB) + " pairs"};
+}
+
+inline QueryCost estimateScan(size_t items, size_t work)
+{
+    return QueryCost{items, work, formatCount(items) + " results"};
+}
+
+inline const char *limitActionName(LimitAction action)
+{
+    switch (action)
+    {
+    case LimitAction::REJECT:
+        return "reject";
+    case LimitAction::TRUNCATE:
+        return "truncate";
+    case LimitAction::STREAM:
+        return "stream";
+    }
+    return "unknown";
+}
+
+inline bool parseLimitAction(std::string_view text, LimitAction &action)
+{
+    for (LimitAction candidate : {LimitAction::REJECT, LimitAction::TRUNCATE, LimitAction::STREAM})
+    {
+        if (text == limitActionName(candidate))
+        {
+            action = candidate;
+            return true;
+        }
+    }
+    return false;
+}
+
+inline AdmissionControl::AdmissionControl()
+    : maxItems(std::numeric_limits<uint64_t>::max()),
+      maxWork(std::numeric_limits<uint64_t>::max()), action(LimitAction::REJECT) {}
+
+inline AdmissionControl::AdmissionControl(uint64_t itemLimit, uint64_t workLimit,
+                                          LimitAction overLimit)
+    : maxItems(itemLimit), maxWork(workLimit), action(overLimit) {}
+
+inline bool AdmissionControl::isUnlimited() const
+{
+    return maxItems == std::numeric_limits<uint64_t>::max() &&
+           maxWork == std::numeric_limits<uint64_t>::max();
+}
+
+/**
+ * @brief Compares the estimate with both limits and applies the action to
+ *        whichever is exceeded (the output limit is reported first).
+ */
+inline AdmissionControl::Decision AdmissionControl::admit(const QueryCost &cost) const
+{
+    const uint64_t all = std::numeric_limits<uint64_t>::max();
+    bool overItems = cost.items > maxItems;
+    bool overWork = cost.work > maxWork;
+    if (!overItems && !overWork)
+    {
+        return Decision{true, all, false, ""};
+    }
+
+    std::string reason = overItems ? "output of " + cost.description +
+                                         " is over the limit of " + std::to_string(maxItems) + " items"
+                                   : "work of " + formatCount(cost.work) +
+                                         " steps is over the limit of " + std::to_string(maxWork);
+    if (action == LimitAction::STREAM)
+    {
+        return Decision{true, all, true, reason + "; streamed without buffering"};
+    }
+    if (action == LimitAction::TRUNCATE)
+    {
+        // Lazy results stop as soon as the last kept item is out, so the work
+        // shrinks in proportion to the items produced
+        uint64_t kept = std::min(cost.items, maxItems);
+        if (overWork)
+        {
+            long double affordable = static_cast<long double>(cost.items) * maxWork / cost.work;
+            kept = std::min(kept, static_cast<uint64_t>(affordable));
+        }
+        if (kept != 0 || cost.items == 0)
+        {
+            return Decision{true, kept, false,
+                            reason + "; truncated to the first " + std::to_string(kept) + " items"};
+        }
+        reason = "work of " + formatCount(cost.work) + " steps is over the limit of " +
+                 std::to_string(maxWork) + ", even for a single item";
+    }
+    return Decision{false, 0, false, "query rejected: " + reason};
+}
+
+inline void AdmissionControl::require(const QueryCost &cost) const
+{
+    if (cost.items > maxItems)
+    {
+        throw std::runtime_error("query rejected: output of " + cost.description +
+                                 " is over the limit of " + std::to_string(maxItems) + " items");
+    }
+    if (cost.work > maxWork)
+    {
+        throw std::runtime_error("query rejected: work of " + formatCount(cost.work) +
+                                 " steps is over the limit of " + std::to_string(maxWork));
+    }
+}
+
+#endif // COSTESTIMATOR_HXX
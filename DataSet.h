@@ -3,25 +3,41 @@
 // Author:      Alejandro Castro Martinez
 // Date:        2025-07-27
 // Description: Generic implementation of a mathematical set (DataSet<T>), storing
-//              unique elements using a dynamic array (std::vector).
+//              unique elements using a dynamic array (std::vector) or, for orderable
+//              element types, a B+-tree, or, for small integral types, a lock-free
+//              hash table that accepts concurrent inserts, or a frozen read-only
+//              Eytzinger array, or, for integral types, a list of runs of
+//              consecutive values or a bitmap (see SetRepresentation.h). An
+//              adaptive set picks among these by itself from its statistics.
 //
 //              Supported operations:
 //              ----------------------------------------------------------------------
-//              DataSet(const std::string& setName)
+//              DataSet(const std::string& setName) / DataSet(SetName setName)
 //                  Constructs a set with the given name.
 //
-//              std::string getName() const
-//                  Returns the name identifier of the set.
+//              std::string getName() const / const SetName& getSetName() const
+//                  Returns the name identifier of the set, rendered or as is.
 //
-//              void setName(const std::string& newName)
+//              void setName(const std::string& newName) / void setName(SetName newName)
 //                  Assigns a new name to the set.
 //
 //              void insert(const T& value)
 //                  Inserts a new element if it does not already exist in the set.
+//                  Thread-safe when the set uses the HASH representation.
+//
+//              void insertMany(std::vector<T> values, TaskScheduler* scheduler)
+//                  Inserts a batch; an empty set is built by one sort and dedupe.
+//
+//              void insertRange(const T& lo, const T& hi)
+//                  Inserts every value of [lo, hi] (integral T); a single run
+//                  when the set uses the INTERVAL representation.
 //
 //              bool contains(const T& value) const
 //                  Checks whether a given value exists in the set.
 //
+//              void containsMany(std::span<const T> keys, std::vector<bool>& out) const
+//                  Checks many values at once, overlapping their memory accesses.
+//
 //              DataSet<T> unionWith(const DataSet<T>& other) const
 //                  Returns a new set containing elements from both sets (no duplicates).
 //
@@ -31,6 +47,12 @@
 //              DataSet<T> differenceWith(const DataSet<T>& other) const
 //                  Returns a new set with elements from this set that are not in the other.
 //
+//              intersectionWith / differenceWith(other, TaskScheduler& scheduler)
+//                  Same results, probing large operands on all scheduler threads.
+//
+//              unionWith / symmetricDifferenceWith(other, TaskScheduler& scheduler)
+//                  Same results, combining the partitions of huge operands in parallel.
+//
 //              DataSet<T> symmetricDifferenceWith(const DataSet<T>& other) const
 //                  Returns a new set with elements in either set, but not in both.
 //
@@ -43,23 +65,114 @@
 //              size_t size() const
 //                  Returns the number of elements in the set.
 //
+//              size_t memoryUsage() const
+//                  Estimates the bytes the set occupies in memory.
+//
 //              std::vector<T> getElements() const
 //                  Returns a copy of the internal vector containing all elements.
 //
+//              Generator<T> values() const
+//                  Yields the elements lazily, in the order getElements() returns them.
+//
 //              void print(std::ostream& os = std::cout) const
 //                  Prints the contents of the set to the given output stream.
-//              DataSet<DataSet<T>> powerSet() const
-//                  Returns all subsets of the current set.
+//
+//              SetRepresentation getRepresentation() const
+//                  Returns the storage layout currently used by the set.
+//
+//              void useRepresentation(SetRepresentation rep)
+//                  Converts the set to another storage layout.
+//
+//              void freeze()
+//                  Converts the set to the read-only FROZEN layout for fast lookups.
+//
+//              size_t countRuns() const
+//                  Returns the number of runs of consecutive values (INTERVAL cost).
+//
+//              void setAdaptive(bool enable) / bool isAdaptive() const
+//                  Enables self-tuning: the set periodically re-plans its layout.
+//
+//              void adapt()
+//                  Switches to the representation the cost model picks right now.
+//
+//              void clearWorkload()
+//                  Forgets the insert/lookup counts the cost model looks at.
+//
+//              Stats getStats() const
+//                  Returns size, span, run count, workload mix and layout.
+//
+//              SetStatistics<T> statistics() const
+//                  Returns the catalog entry: count, range, content hash, sketch
+//                  and histogram, maintained on insert (see SetStatistics.h).
+//
+//              int64_t sum() const / T minimum() const / T maximum() const
+//              double mean() const / T quantile(double q) const
+//                  Aggregates (integral T), answered from the storage of each
+//                  representation: SIMD scans over contiguous keys, run and
+//                  popcount arithmetic for INTERVAL and BITSET, rank selection
+//                  for the ordered layouts.
+//
+//              DataSet<T> where(Comparison op, const T& key) const
+//              DataSet<T> whereModulo(const T& modulus, Comparison op, const T& remainder) const
+//                  Elements satisfying a predicate, selected by SIMD kernels over
+//                  the storage (INTERVAL sets clip their runs instead).
+//
+//              DataSet<T> mapAffine(const T& factor, const T& addend) const
+//                  Returns { x * factor + addend } (integral T). The map is
+//                  monotonic, so ordered layouts are rebuilt without sorting.
+//
+//              std::vector<DataSet<T>> partitionBy(size_t buckets, Classify bucketOf,
+//                                                  TaskScheduler* scheduler) const
+//              partitionByModulo(modulus, scheduler) / partitionByRanges(ranges, scheduler)
+//                  Splits the set into many buckets in one classifying pass
+//                  (a parallel histogram, then a scatter).
+//
+//              PowerSet<T> powerSet() const
+//                  Returns all subsets of the current set in compact form: each
+//                  subset is a bitmask over the set's elements (see PowerSet.h).
 //
 //              DataSet<std::pair<T, T>> cartesianProductWith(const DataSet<T>& other) const
 //                  Returns the Cartesian product A × B as a set of (a, b) pairs.
+//
+//              Generator<std::pair<T, T>> pairsWith(const DataSet<T>& other) const
+//                  Enumerates the Cartesian product lazily.
+//
+//              void appendSnapshot(std::string& out) const
+//              static DataSet<T> readSnapshot(const char*& cursor, const char* end)
+//                  Write and read back a binary image of the set (see SnapshotCache.h).
 // ===================================================================================
 
 #ifndef DATASET_H
 #define DATASET_H
 
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
 #include <vector>
 #include <iostream>
+#include <span>
+#include <string>
+#include "SetName.h"
+#include "SetRepresentation.h"
+#include "SetStatistics.h"
+#include "BPlusTree.h"
+#include "ConcurrentHashSet.h"
+#include "EytzingerArray.h"
+#include "IntervalSet.h"
+#include "BitsetSet.h"
+#include "SimdKernels.h"
+#include "Generator.h"
+#include "TaskScheduler.h"
+
+template <typename T>
+class CompactSubset;
+
+template <typename T>
+class PowerSet;
+
+template <typename T>
+class PairColumnSet;
 
 /**
  * @class DataSet
@@ -72,10 +185,357 @@ template <typename T>
 class DataSet
 {
 private:
-    std::vector<T> elements; ///< Internal container for storing unique elements.
-    std::string name;        ///< Identifier name for this set.
+    // Subsets and pair sets fill the storage of elements known to be distinct directly
+    template <typename U>
+    friend class CompactSubset;
+    template <typename U>
+    friend class PairColumnSet;
+
+    /**
+     * @brief Counter that concurrent readers or HASH inserters may bump (relaxed
+     *        atomic). Copying a set copies the current value.
+     */
+    struct RelaxedCounter
+    {
+        std::atomic<size_t> value;
+
+        RelaxedCounter(size_t initial = 0) : value(initial) {}
+        RelaxedCounter(const RelaxedCounter &other) : value(other.value.load(std::memory_order_relaxed)) {}
+        RelaxedCounter &operator=(const RelaxedCounter &other)
+        {
+            value.store(other.value.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            return *this;
+        }
+        void add(size_t n) { value.fetch_add(n, std::memory_order_relaxed); }
+        operator size_t() const { return value.load(std::memory_order_relaxed); }
+    };
+
+    /**
+     * @brief Bytes print() produced for one version of the set. The text is
+     *        shared and immutable, so a print only holds the mutex while it
+     *        takes or replaces the pointer; copying a set shares the text.
+     */
+    struct PrintCache
+    {
+        mutable std::mutex mutex;
+        std::shared_ptr<const std::string> text; ///< nullptr until the first print.
+        size_t version = 0;                      ///< Set version the text belongs to.
+
+        PrintCache() = default;
+        PrintCache(const PrintCache &other)
+        {
+            std::lock_guard<std::mutex> lock(other.mutex);
+            text = other.text;
+            version = other.version;
+        }
+        PrintCache &operator=(const PrintCache &other)
+        {
+            if (this != &other)
+            {
+                std::scoped_lock lock(mutex, other.mutex);
+                text = other.text;
+                version = other.version;
+            }
+            return *this;
+        }
+    };
+
+    /**
+     * @brief The set's SetStatistics and the version they describe. The block
+     *        is allocated by the first statistics() call, so sets nobody plans
+     *        with do not carry it. insert() keeps it current while it is; any
+     *        other change leaves it stale until statistics() rebuilds it. The
+     *        mutex serializes those rebuilds between concurrent readers.
+     */
+    struct StatisticsCache
+    {
+        mutable std::mutex mutex;
+        std::unique_ptr<SetStatistics<T>> block; ///< Statistics at `version` (nullptr: none yet).
+        size_t version = 0;                      ///< Set version the block belongs to.
+
+        StatisticsCache() = default;
+        StatisticsCache(const StatisticsCache &other)
+        {
+            std::lock_guard<std::mutex> lock(other.mutex);
+            block = other.block ? std::make_unique<SetStatistics<T>>(*other.block) : nullptr;
+            version = other.version;
+        }
+        StatisticsCache &operator=(const StatisticsCache &other)
+        {
+            if (this != &other)
+            {
+                std::scoped_lock lock(mutex, other.mutex);
+                block = other.block ? std::make_unique<SetStatistics<T>>(*other.block) : nullptr;
+                version = other.version;
+            }
+            return *this;
+        }
+
+        /**
+         * @brief True if the block exists and describes the given set version.
+         */
+        bool describes(size_t setVersion) const
+        {
+            return block && version == setVersion;
+        }
+    };
+
+    SetName name;                     ///< Identifier name for this set (lazy for results).
+    SetRepresentation representation; ///< Storage layout currently in use.
+    std::vector<T> elements;          ///< Unique elements (VECTOR representation).
+    BPlusTree<T> tree;                ///< Unique elements (TREE representation).
+    ConcurrentHashSet<T> hashTable;   ///< Unique elements (HASH representation).
+    EytzingerArray<T> frozenLayout;   ///< Unique elements (FROZEN representation).
+    IntervalSet<T> intervals;         ///< Unique elements (INTERVAL representation).
+    BitsetSet<T> bitmap;              ///< Unique elements (BITSET representation).
+    bool adaptive;                    ///< Whether the set re-plans its own layout.
+    RelaxedCounter mutations;         ///< Inserts since the last adapt() (adaptive only).
+    mutable RelaxedCounter queries;   ///< Lookups since the last adapt() (adaptive only).
+    size_t insertsUntilAdapt;         ///< Inserts left before the next automatic adapt() (not HASH).
+    RelaxedCounter version;           ///< Bumped by every change to name or contents.
+    mutable PrintCache printCache;    ///< Output of the last print() (see print).
+    mutable StatisticsCache catalog;  ///< Statistics block (see statistics).
+
+    /// Elements gathered per containsMany() call by the set operations.
+    static constexpr size_t PROBE_BATCH = 256;
+
+    /// Minimum size of the iterated set before set operations probe in batches.
+    static constexpr size_t BATCH_PROBE_MIN = 1024;
+
+    /// Minimum number of inserts between two automatic adapt() calls; the
+    /// interval then grows with the set so that re-planning stays amortized O(1).
+    static constexpr size_t ADAPT_MIN_INSERTS = 64;
+
+    /// Sets smaller than this stay VECTOR: a SIMD scan beats any index.
+    static constexpr size_t SMALL_SET_SIZE = 64;
+
+    /// Bits of span per element up to which BITSET is chosen (VECTOR<int> costs 32).
+    static constexpr size_t BITSET_MAX_SPAN_RATIO = 16;
+
+    /// Lookups per insert from which a set counts as read-mostly.
+    static constexpr size_t READ_MOSTLY_RATIO = 8;
+
+    /// Size ratio up to which two ordered operands are merged instead of probed.
+    static constexpr size_t MERGE_MAX_SIZE_RATIO = 16;
+
+    /// Minimum number of probed elements before a set operation uses the scheduler.
+    static constexpr size_t PARALLEL_PROBE_MIN = 32768;
+
+    /// Elements probed per parallel task (a multiple of PROBE_BATCH).
+    static constexpr size_t PARALLEL_PROBE_GRAIN = 8192;
+
+    /// Elements from which partitionBy() counts and scatters chunks in parallel.
+    static constexpr size_t PARALLEL_PARTITION_MIN = 1 << 18;
+
+    /// Bytes of the smaller operand from which a union or difference of operands
+    /// of comparable size runs by radix partitioning instead of probing (see RadixPartition.h).
+    static constexpr size_t PARTITIONED_MIN_BYTES = 16 * 1024 * 1024;
+
+    /// Elements copied per block when a layout without contiguous keys is fed
+    /// to a SIMD kernel (16 KiB of int: the block stays in the L1 cache).
+    static constexpr size_t SCAN_BLOCK = 4096;
+
+    /**
+     * @brief Calls fn(element) for every element of the current representation.
+     *        VECTOR visits insertion order, HASH table order, and the ordered
+     *        representations (see isOrderedRepresentation) ascending order.
+     * @param fn Callable taking const T&.
+     */
+    template <typename Fn>
+    void forEachElement(Fn &&fn) const;
+
+    /**
+     * @brief Calls fn(data, count) on consecutive blocks of elements in the order
+     *        of forEachElement(): VECTOR keys and TREE leaves in place, other
+     *        layouts copied through a buffer of SCAN_BLOCK elements.
+     * @param fn Callable taking (const T*, size_t).
+     */
+    template <typename Fn>
+    void forEachBlock(Fn &&fn) const;
+
+    /**
+     * @brief Builds the set of the elements a predicate kernel selects, in this
+     *        set's order and derived layout.
+     * @param kernel Callable (const T* data, size_t count, uint64_t* bits) that
+     *        sets bit i of a zeroed bitmap for every kept data[i] and returns
+     *        the number of bits set (like simdCompare).
+     */
+    template <typename Kernel>
+    DataSet<T> selectWhere(Kernel &&kernel) const;
+
+    /**
+     * @brief Returns an unnamed set holding `values` (strictly ascending if the
+     *        target is ordered) in `target`, or in TREE where a bitmap would be
+     *        too sparse for them. The result is adaptive if this set is.
+     */
+    DataSet<T> derivedSet(std::vector<T> &values, SetRepresentation target) const;
+
+    /**
+     * @brief partitionByModulo for an INTERVAL set: every run is emitted as
+     *        strides straight into the buckets, without expanding the set first.
+     */
+    std::vector<DataSet<T>> partitionRunsByModulo(const T &modulus, TaskScheduler *scheduler) const;
+
+    /**
+     * @brief Looks a value up in the current representation (not counted as a query).
+     */
+    bool lookup(const T &value) const;
+
+    /**
+     * @brief Fills the empty storage of the current representation.
+     *        Ordered representations expect strictly ascending values.
+     */
+    void assignElements(std::vector<T> &values);
+
+    /**
+     * @brief Pre-sizes the storage for `count` elements before a result is
+     *        filled one insert at a time (HASH only; the others grow cheaply).
+     */
+    void reserve(size_t count);
+
+    /**
+     * @brief Counts an insert of an adaptive set and re-plans when one is due.
+     */
+    void noteInsert();
+
+    /**
+     * @brief Records an insert: a new value bumps the version and is added to
+     *        the statistics if they were current; a duplicate changes nothing.
+     * @param value The inserted value.
+     * @param added False if the value was already present.
+     */
+    void noteInserted(const T &value, bool added);
+
+    /**
+     * @brief Computes the run count and value span (integral T only).
+     */
+    void measureRuns(size_t &runs, size_t &span) const;
+
+    /**
+     * @brief Number of values between lo and hi inclusive, saturated to SIZE_MAX.
+     */
+    static size_t valueSpan(const T &lo, const T &hi);
+
+    /**
+     * @brief Largest bitmap span (in bits) still worth it for `count` elements.
+     */
+    static size_t maxBitsetSpan(size_t count);
+
+    /**
+     * @brief Representation for sets derived from this one: the same layout,
+     *        except that a FROZEN set produces TREE results (which accept inserts).
+     */
+    SetRepresentation derivedRepresentation() const;
+
+    /**
+     * @brief Calls visit(element, other.contains(element)) for every element of this
+     *        set until visit returns false. Large inputs are probed PROBE_BATCH
+     *        elements at a time through other.containsMany().
+     * @param other The set probed for membership.
+     * @param visit Callable taking (const T&, bool) and returning whether to continue.
+     */
+    template <typename Fn>
+    void probeEach(const DataSet<T> &other, Fn &&visit) const;
+
+    /**
+     * @brief Merges two TREE sets leaf by leaf into a sorted vector.
+     * @param other The other TREE operand.
+     * @param keepOnlyThis Keep elements found only in this set.
+     * @param keepBoth Keep elements found in both sets.
+     * @param keepOnlyOther Keep elements found only in the other set.
+     * @return Ascending elements selected by the flags.
+     */
+    std::vector<T> mergeTrees(const DataSet<T> &other, bool keepOnlyThis,
+                              bool keepBoth, bool keepOnlyOther) const;
+
+    /**
+     * @brief Merges two ascending sequences, keeping elements selected by the flags.
+     */
+    template <typename ItA, typename ItB>
+    static std::vector<T> mergeAscending(ItA itA, ItA endA, ItB itB, ItB endB,
+                                         bool keepOnlyThis, bool keepBoth, bool keepOnlyOther);
+
+    /**
+     * @brief Tells whether every element of one ascending sequence is in another,
+     *        stopping at the first one that is not.
+     */
+    template <typename ItA, typename EndA, typename ItB, typename EndB>
+    static bool includesAscending(ItA itA, EndA endA, ItB itB, EndB endB);
+
+    /**
+     * @brief Runs the specialised kernel for a binary operation when one applies
+     *        to this pair of representations: leaf merge (TREE), run sweep
+     *        (INTERVAL), word-wise logic (BITSET), a linear merge of two
+     *        ordered operands of comparable size, or radix partitioning of a
+     *        union or difference of two huge operands. Also marks result
+     *        adaptive if either operand is.
+     * @param other The other operand.
+     * @param keepOnlyThis Keep elements found only in this set.
+     * @param keepBoth Keep elements found in both sets.
+     * @param keepOnlyOther Keep elements found only in the other set.
+     * @param result Receives the selected elements when a kernel ran.
+     * @param scheduler Pool for the partitioned kernel (nullptr: sequential).
+     * @return False if the caller must fall back to probing.
+     */
+    bool combineWithKernel(const DataSet<T> &other, bool keepOnlyThis, bool keepBoth,
+                           bool keepOnlyOther, DataSet<T> &result,
+                           TaskScheduler *scheduler = nullptr) const;
+
+    /**
+     * @brief Fills the empty result with the elements of this set whose membership
+     *        in other equals keepFound, in this set's order. Chunks of elements are
+     *        probed through other.containsMany() on the scheduler's threads.
+     * @param other The set probed for membership.
+     * @param keepFound True for an intersection, false for a difference.
+     * @param target Representation of the result.
+     * @param scheduler Pool running the probes.
+     * @param result Empty set receiving the kept elements.
+     */
+    void filterParallel(const DataSet<T> &other, bool keepFound, SetRepresentation target,
+                        TaskScheduler &scheduler, DataSet<T> &result) const;
+
+    /**
+     * @brief The representation the cost model picks for the given statistics.
+     */
+    SetRepresentation chooseRepresentation(size_t size, size_t span, size_t runs) const;
+
+    /**
+     * @brief Throws std::runtime_error naming the set when it is empty.
+     */
+    void requireElements() const;
+
+    /**
+     * @brief Sum of the elements without overflow: 4-byte values through the
+     *        SIMD, run and popcount kernels, 8-byte values added in 128 bits.
+     *        Runs too long for 128 bits set `overflow` instead.
+     */
+    __int128 exactSum(bool &overflow) const;
+
+    /**
+     * @brief Returns the element of rank `rank` (0 = smallest): selected in the
+     *        ordered layouts, nth_element over a copy for VECTOR and HASH.
+     */
+    T elementOfRank(size_t rank) const;
 
 public:
+    /// Average run length from which a set of integers is best stored as INTERVAL.
+    static constexpr size_t INTERVAL_MIN_RUN_LENGTH = 8;
+
+    /**
+     * @brief Statistics the adaptive cost model decides on.
+     */
+    struct Stats
+    {
+        SetRepresentation representation; ///< Layout in use.
+        size_t size;                      ///< Number of elements.
+        size_t span;                      ///< max - min + 1 (integral T; 0 otherwise or if empty).
+        size_t runs;                      ///< Runs of consecutive values (integral T; else size).
+        size_t mutations;                 ///< Inserts since the last adapt().
+        size_t queries;                   ///< Lookups since the last adapt().
+        bool adaptive;                    ///< Whether self-tuning is enabled.
+        SetStatistics<T> statistics;      ///< The catalog entry (see statistics()).
+    };
+
     /**
      * @brief Constructs a set with a specific name.
      * @param setName The identifier for this set.
@@ -83,23 +543,66 @@ public:
     DataSet(const std::string &setName);
 
     /**
-     * @brief Returns the name of the set.
+     * @brief Constructs a set named by a possibly lazy name, such as the
+     *        expression naming the result of a set operation.
+     * @param setName The name; an expression is only rendered when read.
+     */
+    DataSet(SetName setName);
+
+    /**
+     * @brief Returns the name of the set, rendering it if it is an expression.
      * @return The name as a string.
      */
     std::string getName() const;
 
+    /**
+     * @brief Returns the name of the set without rendering it, so that it can
+     *        be streamed or used as an operand of another name.
+     */
+    const SetName &getSetName() const;
+
     /**
      * @brief Sets a new name for the set.
      * @param newName New identifier for the set.
      */
     void setName(const std::string &newName);
 
+    /**
+     * @brief Sets a new, possibly lazy, name for the set.
+     * @param newName New name; an expression is only rendered when read.
+     */
+    void setName(SetName newName);
+
     /**
      * @brief Inserts a value into the set only if it's not already present.
+     *        With the HASH representation several threads may insert concurrently.
+     *        Inserting into a FROZEN set converts it to TREE first.
      * @param value The element to insert.
      */
     void insert(const T &value);
 
+    /**
+     * @brief Inserts every value of the inclusive range [lo, hi] (integral T only).
+     *        An INTERVAL set stores the range as one run without expanding it;
+     *        other representations insert the values one by one.
+     * @param lo First value of the range.
+     * @param hi Last value of the range (inclusive).
+     * @throws std::runtime_error if T is not an integral type.
+     */
+    void insertRange(const T &lo, const T &hi);
+
+    /**
+     * @brief Inserts many values, with the same result as inserting them one by
+     *        one in order. Into an empty set the values are sorted once (radix
+     *        sort for integers, see RadixSort.h), deduplicated in place and
+     *        stored in bulk, instead of being searched for one at a time; a
+     *        VECTOR set keeps the first occurrences in input order. An adaptive
+     *        set re-plans its layout once, after the whole batch.
+     * @param values The values to insert (duplicates allowed).
+     * @param scheduler Pool the sort may use (nullptr: sequential).
+     */
+    void insertMany(std::vector<T> values, TaskScheduler *scheduler = nullptr);
+
     /**
      * @brief Checks if the set contains a specific value.
      * @param value The value to check.
@@ -107,6 +610,15 @@ public:
      */
     bool contains(const T &value) const;
 
+    /**
+     * @brief Checks many values at once; out[i] is set to contains(keys[i]).
+     *        TREE, HASH and FROZEN sets interleave the independent lookups
+     *        (group prefetching) so that their cache misses overlap.
+     * @param keys Values to look up.
+     * @param out Receives one flag per key.
+     */
+    void containsMany(std::span<const T> keys, std::vector<bool> &out) const;
+
     /**
      * @brief Returns the union of the current set with another.
      * @param other The set to unite with.
@@ -114,6 +626,16 @@ public:
      */
     DataSet<T> unionWith(const DataSet<T> &other) const;
 
+    /**
+     * @brief Parallel union: when both operands are large enough for radix
+     *        partitioning, the partition passes and partition pairs run on
+     *        the scheduler's threads. May run inside another scheduler task.
+     * @param other The set to unite with.
+     * @param scheduler Pool for the partitioned kernel.
+     * @return The same set unionWith(other) returns.
+     */
+    DataSet<T> unionWith(const DataSet<T> &other, TaskScheduler &scheduler) const;
+
     /**
      * @brief Returns the intersection of the current set with another.
      * @param other The set to intersect with.
@@ -121,6 +643,16 @@ public:
      */
     DataSet<T> intersectionWith(const DataSet<T> &other) const;
 
+    /**
+     * @brief Parallel intersection: when no merge kernel applies and the probed
+     *        set has at least PARALLEL_PROBE_MIN elements, its chunks are probed
+     *        on the scheduler's threads. May run inside another scheduler task.
+     * @param other The set to intersect with.
+     * @param scheduler Pool running the probes.
+     * @return The same set intersectionWith(other) returns.
+     */
+    DataSet<T> intersectionWith(const DataSet<T> &other, TaskScheduler &scheduler) const;
+
     /**
      * @brief Returns the difference between the current set and another.
      * @param other The set to subtract.
@@ -128,6 +660,14 @@ public:
      */
     DataSet<T> differenceWith(const DataSet<T> &other) const;
 
+    /**
+     * @brief Parallel difference (see the parallel intersectionWith).
+     * @param other The set to subtract.
+     * @param scheduler Pool running the probes.
+     * @return The same set differenceWith(other) returns.
+     */
+    DataSet<T> differenceWith(const DataSet<T> &other, TaskScheduler &scheduler) const;
+
     /**
      * @brief Returns the symmetric difference (elements in one set but not both).
      * @param other The other set to compare against.
@@ -135,6 +675,14 @@ public:
      */
     DataSet<T> symmetricDifferenceWith(const DataSet<T> &other) const;
 
+    /**
+     * @brief Parallel symmetric difference (see the parallel unionWith).
+     * @param other The other set to compare against.
+     * @param scheduler Pool for the partitioned kernel.
+     * @return The same set symmetricDifferenceWith(other) returns.
+     */
+    DataSet<T> symmetricDifferenceWith(const DataSet<T> &other, TaskScheduler &scheduler) const;
+
     /**
      * @brief Checks if the current set is a subset of another.
      * @param other The set to compare against.
@@ -155,23 +703,249 @@ public:
      */
     size_t size() const;
 
+    /**
+     * @brief Estimates the bytes the set occupies: the object itself, its name,
+     *        the cached print() text and the storage allocated by the current
+     *        representation. Memory owned by the elements themselves (e.g.
+     *        string buffers) is not counted.
+     * @return Approximate footprint in bytes.
+     */
+    size_t memoryUsage() const;
+
     /**
      * @brief Provides a copy of the set's elements.
      * @return A std::vector<T> containing all elements.
      */
     std::vector<T> getElements() const;
 
+    /**
+     * @brief Yields the elements lazily, in the order getElements() returns them,
+     *        straight from the current representation (runs and bitmaps are
+     *        expanded one value at a time). The set must outlive the generator
+     *        and must not change while it is in use.
+     * @return A generator over the elements.
+     */
+    Generator<T> values() const;
+
     /**
      * @brief Prints the contents of the set to the given output stream.
+     *        The formatted bytes are cached: printing an unchanged set again
+     *        (same name, no insert or layout change since) is a single write
+     *        of the cached buffer. Values are formatted with default stream flags.
      * @param os Output stream (defaults to std::cout).
      */
     void print(std::ostream &os = std::cout) const;
 
+    /**
+     * @brief Returns the storage layout currently used by the set.
+     * @return The active SetRepresentation.
+     */
+    SetRepresentation getRepresentation() const;
+
+    /**
+     * @brief Converts the set to another storage layout, keeping its elements.
+     *        Converting to TREE changes iteration order to ascending. A set too
+     *        sparse for BITSET (see maxBitsetSpan) is converted to TREE instead.
+     *        Must not run concurrently with any other operation on the set.
+     * @param rep Target representation.
+     * @throws std::runtime_error if T cannot use the requested representation.
+     */
+    void useRepresentation(SetRepresentation rep);
+
+    /**
+     * @brief Converts the set to the read-only FROZEN layout (orderable T only).
+     *        contains() then uses branchless prefetching search and isSubsetOf()
+     *        probes this set in batches.
+     */
+    void freeze();
+
+    /**
+     * @brief Returns the number of maximal runs of consecutive values (integral T).
+     *        This is the number of entries the INTERVAL representation needs;
+     *        for other element types every element counts as its own run.
+     * @return Number of runs.
+     */
+    size_t countRuns() const;
+
+    /**
+     * @brief Enables or disables self-tuning. An adaptive set counts its inserts
+     *        and lookups and, every max(ADAPT_MIN_INSERTS, size) inserts, calls
+     *        adapt(). Lookups may run concurrently, and so may inserts into a
+     *        HASH set, which count but wait for an explicit adapt() to re-plan.
+     * @param enable True to enable.
+     */
+    void setAdaptive(bool enable);
+
+    /**
+     * @brief Tells whether self-tuning is enabled.
+     */
+    bool isAdaptive() const;
+
+    /**
+     * @brief Switches to the representation the cost model picks for the current
+     *        statistics and restarts the workload counters:
+     *        fewer than SMALL_SET_SIZE elements -> VECTOR;
+     *        integers in long runs -> INTERVAL; dense integers -> BITSET;
+     *        read-mostly -> FROZEN; insert-heavy -> HASH; otherwise TREE.
+     */
+    void adapt();
+
+    /**
+     * @brief Resets the insert and lookup counters, e.g. when a loading phase ends.
+     */
+    void clearWorkload();
+
+    /**
+     * @brief Returns the statistics the cost model looks at.
+     *        Computing span and runs takes O(n log n) unless the set is
+     *        ordered; the statistics block comes with it (see statistics()).
+     * @return A Stats snapshot.
+     */
+    Stats getStats() const;
+
+    /**
+     * @brief Returns the set's statistics block. Inserts keep it current, so
+     *        this is O(1) for a set built by insert(). After a change insert()
+     *        cannot account for (set operation results, ranges stored as runs,
+     *        HASH inserts, which may come from several threads at once) the
+     *        next call rebuilds it with one pass over the elements. The
+     *        histogram is rebuilt, from the elements in order, whenever the
+     *        count drifted (see SetStatistics<T>::needsHistogram).
+     *        Safe to call from several readers at once.
+     * @return A copy of the statistics.
+     */
+    SetStatistics<T> statistics() const;
+
+    /**
+     * @brief Returns the sum of the elements (integral T). 4-byte values are
+     *        widened, so their sum is exact: VECTOR, FROZEN and TREE keys are
+     *        summed with SIMD over their contiguous arrays (TREE leaf by leaf);
+     *        INTERVAL sums arithmetic series per run and BITSET popcounts per
+     *        word, without expanding a single element. 8-byte values are added
+     *        in 128 bits (INTERVAL still per run).
+     * @return The sum (0 for an empty set).
+     * @throws std::runtime_error if the sum does not fit in int64_t.
+     */
+    int64_t sum() const;
+
+    /**
+     * @brief Returns the smallest element (integral T): O(1) or O(log n) in the
+     *        ordered layouts, one SIMD min/max pass over a VECTOR.
+     * @throws std::runtime_error if the set is empty.
+     */
+    T minimum() const;
+
+    /**
+     * @brief Returns the largest element (integral T), like minimum().
+     * @throws std::runtime_error if the set is empty.
+     */
+    T maximum() const;
+
+    /**
+     * @brief Returns the arithmetic mean, computed from the exact sum, so it
+     *        is defined even when sum() would overflow.
+     * @throws std::runtime_error if the set is empty.
+     */
+    double mean() const;
+
+    /**
+     * @brief Returns the lower q-quantile: the element of rank floor(q * (n - 1))
+     *        in ascending order, so 0 is the minimum, 1 the maximum and 0.5 the
+     *        lower median. Ordered layouts select the rank in place (FROZEN in
+     *        O(log² n), BITSET and INTERVAL from popcounts and run lengths,
+     *        TREE leaf by leaf in O(n / LEAF_CAPACITY), since its nodes keep no
+     *        subtree counts); VECTOR and HASH run nth_element over a copy.
+     * @param q Fraction in [0, 1].
+     * @throws std::runtime_error if the set is empty or q is outside [0, 1].
+     */
+    T quantile(double q) const;
+
+    /**
+     * @brief Returns the elements x with x op key (an unnamed set in this set's
+     *        order and layout, TREE for a FROZEN set). The keys are compared by
+     *        simdCompare over the storage: VECTOR keys and TREE leaves in place,
+     *        other layouts block by block. INTERVAL sets clip every run to the
+     *        accepted range instead, so no element is expanded.
+     * @param op Comparison between each element and the key.
+     * @param key Right-hand side of the comparison.
+     */
+    DataSet<T> where(Comparison op, const T &key) const;
+
+    /**
+     * @brief Returns the elements x with (x mod modulus) op remainder (integral T),
+     *        like where() but through simdCompareModulo. Remainders are floored:
+     *        they lie in [0, modulus) for negative elements too.
+     * @param modulus Divisor.
+     * @param op Comparison between each remainder and `remainder`.
+     * @param remainder Right-hand side of the comparison.
+     * @throws std::runtime_error if modulus is not positive.
+     */
+    DataSet<T> whereModulo(const T &modulus, Comparison op, const T &remainder) const;
+
+    /**
+     * @brief Returns { x * factor + addend | x in this set } (integral T) as an
+     *        unnamed set, computed by simdAffine over the storage. A nonzero
+     *        factor is injective and monotonic, so no duplicate can appear and
+     *        an ordered layout stays sorted (reversed once for a negative
+     *        factor); INTERVAL sets shifted or mirrored (factor ±1) map their
+     *        runs. Other strides spread runs out, so those results use TREE.
+     * @param factor Multiplier.
+     * @param addend Value added after the multiplication.
+     * @throws std::runtime_error if the image of some element does not fit in T.
+     */
+    DataSet<T> mapAffine(const T &factor, const T &addend) const;
+
+    /// Most buckets a partition may have (every bucket becomes a set).
+    static constexpr size_t PARTITION_MAX_BUCKETS = 65536;
+
+    /**
+     * @brief Splits the set into buckets in a single classifying pass: every
+     *        element is classified once while per-chunk histograms are counted,
+     *        a prefix sum gives each chunk its output range per bucket, and the
+     *        chunks scatter their elements concurrently (stable, like radixSort).
+     *        Elements are neither sorted nor deduplicated again: every bucket
+     *        keeps this set's order and derived layout.
+     * @param buckets Number of buckets (at most PARTITION_MAX_BUCKETS).
+     * @param bucketOf Callable mapping an element to its bucket in [0, buckets),
+     *        or to `buckets` to leave it out.
+     * @param scheduler Pool for the passes and for building the buckets
+     *        (nullptr: sequential).
+     * @return One unnamed set per bucket.
+     * @throws std::runtime_error if there are too many buckets.
+     */
+    template <typename Classify>
+    std::vector<DataSet<T>> partitionBy(size_t buckets, Classify &&bucketOf,
+                                        TaskScheduler *scheduler = nullptr) const;
+
+    /**
+     * @brief Splits the set by floored remainder: bucket r holds the elements x
+     *        with x mod modulus == r (integral T). INTERVAL sets emit every
+     *        run as one stride per residue it reaches, straight into the
+     *        buckets (BITSET, or TREE when too sparse); a modulus of 1 copies the runs.
+     * @throws std::runtime_error if modulus is not positive or exceeds
+     *         PARTITION_MAX_BUCKETS.
+     */
+    std::vector<DataSet<T>> partitionByModulo(const T &modulus, TaskScheduler *scheduler = nullptr) const;
+
+    /**
+     * @brief Splits the set by value ranges: bucket i holds the elements in
+     *        [ranges[i].first, ranges[i].second]; elements outside every range
+     *        are left out (integral T). Elements are classified by binary search
+     *        over the ranges; INTERVAL sets clip their runs to every range instead.
+     * @throws std::runtime_error if a range is empty, two ranges overlap, or
+     *         there are more than PARTITION_MAX_BUCKETS.
+     */
+    std::vector<DataSet<T>> partitionByRanges(const std::vector<std::pair<T, T>> &ranges,
+                                              TaskScheduler *scheduler = nullptr) const;
+
     /**
      * @brief Returns the power set (set of all subsets) of the current set.
-     * @return A DataSet<DataSet<T>> containing all subsets.
+     *        Only the elements are copied, once; its 2^n subsets are
+     *        CompactSubset bitmasks produced on demand (PowerSet<T>::subsets()).
+     * @return The power set of the current set.
+     * @throws std::runtime_error if the set has more than PowerSet<T>::MAX_ELEMENTS elements.
      */
-    DataSet<DataSet<T>> powerSet() const;
+    PowerSet<T> powerSet() const;
 
     /**
      * @brief Returns the Cartesian product of this set with another.
@@ -179,6 +953,36 @@ public:
      * @return A DataSet<std::pair<T, T>> representing the Cartesian product.
      */
     DataSet<std::pair<T, T>> cartesianProductWith(const DataSet<T> &other) const;
+
+    /**
+     * @brief Enumerates the Cartesian product lazily: (a, b) for every a of this
+     *        set and every b of other, in values() order. Both sets must outlive
+     *        the generator.
+     * @param other The right-hand set.
+     * @return A generator of pairs.
+     */
+    Generator<std::pair<T, T>> pairsWith(const DataSet<T> &other) const;
+
+    /**
+     * @brief Appends a binary image of the set to out: name, representation and
+     *        elements in getElements() order (an INTERVAL set stores its runs).
+     *        Values are copied byte for byte, so an image is only readable by a
+     *        build of the same program on the same platform.
+     * @param out Buffer the image is appended to.
+     * @throws std::runtime_error if T is not trivially copyable.
+     */
+    void appendSnapshot(std::string &out) const;
+
+    /**
+     * @brief Rebuilds a set from an image written by appendSnapshot(). The
+     *        storage is filled in bulk; no element is inserted one by one.
+     *        The result is not adaptive.
+     * @param cursor Start of the image; moved past it on success.
+     * @param end End of the readable bytes.
+     * @return The restored set.
+     * @throws std::runtime_error if the image is truncated or malformed.
+     */
+    static DataSet<T> readSnapshot(const char *&cursor, const char *end);
 };
 
 /**
@@ -3,7 +3,10 @@
 // Author:      Alejandro Castro Martinez
 // Date:        2025-07-27
 // Description: Implementation of the templated class DataSet<T>.
-//              Only unique elements are stored internally using std::vector.
+//              Only unique elements are stored internally, in a std::vector, a
+//              BPlusTree<T>, a ConcurrentHashSet<T>, an EytzingerArray<T>, an
+//              IntervalSet<T> or a BitsetSet<T> depending on the active
+//              representation.
 // ===================================================================================
 // Group 4 | Joel Felipe Martinez | Xamuel Perez | Rafael Held
 
@@ -11,7 +14,17 @@
 #define DATASET_HXX
 
 #include "DataSet.h"
-#include <algorithm> // For std::find
+#include "PowerSet.h"
+#include "RadixPartition.h"
+#include "RadixSort.h"
+#include <algorithm> // For std::find, std::lower_bound, std::nth_element, std::reverse
+#include <bit>       // For std::countr_zero
+#include <cstdint>   // For SIZE_MAX
+#include <cstring>   // For std::memcpy
+#include <limits>    // For std::numeric_limits
+#include <sstream>   // For std::ostringstream
+#include <stdexcept> // For std::runtime_error
+#include <type_traits>
 
 /**
  * @brief Constructs a set with a specific name.
@@ -19,14 +32,35 @@
  */
 template <typename T>
 DataSet<T>::DataSet(const std::string &setName)
-    : name(setName), elements() {}
+    : name(setName), representation(SetRepresentation::VECTOR), elements(), tree(), hashTable(), frozenLayout(), intervals(),
+      bitmap(), adaptive(false), mutations(0), queries(0), insertsUntilAdapt(ADAPT_MIN_INSERTS), version(0),
+      printCache(), catalog() {}
 
 /**
- * @brief Returns the name of the set.
+ * @brief Constructs a set named by a possibly lazy name.
+ * @param setName The name.
+ */
+template <typename T>
+DataSet<T>::DataSet(SetName setName)
+    : name(std::move(setName)), representation(SetRepresentation::VECTOR), elements(), tree(), hashTable(), frozenLayout(), intervals(),
+      bitmap(), adaptive(false), mutations(0), queries(0), insertsUntilAdapt(ADAPT_MIN_INSERTS), version(0),
+      printCache(), catalog() {}
+
+/**
+ * @brief Returns the name of the set, rendering it if it is an expression.
  * @return The name as a string.
  */
 template <typename T>
 std::string DataSet<T>::getName() const
+{
+    return name.str();
+}
+
+/**
+ * @brief Returns the name of the set as stored, without rendering it.
+ */
+template <typename T>
+const SetName &DataSet<T>::getSetName() const
 {
     return name;
 }
@@ -38,26 +72,185 @@ std::string DataSet<T>::getName() const
 template <typename T>
 void DataSet<T>::setName(const std::string &newName)
 {
-    name = newName;
+    setName(SetName(newName));
+}
+
+/**
+ * @brief Sets a new, possibly lazy, name for the set.
+ * @param newName New name for the set.
+ */
+template <typename T>
+void DataSet<T>::setName(SetName newName)
+{
+    bool statisticsCurrent = catalog.describes(version);
+    name = std::move(newName);
+    version.add(1);
+    if (statisticsCurrent)
+    {
+        catalog.version = version; // The contents did not change
+    }
 }
 
 /**
  * @brief Inserts a value into the set only if it's not already present.
+ *        With the HASH representation several threads may insert concurrently.
+ *        Inserting into a FROZEN set converts it to TREE first.
  * @param value The element to insert.
  */
 template <typename T>
 void DataSet<T>::insert(const T &value)
 {
-    if (!this->contains(value))
+    if (adaptive)
+    {
+        this->noteInsert();
+    }
+    if (representation == SetRepresentation::FROZEN)
+    {
+        this->useRepresentation(SetRepresentation::TREE);
+    }
+    if (representation == SetRepresentation::BITSET)
+    {
+        if constexpr (BitsetSet<T>::SUPPORTED)
+        {
+            if (bitmap.spanWith(value) <= maxBitsetSpan(bitmap.size() + 1))
+            {
+                this->noteInserted(value, bitmap.insert(value));
+                return;
+            }
+        }
+        // The bitmap would turn sparse: move to the sorted layout instead
+        this->useRepresentation(SetRepresentation::TREE);
+    }
+    if (representation == SetRepresentation::TREE)
+    {
+        if constexpr (IsOrderable<T>::value)
+        {
+            this->noteInserted(value, tree.insert(value));
+        }
+        return;
+    }
+    if (representation == SetRepresentation::HASH)
+    {
+        if constexpr (ConcurrentHashSet<T>::SUPPORTED)
+        {
+            if (hashTable.insert(value))
+            {
+                version.add(1); // Concurrent: statistics are rebuilt on demand
+            }
+        }
+        return;
+    }
+    if (representation == SetRepresentation::INTERVAL)
+    {
+        if constexpr (IntervalSet<T>::SUPPORTED)
+        {
+            this->noteInserted(value, intervals.insert(value));
+        }
+        return;
+    }
+    bool added = !this->lookup(value);
+    if (added)
     {
         this->elements.push_back(value);
     }
-    // TODO #02: Implementar la función insert
-    // Esta función debe insertar un nuevo valor en el conjunto solo si dicho valor
-    // aún no se encuentra presente. Para ello, debe invocar la función contains()
-    // previamente implementada. Si el valor no está presente, se debe agregar al conjunto
-    // No se permite insertar elementos duplicados bajo ninguna circunstancia.
-    // La función debe mantener la semántica de conjunto: todos los elementos únicos.
+    this->noteInserted(value, added);
+}
+
+/**
+ * @brief Inserts every value of the inclusive range [lo, hi] (integral T only).
+ *        An INTERVAL set stores the range as one run without expanding it;
+ *        other representations insert the values one by one.
+ * @param lo First value of the range.
+ * @param hi Last value of the range (inclusive).
+ * @throws std::runtime_error if T is not an integral type.
+ */
+template <typename T>
+void DataSet<T>::insertRange(const T &lo, const T &hi)
+{
+    if constexpr (IntervalSet<T>::SUPPORTED)
+    {
+        if (representation == SetRepresentation::INTERVAL)
+        {
+            version.add(1);
+            intervals.insertRange(lo, hi);
+            return;
+        }
+        for (T value = lo; !(hi < value); ++value)
+        {
+            this->insert(value);
+            if (value == hi)
+            {
+                break; // Avoid overflowing past the largest value of T
+            }
+        }
+    }
+    else
+    {
+        throw std::runtime_error("Set '" + name.str() + "' cannot store ranges of a non-integral type.");
+    }
+}
+
+/**
+ * @brief Inserts many values. An empty set of orderable T is built in bulk:
+ *        sorted and deduplicated once, then handed to the storage of the
+ *        current representation like useRepresentation() does.
+ * @param values The values to insert.
+ * @param scheduler Pool the sort may use.
+ */
+template <typename T>
+void DataSet<T>::insertMany(std::vector<T> values, TaskScheduler *scheduler)
+{
+    if constexpr (IsOrderable<T>::value)
+    {
+        if (this->size() == 0 && !values.empty())
+        {
+            std::vector<T> unique = values;
+            sortUnique(unique, scheduler);
+            if (representation == SetRepresentation::VECTOR && unique.size() != values.size())
+            {
+                // Keep the first occurrence of every value, in input order
+                std::vector<bool> taken(unique.size(), false);
+                size_t kept = 0;
+                for (const T &value : values)
+                {
+                    size_t rank = std::lower_bound(unique.begin(), unique.end(), value) - unique.begin();
+                    if (!taken[rank])
+                    {
+                        taken[rank] = true;
+                        values[kept++] = value;
+                    }
+                }
+                values.resize(kept);
+            }
+            if (representation != SetRepresentation::VECTOR)
+            {
+                values.swap(unique);
+            }
+            if (representation == SetRepresentation::FROZEN)
+            {
+                representation = SetRepresentation::TREE; // As insert() would
+            }
+            if constexpr (BitsetSet<T>::SUPPORTED)
+            {
+                if (representation == SetRepresentation::BITSET &&
+                    valueSpan(values.front(), values.back()) > maxBitsetSpan(values.size()))
+                {
+                    representation = SetRepresentation::TREE; // Too sparse for a bitmap
+                }
+            }
+            this->assignElements(values);
+            if (adaptive)
+            {
+                mutations.add(values.size());
+                this->adapt();
+            }
+            return;
+        }
+    }
+    for (const T &value : values)
+    {
+        this->insert(value);
+    }
 }
 
 /**
@@ -68,6 +261,59 @@ void DataSet<T>::insert(const T &value)
 template <typename T>
 bool DataSet<T>::contains(const T &value) const
 {
+    if (adaptive)
+    {
+        queries.add(1);
+    }
+    return this->lookup(value);
+}
+
+/**
+ * @brief Looks a value up in the current representation (not counted as a query).
+ */
+template <typename T>
+bool DataSet<T>::lookup(const T &value) const
+{
+    if (representation == SetRepresentation::TREE)
+    {
+        if constexpr (IsOrderable<T>::value)
+        {
+            return tree.contains(value);
+        }
+    }
+    if (representation == SetRepresentation::HASH)
+    {
+        if constexpr (ConcurrentHashSet<T>::SUPPORTED)
+        {
+            return hashTable.contains(value);
+        }
+    }
+    if (representation == SetRepresentation::FROZEN)
+    {
+        if constexpr (IsOrderable<T>::value)
+        {
+            return frozenLayout.contains(value);
+        }
+    }
+    if (representation == SetRepresentation::INTERVAL)
+    {
+        if constexpr (IntervalSet<T>::SUPPORTED)
+        {
+            return intervals.contains(value);
+        }
+    }
+    if (representation == SetRepresentation::BITSET)
+    {
+        if constexpr (BitsetSet<T>::SUPPORTED)
+        {
+            return bitmap.contains(value);
+        }
+    }
+    if constexpr (IsSimdScannable<T>::value)
+    {
+        // Integer keys: compare a full vector register of elements per instruction
+        return simdContains(this->elements.data(), this->elements.size(), value);
+    }
     typename std::vector<T>::const_iterator it = this->elements.begin();
     while (it != this->elements.end())
     {
@@ -78,12 +324,6 @@ bool DataSet<T>::contains(const T &value) const
         ++it;
     }
     return false;
-    // TODO #01: Implementar la función contains
-    // Esta función debe verificar si un elemento dado está presente en el conjunto actual.
-    // Para ello, debe recorrer la estructura lineal interna
-    // y determinar si existe un elemento que sea igual al valor recibido por parámetro.
-    // No se permite modificar la estructura ni usar contenedores auxiliares.
-    // El valor de retorno debe ser true si el elemento existe, false en caso contrario.
 }
 
 /**
@@ -94,30 +334,39 @@ bool DataSet<T>::contains(const T &value) const
 template <typename T>
 DataSet<T> DataSet<T>::unionWith(const DataSet<T> &other) const
 {
-    DataSet<T> result(this->getName() + " ∪ " + other.getName());
-    typename std::vector<T>::const_iterator itA = this->elements.begin();
-    while (itA != this->elements.end())
+    DataSet<T> result(SetName::combine(name, " ∪ ", other.name));
+    if (this->combineWithKernel(other, true, true, true, result))
     {
-        result.insert(*itA);
-        ++itA;
+        return result;
     }
+    result.useRepresentation(derivedRepresentation());
+    result.reserve(this->size() + other.size());
 
-    std::vector<T> elemsB = other.getElements();
-    typename std::vector<T>::const_iterator itB = elemsB.begin();
-    while (itB != elemsB.end())
-    {
-        result.insert(*itB);
-        ++itB;
-    }
+    this->forEachElement([&result](const T &val)
+                         { result.insert(val); });
+    other.forEachElement([&result](const T &val)
+                         { result.insert(val); });
 
     return result;
-    // TODO #03: Completar la implementación de la operación unión (unionWith)
-    // Esta función debe construir un nuevo conjunto que contenga todos los elementos
-    // del conjunto actual y todos los elementos del conjunto recibido por parámetro,
-    // sin duplicados. El resultado debe almacenarse en la variable `result` ya definida.
-    //
-    // No se deben modificar las estructuras internas originales.
-    // Se espera que el resultado represente correctamente A ∪ B.
+}
+
+/**
+ * @brief Parallel union: the partitioned kernel runs on the scheduler; any
+ *        other path is the sequential one.
+ * @param other The set to unite with.
+ * @param scheduler Pool for the partitioned kernel.
+ * @return The same set unionWith(other) returns.
+ */
+template <typename T>
+DataSet<T> DataSet<T>::unionWith(const DataSet<T> &other, TaskScheduler &scheduler) const
+{
+    DataSet<T> result(SetName::combine(name, " ∪ ", other.name));
+    if (scheduler.threadCount() > 1 &&
+        this->combineWithKernel(other, true, true, true, result, &scheduler))
+    {
+        return result;
+    }
+    return this->unionWith(other);
 }
 
 /**
@@ -128,25 +377,32 @@ DataSet<T> DataSet<T>::unionWith(const DataSet<T> &other) const
 template <typename T>
 DataSet<T> DataSet<T>::intersectionWith(const DataSet<T> &other) const
 {
-    DataSet<T> result(this->getName() + " ∩ " + other.getName());
-    typename std::vector<T>::const_iterator it = this->elements.begin();
-    while (it != this->elements.end())
+    DataSet<T> result(SetName::combine(name, " ∩ ", other.name));
+    if (this->combineWithKernel(other, false, true, false, result))
     {
-        const T &val = *it;
-        if (other.contains(val))
+        return result;
+    }
+    result.useRepresentation(derivedRepresentation());
+    result.reserve(std::min(this->size(), other.size()));
+
+    auto keepFound = [&result](const T &val, bool found)
+    {
+        if (found)
         {
             result.insert(val);
         }
-        ++it;
+        return true;
+    };
+    if (result.representation != SetRepresentation::VECTOR && other.size() < this->size())
+    {
+        // The result order does not depend on insertion order: probe with the smaller set
+        other.probeEach(*this, keepFound);
+    }
+    else
+    {
+        this->probeEach(other, keepFound);
     }
     return result;
-    // TODO #04: Implementar la operación intersección (intersectionWith)
-    // Esta función debe construir un nuevo conjunto que contenga únicamente los elementos
-    // que están presentes tanto en el conjunto actual como en el conjunto recibido.
-    //
-    // La variable `result` ya está declarada y lista para usar.
-    // No se deben modificar los conjuntos originales.
-    // El resultado debe representar correctamente A ∩ B.
 }
 
 /**
@@ -157,25 +413,142 @@ DataSet<T> DataSet<T>::intersectionWith(const DataSet<T> &other) const
 template <typename T>
 DataSet<T> DataSet<T>::differenceWith(const DataSet<T> &other) const
 {
-    DataSet<T> result(this->getName() + "-" + other.getName());
-    typename std::vector<T>::const_iterator it = this->elements.begin();
-    while (it != this->elements.end())
+    DataSet<T> result(SetName::combine(name, "-", other.name));
+    if (this->combineWithKernel(other, true, false, false, result))
     {
-        const T &val = *it;
-        if (!other.contains(val))
+        return result;
+    }
+    result.useRepresentation(derivedRepresentation());
+    result.reserve(this->size());
+
+    this->probeEach(other, [&result](const T &val, bool found)
+                    {
+        if (!found)
         {
             result.insert(val);
         }
-        ++it;
+        return true; });
+
+    return result;
+}
+
+/**
+ * @brief Parallel intersection: when no merge kernel applies and the probed
+ *        set has at least PARALLEL_PROBE_MIN elements, its chunks are probed
+ *        on the scheduler's threads. May run inside another scheduler task.
+ * @param other The set to intersect with.
+ * @param scheduler Pool running the probes.
+ * @return The same set intersectionWith(other) returns.
+ */
+template <typename T>
+DataSet<T> DataSet<T>::intersectionWith(const DataSet<T> &other, TaskScheduler &scheduler) const
+{
+    SetRepresentation target = derivedRepresentation();
+    // Same choice of probing side as the sequential version
+    bool probeOther = target != SetRepresentation::VECTOR && other.size() < this->size();
+    const DataSet<T> &probed = probeOther ? other : *this;
+    if (scheduler.threadCount() == 1 || probed.size() < PARALLEL_PROBE_MIN)
+    {
+        return this->intersectionWith(other);
+    }
+
+    DataSet<T> result(SetName::combine(name, " ∩ ", other.name));
+    if (this->combineWithKernel(other, false, true, false, result, &scheduler))
+    {
+        return result;
+    }
+    probed.filterParallel(probeOther ? *this : other, true, target, scheduler, result);
+    return result;
+}
+
+/**
+ * @brief Parallel difference (see the parallel intersectionWith).
+ * @param other The set to subtract.
+ * @param scheduler Pool running the probes.
+ * @return The same set differenceWith(other) returns.
+ */
+template <typename T>
+DataSet<T> DataSet<T>::differenceWith(const DataSet<T> &other, TaskScheduler &scheduler) const
+{
+    if (scheduler.threadCount() == 1 || this->size() < PARALLEL_PROBE_MIN)
+    {
+        return this->differenceWith(other);
     }
 
+    DataSet<T> result(SetName::combine(name, "-", other.name));
+    if (this->combineWithKernel(other, true, false, false, result, &scheduler))
+    {
+        return result;
+    }
+    this->filterParallel(other, false, derivedRepresentation(), scheduler, result);
     return result;
-    // TODO #05: Implementar la operación diferencia (differenceWith)
-    // Esta función debe construir un nuevo conjunto que contenga todos los elementos
-    // que están en el conjunto actual (`this`) pero que **no** están presentes en el conjunto `other`.
-    //
-    // La variable `result` ya está definida. No modifique los conjuntos originales.
-    // El resultado debe representar correctamente A − B.
+}
+
+/**
+ * @brief Fills the empty result with the elements of this set whose membership
+ *        in other equals keepFound, in this set's order. Chunks of elements are
+ *        probed through other.containsMany() on the scheduler's threads.
+ * @param other The set probed for membership.
+ * @param keepFound True for an intersection, false for a difference.
+ * @param target Representation of the result.
+ * @param scheduler Pool running the probes.
+ * @param result Empty set receiving the kept elements.
+ */
+template <typename T>
+void DataSet<T>::filterParallel(const DataSet<T> &other, bool keepFound, SetRepresentation target,
+                                TaskScheduler &scheduler, DataSet<T> &result) const
+{
+    std::vector<T> gathered;
+    std::span<const T> values(elements);
+    if (representation != SetRepresentation::VECTOR)
+    {
+        gathered.reserve(this->size());
+        this->forEachElement([&gathered](const T &val)
+                             { gathered.push_back(val); });
+        values = gathered;
+    }
+
+    // One byte per element: tasks never share a word the way std::vector<bool> would
+    std::vector<unsigned char> keep(values.size(), 0);
+    scheduler.parallelFor(0, values.size(), PARALLEL_PROBE_GRAIN, [&](size_t lo, size_t hi)
+                          {
+        std::vector<bool> found;
+        for (size_t i = lo; i < hi; i += PROBE_BATCH)
+        {
+            size_t n = std::min(PROBE_BATCH, hi - i);
+            other.containsMany(values.subspan(i, n), found);
+            for (size_t j = 0; j < n; ++j)
+            {
+                keep[i + j] = found[j] == keepFound;
+            }
+        } });
+
+    std::vector<T> selected;
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        if (keep[i])
+        {
+            selected.push_back(values[i]);
+        }
+    }
+
+    if constexpr (IsOrderable<T>::value)
+    {
+        if (isOrderedRepresentation(target) && !isOrderedRepresentation(representation))
+        {
+            sortValues(selected);
+        }
+    }
+    if constexpr (BitsetSet<T>::SUPPORTED)
+    {
+        if (target == SetRepresentation::BITSET && !selected.empty() &&
+            valueSpan(selected.front(), selected.back()) > maxBitsetSpan(selected.size()))
+        {
+            target = SetRepresentation::TREE;
+        }
+    }
+    result.useRepresentation(target);
+    result.assignElements(selected);
 }
 
 /**
@@ -186,36 +559,48 @@ DataSet<T> DataSet<T>::differenceWith(const DataSet<T> &other) const
 template <typename T>
 DataSet<T> DataSet<T>::symmetricDifferenceWith(const DataSet<T> &other) const
 {
-    DataSet<T> result(this->getName() + " symmetric_difference " + other.getName());
-    typename std::vector<T>::const_iterator itA = this->elements.begin();
-    while (itA != this->elements.end())
+    DataSet<T> result(SetName::combine(name, " symmetric_difference ", other.name));
+    if (this->combineWithKernel(other, true, false, true, result))
     {
-        const T &valA = *itA;
-        if (!other.contains(valA))
+        return result;
+    }
+    result.useRepresentation(derivedRepresentation());
+    result.reserve(this->size() + other.size());
+
+    this->probeEach(other, [&result](const T &valA, bool found)
+                    {
+        if (!found)
         {
             result.insert(valA);
         }
-        ++itA;
-    }
-    std::vector<T> elemsB = other.getElements();
-    typename std::vector<T>::const_iterator itB = elemsB.begin();
-    while (itB != elemsB.end())
-    {
-        const T &valB = *itB;
-        if (!this->contains(valB))
+        return true; });
+    other.probeEach(*this, [&result](const T &valB, bool found)
+                    {
+        if (!found)
         {
             result.insert(valB);
         }
-        ++itB;
-    }
+        return true; });
 
     return result;
-    // TODO #06: Implementar la operación diferencia simétrica (symmetricDifferenceWith)
-    // La diferencia simétrica entre dos conjuntos A y B se define como:
-    // (A − B) ∪ (B − A). El resultado debe contener los elementos que están en
-    // exactamente uno de los dos conjuntos, pero no en ambos.
-    //
-    // Resultado esperado: un nuevo DataSet<T> que represente A △ B.
+}
+
+/**
+ * @brief Parallel symmetric difference (see the parallel unionWith).
+ * @param other The other set to compare against.
+ * @param scheduler Pool for the partitioned kernel.
+ * @return The same set symmetricDifferenceWith(other) returns.
+ */
+template <typename T>
+DataSet<T> DataSet<T>::symmetricDifferenceWith(const DataSet<T> &other, TaskScheduler &scheduler) const
+{
+    DataSet<T> result(SetName::combine(name, " symmetric_difference ", other.name));
+    if (scheduler.threadCount() > 1 &&
+        this->combineWithKernel(other, true, false, true, result, &scheduler))
+    {
+        return result;
+    }
+    return this->symmetricDifferenceWith(other);
 }
 
 /**
@@ -226,25 +611,48 @@ DataSet<T> DataSet<T>::symmetricDifferenceWith(const DataSet<T> &other) const
 template <typename T>
 bool DataSet<T>::isSubsetOf(const DataSet<T> &other) const
 {
-    std::vector<T> elems = this->getElements();
-    typename std::vector<T>::const_iterator it = elems.begin();
-    while (it != elems.end())
+    if (this->size() > other.size())
     {
-        const T &val = *it;
-        if (!other.contains(val))
+        return false;
+    }
+    if constexpr (IntervalSet<T>::SUPPORTED)
+    {
+        if (representation == SetRepresentation::INTERVAL &&
+            other.representation == SetRepresentation::INTERVAL)
         {
-            return false;
+            return intervals.isSubsetOf(other.intervals);
+        }
+        if (representation == SetRepresentation::BITSET &&
+            other.representation == SetRepresentation::BITSET)
+        {
+            return bitmap.isSubsetOf(other.bitmap);
         }
-        ++it;
     }
-    return true;
-    // TODO #07: Implementar la verificación de subconjunto (isSubsetOf)
-    // Esta función debe determinar si el conjunto actual es subconjunto del conjunto `other`.
-    // Es decir, debe retornar true si todos los elementos del conjunto actual están presentes
-    // en el conjunto `other`. En caso contrario, debe retornar false.
-    //
-    // Esta operación no debe modificar ninguno de los conjuntos involucrados.
-    // El resultado debe respetar la definición formal de subconjunto: A ⊆ B.
+    if constexpr (IsOrderable<T>::value)
+    {
+        if (isOrderedRepresentation(representation) &&
+            isOrderedRepresentation(other.representation) &&
+            other.size() <= MERGE_MAX_SIZE_RATIO * this->size())
+        {
+            // Both ascending and of comparable size: walk them in step and stop
+            // at the first element other lacks (B+-trees along their leaf chains)
+            if (representation == SetRepresentation::TREE &&
+                other.representation == SetRepresentation::TREE)
+            {
+                return includesAscending(tree.begin(), tree.end(), other.tree.begin(), other.tree.end());
+            }
+            Generator<T> mine = this->values();
+            Generator<T> theirs = other.values();
+            return includesAscending(mine.begin(), mine.end(), theirs.begin(), theirs.end());
+        }
+    }
+
+    bool subset = true;
+    this->probeEach(other, [&subset](const T &, bool found)
+                    {
+        subset = found;
+        return subset; });
+    return subset;
 }
 
 /**
@@ -256,16 +664,6 @@ template <typename T>
 bool DataSet<T>::isEqualTo(const DataSet<T> &other) const
 {
     return this->isSubsetOf(other) && other.isSubsetOf(*this);
-    // TODO #08: Implementar la verificación de igualdad entre conjuntos (isEqualTo)
-    // Esta función debe retornar true si ambos conjuntos contienen exactamente los mismos elementos,
-    // sin importar el orden. Es decir, si A = B en términos de contenido.
-    //
-    // Para ello, puede utilizar la propiedad matemática de doble inclusión:
-    // A = B ⇔ (A ⊆ B) ∧ (B ⊆ A)
-    //
-    // Se deben usar las funciones ya implementadas: isSubsetOf()
-    // La función no debe modificar ninguno de los conjuntos.
-    // El resultado debe reflejar igualdad lógica entre conjuntos, no igualdad estructural interna.
 }
 
 /**
@@ -275,12 +673,79 @@ bool DataSet<T>::isEqualTo(const DataSet<T> &other) const
 template <typename T>
 size_t DataSet<T>::size() const
 {
-    // TODO #09: Implementar la función size()
-    // Esta función debe retornar la cantidad total de elementos almacenados en el conjunto actual.
-    // No se deben realizar recorridos ni contadores manuales.
-    //
-    // el número de elementos únicos contenidos en el conjunto.
-    return 1;
+    if (representation == SetRepresentation::TREE)
+    {
+        return tree.size();
+    }
+    if (representation == SetRepresentation::HASH)
+    {
+        return hashTable.size();
+    }
+    if (representation == SetRepresentation::FROZEN)
+    {
+        return frozenLayout.size();
+    }
+    if (representation == SetRepresentation::INTERVAL)
+    {
+        return intervals.size();
+    }
+    if (representation == SetRepresentation::BITSET)
+    {
+        return bitmap.size();
+    }
+    return elements.size();
+}
+
+/**
+ * @brief Estimates the bytes the set occupies: object, name, cached print
+ *        text and the storage of the current representation (conversions
+ *        release the others).
+ * @return Approximate footprint in bytes.
+ */
+template <typename T>
+size_t DataSet<T>::memoryUsage() const
+{
+    size_t bytes = sizeof(DataSet<T>) + name.memoryUsage();
+    {
+        std::lock_guard<std::mutex> lock(printCache.mutex);
+        if (printCache.text)
+        {
+            bytes += printCache.text->capacity();
+        }
+    }
+    {
+        std::lock_guard<std::mutex> lock(catalog.mutex);
+        if (catalog.block)
+        {
+            bytes += sizeof(SetStatistics<T>) +
+                     catalog.block->histogramBounds().capacity() * sizeof(T);
+        }
+    }
+    if (representation == SetRepresentation::VECTOR)
+    {
+        bytes += elements.capacity() * sizeof(T);
+    }
+    else if (representation == SetRepresentation::TREE)
+    {
+        bytes += tree.memoryUsage();
+    }
+    else if (representation == SetRepresentation::HASH)
+    {
+        bytes += hashTable.memoryUsage();
+    }
+    else if (representation == SetRepresentation::FROZEN)
+    {
+        bytes += frozenLayout.memoryUsage();
+    }
+    else if (representation == SetRepresentation::INTERVAL)
+    {
+        bytes += intervals.memoryUsage();
+    }
+    else if (representation == SetRepresentation::BITSET)
+    {
+        bytes += bitmap.memoryUsage();
+    }
+    return bytes;
 }
 
 /**
@@ -290,67 +755,1894 @@ size_t DataSet<T>::size() const
 template <typename T>
 std::vector<T> DataSet<T>::getElements() const
 {
-    return elements;
+    if (representation == SetRepresentation::VECTOR)
+    {
+        return elements;
+    }
+    std::vector<T> copy;
+    copy.reserve(this->size());
+    this->forEachElement([&copy](const T &val)
+                         { copy.push_back(val); });
+    return copy;
 }
 
+/**
+ * @brief Yields the elements lazily, in the order getElements() returns them,
+ *        straight from the current representation (runs and bitmaps are
+ *        expanded one value at a time). The set must outlive the generator
+ *        and must not change while it is in use.
+ * @return A generator over the elements.
+ */
 template <typename T>
-void DataSet<T>::print(std::ostream &os) const
+Generator<T> DataSet<T>::values() const
 {
-    if (!name.empty())
+    if (representation == SetRepresentation::TREE)
+    {
+        if constexpr (IsOrderable<T>::value)
+        {
+            return generateFrom<T>(tree);
+        }
+    }
+    if (representation == SetRepresentation::HASH)
+    {
+        if constexpr (ConcurrentHashSet<T>::SUPPORTED)
+        {
+            return hashTable.values();
+        }
+    }
+    if (representation == SetRepresentation::FROZEN)
+    {
+        if constexpr (IsOrderable<T>::value)
+        {
+            return frozenLayout.values();
+        }
+    }
+    if (representation == SetRepresentation::INTERVAL)
     {
-        os << name << " = ";
+        if constexpr (IntervalSet<T>::SUPPORTED)
+        {
+            return intervals.values();
+        }
     }
-    os << "{";
-    for (size_t i = 0; i < elements.size(); ++i)
+    if (representation == SetRepresentation::BITSET)
     {
-        os << elements[i];
-        if (i < elements.size() - 1)
+        if constexpr (BitsetSet<T>::SUPPORTED)
         {
-            os << ", ";
+            return bitmap.values();
         }
     }
-    os << "}";
+    return generateFrom<T>(elements);
 }
 
 /**
- * @brief Returns the power set (set of all subsets) of the current set.
+ * @brief Prints the contents of the set to the given output stream.
+ *        The formatted bytes are cached together with the version they belong
+ *        to, so printing an unchanged set again is a single write().
+ * @param os Output stream (defaults to std::cout).
  */
 template <typename T>
-DataSet<DataSet<T>> DataSet<T>::powerSet() const
+void DataSet<T>::print(std::ostream &os) const
 {
-    DataSet<DataSet<T>> result(this->getName() + " Power Set");
-    // TODO #10: Implementar la operación conjunto potencia (powerSet)
-    // Esta función debe retornar el conjunto potencia del conjunto actual,
-    // es decir, un nuevo conjunto que contenga todos los subconjuntos posibles.
-    //
-    // El resultado debe ser de tipo DataSet<DataSet<T>>, y cada subconjunto debe
-    // representarse como una instancia de DataSet<T>. Se deben incluir el conjunto vacío
-    // y el conjunto original.
-    //
-    // No se permite modificar el conjunto original.
-    // Se debe asegurar que los subconjuntos insertados en el resultado sean únicos.
-    return result;
-}
-
+    size_t current = version;
+    std::shared_ptr<const std::string> text;
+    {
+        std::lock_guard<std::mutex> lock(printCache.mutex);
+        if (printCache.text && printCache.version == current)
+        {
+            text = printCache.text;
+        }
+    }
+
+    if (!text)
+    {
+        std::ostringstream buffer;
+        if (!name.empty())
+        {
+            buffer << name << " = ";
+        }
+        buffer << "{";
+        bool first = true;
+        this->forEachElement([&buffer, &first](const T &val)
+                             {
+            if (!first)
+            {
+                buffer << ", ";
+            }
+            buffer << val;
+            first = false; });
+        buffer << "}";
+        text = std::make_shared<const std::string>(std::move(buffer).str());
+
+        std::lock_guard<std::mutex> lock(printCache.mutex);
+        printCache.text = text;
+        printCache.version = current;
+    }
+    os.write(text->data(), static_cast<std::streamsize>(text->size()));
+}
+
+/**
+ * @brief Returns the storage layout currently used by the set.
+ * @return The active SetRepresentation.
+ */
+template <typename T>
+SetRepresentation DataSet<T>::getRepresentation() const
+{
+    return representation;
+}
+
+/**
+ * @brief Converts the set to another storage layout, keeping its elements.
+ *        Converting to TREE changes iteration order to ascending. A set too
+ *        sparse for BITSET (see maxBitsetSpan) is converted to TREE instead.
+ *        Must not run concurrently with any other operation on the set.
+ * @param rep Target representation.
+ * @throws std::runtime_error if T cannot use the requested representation.
+ */
+template <typename T>
+void DataSet<T>::useRepresentation(SetRepresentation rep)
+{
+    if (rep == representation)
+    {
+        return;
+    }
+    if (((rep == SetRepresentation::TREE || rep == SetRepresentation::FROZEN) &&
+         !IsOrderable<T>::value) ||
+        (rep == SetRepresentation::HASH && !ConcurrentHashSet<T>::SUPPORTED) ||
+        (rep == SetRepresentation::INTERVAL && !IntervalSet<T>::SUPPORTED) ||
+        (rep == SetRepresentation::BITSET && !BitsetSet<T>::SUPPORTED))
+    {
+        throw std::runtime_error("Set '" + name.str() + "' cannot use the " +
+                                 representationName(rep) + " representation.");
+    }
+    std::vector<T> values = this->getElements();
+    if constexpr (IsOrderable<T>::value)
+    {
+        if (isOrderedRepresentation(rep) && !isOrderedRepresentation(representation))
+        {
+            sortValues(values);
+        }
+    }
+    if constexpr (BitsetSet<T>::SUPPORTED)
+    {
+        if (rep == SetRepresentation::BITSET && !values.empty() &&
+            valueSpan(values.front(), values.back()) > maxBitsetSpan(values.size()))
+        {
+            rep = SetRepresentation::TREE; // Too sparse for a bitmap
+            if (rep == representation)
+            {
+                return;
+            }
+        }
+    }
+    bool statisticsCurrent = catalog.describes(version);
+    version.add(1); // Iteration order, and with it the printed text, may change
+
+    elements.clear();
+    elements.shrink_to_fit();
+    tree.clear();
+    hashTable.clear();
+    frozenLayout.clear();
+    intervals.clear();
+    bitmap.clear();
+    representation = rep;
+    this->assignElements(values);
+    if (statisticsCurrent)
+    {
+        catalog.version = version; // Same elements in another layout
+    }
+}
+
+/**
+ * @brief Fills the empty storage of the current representation.
+ *        Ordered representations expect strictly ascending values.
+ */
+template <typename T>
+void DataSet<T>::assignElements(std::vector<T> &values)
+{
+    version.add(1);
+    if (representation == SetRepresentation::VECTOR)
+    {
+        elements.swap(values);
+    }
+    else if (representation == SetRepresentation::TREE)
+    {
+        if constexpr (IsOrderable<T>::value)
+        {
+            tree.assignSorted(values);
+        }
+    }
+    else if (representation == SetRepresentation::HASH)
+    {
+        if constexpr (ConcurrentHashSet<T>::SUPPORTED)
+        {
+            hashTable.reserve(values.size());
+            for (const T &val : values)
+            {
+                hashTable.insert(val);
+            }
+        }
+    }
+    else if (representation == SetRepresentation::FROZEN)
+    {
+        if constexpr (IsOrderable<T>::value)
+        {
+            frozenLayout.assignSorted(values);
+        }
+    }
+    else if (representation == SetRepresentation::INTERVAL)
+    {
+        if constexpr (IntervalSet<T>::SUPPORTED)
+        {
+            intervals.assignSorted(values);
+        }
+    }
+    else if (representation == SetRepresentation::BITSET)
+    {
+        if constexpr (BitsetSet<T>::SUPPORTED)
+        {
+            bitmap.assignSorted(values);
+        }
+    }
+}
+
+/**
+ * @brief Checks many values at once; out[i] is set to contains(keys[i]).
+ *        TREE, HASH and FROZEN sets interleave the independent lookups
+ *        (group prefetching) so that their cache misses overlap.
+ * @param keys Values to look up.
+ * @param out Receives one flag per key.
+ */
+template <typename T>
+void DataSet<T>::containsMany(std::span<const T> keys, std::vector<bool> &out) const
+{
+    if (adaptive)
+    {
+        queries.add(keys.size());
+    }
+    out.assign(keys.size(), false);
+    auto report = [&out](size_t index, bool found)
+    {
+        out[index] = found;
+    };
+
+    if constexpr (IsOrderable<T>::value)
+    {
+        if (representation == SetRepresentation::TREE)
+        {
+            tree.lookupBatch(keys.data(), keys.size(), report);
+            return;
+        }
+        if (representation == SetRepresentation::FROZEN)
+        {
+            frozenLayout.lookupBatch(keys.data(), keys.size(), report);
+            return;
+        }
+    }
+    if constexpr (ConcurrentHashSet<T>::SUPPORTED)
+    {
+        if (representation == SetRepresentation::HASH)
+        {
+            hashTable.lookupBatch(keys.data(), keys.size(), report);
+            return;
+        }
+    }
+    for (size_t i = 0; i < keys.size(); ++i)
+    {
+        out[i] = this->lookup(keys[i]);
+    }
+}
+
+/**
+ * @brief Calls visit(element, other.contains(element)) for every element of this
+ *        set until visit returns false. Large inputs are probed PROBE_BATCH
+ *        elements at a time through other.containsMany().
+ * @param other The set probed for membership.
+ * @param visit Callable taking (const T&, bool) and returning whether to continue.
+ */
+template <typename T>
+template <typename Fn>
+void DataSet<T>::probeEach(const DataSet<T> &other, Fn &&visit) const
+{
+    bool stopped = false;
+    if (this->size() < BATCH_PROBE_MIN || other.representation == SetRepresentation::VECTOR)
+    {
+        this->forEachElement([&](const T &val)
+                             {
+            if (!stopped)
+            {
+                stopped = !visit(val, other.contains(val));
+            } });
+        return;
+    }
+
+    std::vector<bool> found;
+    auto probe = [&](std::span<const T> batch)
+    {
+        other.containsMany(batch, found);
+        for (size_t i = 0; i < batch.size() && !stopped; ++i)
+        {
+            stopped = !visit(batch[i], found[i]);
+        }
+    };
+
+    if (representation == SetRepresentation::VECTOR)
+    {
+        // Elements are already contiguous: probe them in place
+        for (size_t i = 0; i < elements.size() && !stopped; i += PROBE_BATCH)
+        {
+            probe(std::span<const T>(elements).subspan(i, std::min(PROBE_BATCH, elements.size() - i)));
+        }
+        return;
+    }
+
+    std::vector<T> batch;
+    batch.reserve(PROBE_BATCH);
+    this->forEachElement([&](const T &val)
+                         {
+        if (stopped)
+        {
+            return;
+        }
+        batch.push_back(val);
+        if (batch.size() == PROBE_BATCH)
+        {
+            probe(batch);
+            batch.clear();
+        } });
+    if (!stopped && !batch.empty())
+    {
+        probe(batch);
+    }
+}
+
+/**
+ * @brief Converts the set to the read-only FROZEN layout (orderable T only).
+ *        contains() then uses branchless prefetching search and isSubsetOf()
+ *        probes this set in batches.
+ */
+template <typename T>
+void DataSet<T>::freeze()
+{
+    this->useRepresentation(SetRepresentation::FROZEN);
+}
+
+/**
+ * @brief Returns the number of maximal runs of consecutive values (integral T).
+ *        This is the number of entries the INTERVAL representation needs;
+ *        for other element types every element counts as its own run.
+ * @return Number of runs.
+ */
+template <typename T>
+size_t DataSet<T>::countRuns() const
+{
+    size_t runs = 0;
+    size_t span = 0;
+    this->measureRuns(runs, span);
+    return runs;
+}
+
+/**
+ * @brief Computes the run count and value span (integral T only).
+ *        Other element types report every element as its own run and span 0.
+ */
+template <typename T>
+void DataSet<T>::measureRuns(size_t &runs, size_t &span) const
+{
+    runs = this->size();
+    span = 0;
+    if constexpr (IntervalSet<T>::SUPPORTED)
+    {
+        if (representation == SetRepresentation::INTERVAL)
+        {
+            const std::vector<typename IntervalSet<T>::Run> &list = intervals.getRuns();
+            runs = list.size();
+            span = list.empty() ? 0 : valueSpan(list.front().lo, list.back().hi);
+            return;
+        }
+        std::vector<T> values = this->getElements();
+        if (!isOrderedRepresentation(representation))
+        {
+            sortValues(values);
+        }
+        runs = 0;
+        for (size_t i = 0; i < values.size(); ++i)
+        {
+            if (i == 0 || values[i - 1] + 1 != values[i])
+            {
+                ++runs;
+            }
+        }
+        span = values.empty() ? 0 : valueSpan(values.front(), values.back());
+    }
+}
+
+/**
+ * @brief Number of values between lo and hi inclusive, saturated to SIZE_MAX.
+ */
+template <typename T>
+size_t DataSet<T>::valueSpan(const T &lo, const T &hi)
+{
+    typedef typename std::make_unsigned<T>::type Unsigned;
+    uint64_t distance = static_cast<uint64_t>(
+        static_cast<Unsigned>(static_cast<Unsigned>(hi) - static_cast<Unsigned>(lo)));
+    return distance >= SIZE_MAX ? SIZE_MAX : static_cast<size_t>(distance + 1);
+}
+
+/**
+ * @brief Largest bitmap span (in bits) still worth it for `count` elements:
+ *        BITSET_MAX_SPAN_RATIO bits per element plus one word of slack.
+ */
+template <typename T>
+size_t DataSet<T>::maxBitsetSpan(size_t count)
+{
+    return BITSET_MAX_SPAN_RATIO * count + BitsetSet<T>::WORD_BITS;
+}
+
+/**
+ * @brief Enables or disables self-tuning. An adaptive set counts its inserts
+ *        and lookups and, every max(ADAPT_MIN_INSERTS, size) inserts, calls
+ *        adapt(). Lookups may run concurrently, and so may inserts while the
+ *        set is HASH: those only count, and the set re-plans on the next
+ *        explicit adapt().
+ * @param enable True to enable.
+ */
+template <typename T>
+void DataSet<T>::setAdaptive(bool enable)
+{
+    adaptive = enable;
+    insertsUntilAdapt = ADAPT_MIN_INSERTS;
+    this->clearWorkload();
+}
+
+/**
+ * @brief Tells whether self-tuning is enabled.
+ */
+template <typename T>
+bool DataSet<T>::isAdaptive() const
+{
+    return adaptive;
+}
+
+/**
+ * @brief Resets the insert and lookup counters, e.g. when a loading phase ends.
+ */
+template <typename T>
+void DataSet<T>::clearWorkload()
+{
+    mutations = 0;
+    queries = 0;
+}
+
+/**
+ * @brief Counts an insert of an adaptive set and re-plans when one is due.
+ *        HASH sets accept concurrent inserts, so they never re-plan here.
+ */
+template <typename T>
+void DataSet<T>::noteInsert()
+{
+    mutations.add(1);
+    if (representation == SetRepresentation::HASH)
+    {
+        return; // Other threads may be inserting: re-plan in adapt() or freezeAll()
+    }
+    if (insertsUntilAdapt > 0)
+    {
+        --insertsUntilAdapt;
+        return;
+    }
+    this->adapt();
+}
+
+/**
+ * @brief Switches to the representation the cost model picks for the current
+ *        statistics and restarts the workload counters.
+ */
+template <typename T>
+void DataSet<T>::adapt()
+{
+    size_t runs = 0;
+    size_t span = 0;
+    this->measureRuns(runs, span);
+    SetRepresentation target = this->chooseRepresentation(this->size(), span, runs);
+    insertsUntilAdapt = std::max(ADAPT_MIN_INSERTS, this->size());
+    this->clearWorkload();
+    this->useRepresentation(target);
+}
+
+/**
+ * @brief The representation the cost model picks for the given statistics and
+ *        the workload counted since the last adapt().
+ */
+template <typename T>
+SetRepresentation DataSet<T>::chooseRepresentation(size_t size, size_t span, size_t runs) const
+{
+    if (size < SMALL_SET_SIZE)
+    {
+        return SetRepresentation::VECTOR;
+    }
+    if constexpr (IntervalSet<T>::SUPPORTED)
+    {
+        if (runs * INTERVAL_MIN_RUN_LENGTH <= size)
+        {
+            return SetRepresentation::INTERVAL;
+        }
+        if (span <= maxBitsetSpan(size))
+        {
+            return SetRepresentation::BITSET;
+        }
+    }
+    bool readMostly = queries >= READ_MOSTLY_RATIO * mutations;
+    if constexpr (IsOrderable<T>::value)
+    {
+        if (readMostly)
+        {
+            return SetRepresentation::FROZEN;
+        }
+    }
+    if constexpr (ConcurrentHashSet<T>::SUPPORTED)
+    {
+        if (mutations > queries)
+        {
+            return SetRepresentation::HASH;
+        }
+    }
+    if constexpr (IsOrderable<T>::value)
+    {
+        return SetRepresentation::TREE;
+    }
+    return SetRepresentation::VECTOR;
+}
+
+/**
+ * @brief Returns the statistics the cost model looks at.
+ *        Computing span and runs takes O(n log n) unless the set is ordered.
+ * @return A Stats snapshot.
+ */
+template <typename T>
+typename DataSet<T>::Stats DataSet<T>::getStats() const
+{
+    Stats stats;
+    stats.representation = representation;
+    stats.size = this->size();
+    stats.statistics = this->statistics();
+    this->measureRuns(stats.runs, stats.span);
+    stats.mutations = mutations;
+    stats.queries = queries;
+    stats.adaptive = adaptive;
+    return stats;
+}
+
+/**
+ * @brief Returns the statistics block, rebuilding whatever is stale first.
+ * @return A copy of the statistics.
+ */
+template <typename T>
+SetStatistics<T> DataSet<T>::statistics() const
+{
+    std::lock_guard<std::mutex> lock(catalog.mutex);
+    size_t current = version;
+    if (!catalog.describes(current))
+    {
+        if (!catalog.block)
+        {
+            catalog.block = std::make_unique<SetStatistics<T>>(); // First request
+        }
+        catalog.block->clear();
+        bool rebuilt = false;
+        if constexpr (IntervalSet<T>::SUPPORTED)
+        {
+            if (representation == SetRepresentation::INTERVAL)
+            {
+                // Count and range per run, not per element
+                for (const typename IntervalSet<T>::Run &run : intervals.getRuns())
+                {
+                    catalog.block->addRun(run.lo, run.hi);
+                }
+                rebuilt = true;
+            }
+        }
+        if (!rebuilt)
+        {
+            this->forEachElement([this](const T &val)
+                                 { catalog.block->add(val); });
+        }
+        catalog.version = current;
+    }
+    if constexpr (IsOrderable<T>::value)
+    {
+        if (catalog.block->needsHistogram())
+        {
+            if (isOrderedRepresentation(representation))
+            {
+                // A few rank selections over runs, bitmap words or leaves: nothing is copied
+                catalog.block->rebuildHistogram([this](size_t rank)
+                                               { return this->elementOfRank(rank); });
+            }
+            else
+            {
+                std::vector<T> ascending = this->getElements(); // VECTOR or HASH: no order kept
+                sortValues(ascending);
+                catalog.block->rebuildHistogram([&ascending](size_t rank)
+                                               { return ascending[rank]; });
+            }
+        }
+    }
+    return *catalog.block;
+}
+
+/**
+ * @brief Throws std::runtime_error naming the set when it is empty.
+ */
+template <typename T>
+void DataSet<T>::requireElements() const
+{
+    if (this->size() == 0)
+    {
+        throw std::runtime_error("Set '" + name.str() + "' is empty.");
+    }
+}
+
+/**
+ * @brief Returns the element of rank `rank` (0 = smallest).
+ */
+template <typename T>
+T DataSet<T>::elementOfRank(size_t rank) const
+{
+    if constexpr (IntervalSet<T>::SUPPORTED)
+    {
+        if (representation == SetRepresentation::INTERVAL)
+        {
+            return intervals.select(rank);
+        }
+        if (representation == SetRepresentation::BITSET)
+        {
+            return bitmap.select(rank);
+        }
+    }
+    if constexpr (IsOrderable<T>::value)
+    {
+        if (representation == SetRepresentation::FROZEN)
+        {
+            return frozenLayout.select(rank);
+        }
+        if (representation == SetRepresentation::TREE)
+        {
+            // The largest key is one descent away; other ranks walk the leaves
+            return rank + 1 == tree.size() ? tree.back() : tree.select(rank);
+        }
+    }
+    std::vector<T> copy;
+    if (representation == SetRepresentation::VECTOR)
+    {
+        copy = elements;
+    }
+    else
+    {
+        copy.reserve(this->size());
+        this->forEachElement([&copy](const T &val)
+                             { copy.push_back(val); });
+    }
+    std::nth_element(copy.begin(), copy.begin() + static_cast<std::ptrdiff_t>(rank), copy.end());
+    return copy[rank];
+}
+
+/**
+ * @brief Returns the exact sum, refusing results int64_t cannot hold.
+ */
+template <typename T>
+int64_t DataSet<T>::sum() const
+{
+    static_assert(std::is_integral<T>::value, "sum() needs an integral element type");
+    bool overflow = false;
+    __int128 total = this->exactSum(overflow);
+    if (overflow || total < std::numeric_limits<int64_t>::min() ||
+        total > std::numeric_limits<int64_t>::max())
+    {
+        throw std::runtime_error("Sum of set '" + name.str() + "' overflows a 64-bit integer.");
+    }
+    return static_cast<int64_t>(total);
+}
+
+/**
+ * @brief Sum of the elements: kernels for 4-byte values (their int64_t sum
+ *        cannot wrap), a 128-bit accumulator for 8-byte ones.
+ */
+template <typename T>
+__int128 DataSet<T>::exactSum(bool &overflow) const
+{
+    overflow = false;
+    if constexpr (sizeof(T) < 8)
+    {
+        if (representation == SetRepresentation::VECTOR)
+        {
+            return simdSum(elements.data(), elements.size());
+        }
+        if (representation == SetRepresentation::FROZEN)
+        {
+            std::span<const T> keys = frozenLayout.storage();
+            return simdSum(keys.data(), keys.size());
+        }
+        if (representation == SetRepresentation::INTERVAL)
+        {
+            return intervals.sum();
+        }
+        if (representation == SetRepresentation::BITSET)
+        {
+            return bitmap.sum();
+        }
+        int64_t total = 0;
+        if (representation == SetRepresentation::TREE)
+        {
+            tree.forEachLeaf([&total](const T *keys, size_t count)
+                             { total += simdSum(keys, count); });
+        }
+        else
+        {
+            this->forEachElement([&total](const T &val)
+                                 { total += static_cast<int64_t>(val); });
+        }
+        return total;
+    }
+    else
+    {
+        __int128 total = 0;
+        if (representation == SetRepresentation::INTERVAL)
+        {
+            for (const typename IntervalSet<T>::Run &run : intervals.getRuns())
+            {
+                // (lo + hi) * length is even: lo + hi and hi - lo + 1 differ in parity
+                __int128 ends = static_cast<__int128>(run.lo) + static_cast<__int128>(run.hi);
+                __int128 length = static_cast<__int128>(run.hi) - static_cast<__int128>(run.lo) + 1;
+                __int128 series = 0;
+                overflow = overflow || __builtin_mul_overflow(ends, length, &series) ||
+                           __builtin_add_overflow(total, series / 2, &total);
+            }
+            return total;
+        }
+        this->forEachElement([&total](const T &val)
+                             { total += static_cast<__int128>(val); });
+        return total;
+    }
+}
+
+/**
+ * @brief Returns the smallest element: the first rank of an ordered layout,
+ *        otherwise one min/max pass.
+ */
+template <typename T>
+T DataSet<T>::minimum() const
+{
+    static_assert(std::is_integral<T>::value, "minimum() needs an integral element type");
+    this->requireElements();
+    if (isOrderedRepresentation(representation))
+    {
+        return this->elementOfRank(0);
+    }
+    if (representation == SetRepresentation::VECTOR)
+    {
+        T lowest, highest;
+        simdMinMax(elements.data(), elements.size(), lowest, highest);
+        return lowest;
+    }
+    T lowest = std::numeric_limits<T>::max();
+    this->forEachElement([&lowest](const T &val)
+                         { lowest = val < lowest ? val : lowest; });
+    return lowest;
+}
+
+/**
+ * @brief Returns the largest element: the last rank of an ordered layout,
+ *        otherwise one min/max pass.
+ */
+template <typename T>
+T DataSet<T>::maximum() const
+{
+    static_assert(std::is_integral<T>::value, "maximum() needs an integral element type");
+    this->requireElements();
+    if (isOrderedRepresentation(representation))
+    {
+        return this->elementOfRank(this->size() - 1);
+    }
+    if (representation == SetRepresentation::VECTOR)
+    {
+        T lowest, highest;
+        simdMinMax(elements.data(), elements.size(), lowest, highest);
+        return highest;
+    }
+    T highest = std::numeric_limits<T>::min();
+    this->forEachElement([&highest](const T &val)
+                         { highest = highest < val ? val : highest; });
+    return highest;
+}
+
+/**
+ * @brief Returns the exact sum divided by size().
+ */
+template <typename T>
+double DataSet<T>::mean() const
+{
+    static_assert(std::is_integral<T>::value, "mean() needs an integral element type");
+    this->requireElements();
+    bool overflow = false;
+    __int128 total = this->exactSum(overflow);
+    if (overflow)
+    {
+        throw std::runtime_error("Sum of set '" + name.str() + "' overflows a 128-bit integer.");
+    }
+    return static_cast<double>(total) / static_cast<double>(this->size());
+}
+
+/**
+ * @brief Returns the element of rank floor(q * (n - 1)).
+ */
+template <typename T>
+T DataSet<T>::quantile(double q) const
+{
+    static_assert(std::is_integral<T>::value, "quantile() needs an integral element type");
+    this->requireElements();
+    if (!(q >= 0.0 && q <= 1.0)) // Also rejects NaN
+    {
+        throw std::runtime_error("Quantile must lie in [0, 1].");
+    }
+    size_t rank = static_cast<size_t>(q * static_cast<double>(this->size() - 1));
+    return this->elementOfRank(std::min(rank, this->size() - 1));
+}
+
+/**
+ * @brief Collects the elements a predicate kernel selects, block by block.
+ */
+template <typename T>
+template <typename Kernel>
+DataSet<T> DataSet<T>::selectWhere(Kernel &&kernel) const
+{
+    std::vector<T> selected;
+    std::vector<uint64_t> bits;
+    this->forEachBlock([&](const T *data, size_t count)
+                       {
+        bits.assign((count + 63) / 64, 0);
+        if (kernel(data, count, bits.data()) == 0)
+        {
+            return;
+        }
+        for (size_t word = 0; word < bits.size(); ++word)
+        {
+            for (uint64_t rest = bits[word]; rest != 0; rest &= rest - 1)
+            {
+                selected.push_back(data[word * 64 + std::countr_zero(rest)]);
+            }
+        } });
+    return this->derivedSet(selected, derivedRepresentation());
+}
+
+/**
+ * @brief Builds an unnamed set of `values` in `target` (TREE for a sparse bitmap).
+ */
+template <typename T>
+DataSet<T> DataSet<T>::derivedSet(std::vector<T> &values, SetRepresentation target) const
+{
+    if constexpr (BitsetSet<T>::SUPPORTED)
+    {
+        if (target == SetRepresentation::BITSET && !values.empty() &&
+            valueSpan(values.front(), values.back()) > maxBitsetSpan(values.size()))
+        {
+            target = SetRepresentation::TREE;
+        }
+    }
+    DataSet<T> result((SetName()));
+    result.useRepresentation(target);
+    result.assignElements(values);
+    result.adaptive = adaptive;
+    return result;
+}
+
+/**
+ * @brief Returns the elements x with x op key.
+ */
+template <typename T>
+DataSet<T> DataSet<T>::where(Comparison op, const T &key) const
+{
+    if constexpr (IntervalSet<T>::SUPPORTED)
+    {
+        if (representation == SetRepresentation::INTERVAL)
+        {
+            // Accepted values form at most two ranges of T; keep what every run shares with them
+            const T lowest = std::numeric_limits<T>::min();
+            const T highest = std::numeric_limits<T>::max();
+            std::vector<typename IntervalSet<T>::Run> accepted;
+            if (op == Comparison::EQUAL)
+                accepted.push_back({key, key});
+            if ((op == Comparison::LESS || op == Comparison::NOT_EQUAL) && key != lowest)
+                accepted.push_back({lowest, static_cast<T>(key - 1)});
+            if (op == Comparison::LESS_EQUAL)
+                accepted.push_back({lowest, key});
+            if ((op == Comparison::GREATER || op == Comparison::NOT_EQUAL) && key != highest)
+                accepted.push_back({static_cast<T>(key + 1), highest});
+            if (op == Comparison::GREATER_EQUAL)
+                accepted.push_back({key, highest});
+
+            DataSet<T> result((SetName()));
+            result.useRepresentation(SetRepresentation::INTERVAL);
+            result.adaptive = adaptive;
+            for (const typename IntervalSet<T>::Run &run : intervals.getRuns())
+            {
+                for (const typename IntervalSet<T>::Run &range : accepted)
+                {
+                    T lo = std::max(run.lo, range.lo);
+                    T hi = std::min(run.hi, range.hi);
+                    if (!(hi < lo))
+                    {
+                        result.insertRange(lo, hi);
+                    }
+                }
+            }
+            return result;
+        }
+    }
+    return this->selectWhere([op, &key](const T *data, size_t count, uint64_t *bits)
+                             { return simdCompare(data, count, op, key, bits); });
+}
+
+/**
+ * @brief Returns the elements x with (x mod modulus) op remainder.
+ */
+template <typename T>
+DataSet<T> DataSet<T>::whereModulo(const T &modulus, Comparison op, const T &remainder) const
+{
+    static_assert(std::is_integral<T>::value, "whereModulo() needs an integral element type");
+    if (!(T(0) < modulus))
+    {
+        throw std::runtime_error("Modulus must be positive.");
+    }
+    return this->selectWhere([&modulus, op, &remainder](const T *data, size_t count, uint64_t *bits)
+                             { return simdCompareModulo(data, count, modulus, op, remainder, bits); });
+}
+
+/**
+ * @brief Returns { x * factor + addend | x in this set }.
+ */
+template <typename T>
+DataSet<T> DataSet<T>::mapAffine(const T &factor, const T &addend) const
+{
+    static_assert(std::is_integral<T>::value, "mapAffine() needs an integral element type");
+    SetRepresentation target = derivedRepresentation();
+    if (this->size() == 0)
+    {
+        std::vector<T> none;
+        return this->derivedSet(none, target);
+    }
+
+    // The map is monotonic: every image fits in T if those of the extremes do
+    for (const T &extreme : {this->minimum(), this->maximum()})
+    {
+        T product, image;
+        if (__builtin_mul_overflow(extreme, factor, &product) ||
+            __builtin_add_overflow(product, addend, &image))
+        {
+            throw std::runtime_error("Mapping set '" + name.str() + "' overflows its element type.");
+        }
+    }
+    if (factor == T(0))
+    {
+        std::vector<T> single(1, addend);
+        return this->derivedSet(single, target);
+    }
+
+    bool reversed = factor < T(0);
+    if (representation == SetRepresentation::INTERVAL)
+    {
+        if constexpr (IntervalSet<T>::SUPPORTED)
+        {
+            if (factor == T(1) || factor == T(-1))
+            {
+                // A shift or a mirror image maps runs onto runs
+                DataSet<T> result((SetName()));
+                result.useRepresentation(SetRepresentation::INTERVAL);
+                result.adaptive = adaptive;
+                for (const typename IntervalSet<T>::Run &run : intervals.getRuns())
+                {
+                    T lo = static_cast<T>(run.lo * factor + addend);
+                    T hi = static_cast<T>(run.hi * factor + addend);
+                    result.insertRange(reversed ? hi : lo, reversed ? lo : hi);
+                }
+                return result;
+            }
+        }
+        target = SetRepresentation::TREE; // Runs become isolated values
+    }
+
+    std::vector<T> mapped(this->size());
+    size_t filled = 0;
+    this->forEachBlock([&](const T *data, size_t count)
+                       {
+        simdAffine(data, count, factor, addend, mapped.data() + filled);
+        filled += count; });
+    if (reversed && isOrderedRepresentation(representation))
+    {
+        std::reverse(mapped.begin(), mapped.end()); // Descending images: ascending again
+    }
+    return this->derivedSet(mapped, target);
+}
+
+/**
+ * @brief Splits the set into buckets: classify and count, then scatter.
+ */
+template <typename T>
+template <typename Classify>
+std::vector<DataSet<T>> DataSet<T>::partitionBy(size_t buckets, Classify &&bucketOf,
+                                                TaskScheduler *scheduler) const
+{
+    if (buckets > PARTITION_MAX_BUCKETS)
+    {
+        throw std::runtime_error("A partition has at most " + std::to_string(PARTITION_MAX_BUCKETS) +
+                                 " buckets.");
+    }
+    std::vector<T> gathered;
+    std::span<const T> values(elements);
+    if (representation != SetRepresentation::VECTOR)
+    {
+        gathered.reserve(this->size());
+        this->forEachBlock([&gathered](const T *data, size_t count)
+                           { gathered.insert(gathered.end(), data, data + count); });
+        values = gathered;
+    }
+
+    // Several chunks per thread, so that stealing evens out the load
+    constexpr size_t CHUNKS_PER_THREAD = 4;
+    const size_t count = values.size();
+    size_t chunks = 1;
+    if (scheduler != nullptr && scheduler->threadCount() > 1 && count >= PARALLEL_PARTITION_MIN)
+    {
+        chunks = std::min(scheduler->threadCount() * CHUNKS_PER_THREAD,
+                          count / (PARALLEL_PARTITION_MIN / CHUNKS_PER_THREAD));
+    }
+    auto chunkBegin = [count, chunks](size_t c)
+    { return count * c / chunks; };
+    auto forEachIndex = [&](size_t total, auto &&body)
+    {
+        if (scheduler == nullptr || total == 1)
+        {
+            for (size_t i = 0; i < total; ++i)
+            {
+                body(i);
+            }
+            return;
+        }
+        scheduler->parallelFor(0, total, 1, [&body](size_t lo, size_t hi)
+                               {
+            for (size_t i = lo; i < hi; ++i)
+            {
+                body(i);
+            } });
+    };
+
+    // Pass 1: classify every element once and count per chunk; bucket `buckets` is the discard pile
+    const size_t slots = buckets + 1;
+    std::vector<uint32_t> bucketIds(count);
+    std::vector<size_t> offsets(chunks * slots, 0);
+    forEachIndex(chunks, [&](size_t c)
+                 {
+        size_t *local = offsets.data() + c * slots;
+        for (size_t i = chunkBegin(c); i < chunkBegin(c + 1); ++i)
+        {
+            size_t bucket = std::min(static_cast<size_t>(bucketOf(values[i])), buckets);
+            bucketIds[i] = static_cast<uint32_t>(bucket);
+            ++local[bucket];
+        } });
+
+    // Chunk c writes bucket b after every smaller bucket and the earlier chunks' share of b
+    std::vector<size_t> bounds(slots + 1, 0);
+    size_t position = 0;
+    for (size_t b = 0; b < slots; ++b)
+    {
+        bounds[b] = position;
+        for (size_t c = 0; c < chunks; ++c)
+        {
+            size_t n = offsets[c * slots + b];
+            offsets[c * slots + b] = position;
+            position += n;
+        }
+    }
+    bounds[slots] = position;
+
+    // Pass 2: scatter
+    std::vector<T> scattered(count);
+    forEachIndex(chunks, [&](size_t c)
+                 {
+        size_t *local = offsets.data() + c * slots;
+        for (size_t i = chunkBegin(c); i < chunkBegin(c + 1); ++i)
+        {
+            scattered[local[bucketIds[i]]++] = values[i];
+        } });
+
+    // Every bucket is a contiguous, duplicate-free run in this set's order
+    std::vector<DataSet<T>> parts(buckets, DataSet<T>(SetName()));
+    SetRepresentation target = derivedRepresentation();
+    forEachIndex(buckets, [&](size_t b)
+                 {
+        std::vector<T> part(scattered.begin() + bounds[b], scattered.begin() + bounds[b + 1]);
+        parts[b] = this->derivedSet(part, target); });
+    return parts;
+}
+
+/**
+ * @brief Splits the set by floored remainder modulo `modulus`.
+ */
+template <typename T>
+std::vector<DataSet<T>> DataSet<T>::partitionByModulo(const T &modulus, TaskScheduler *scheduler) const
+{
+    static_assert(std::is_integral<T>::value, "partitionByModulo() needs an integral element type");
+    if (!(T(0) < modulus))
+    {
+        throw std::runtime_error("Modulus must be positive.");
+    }
+    if (static_cast<uint64_t>(modulus) > PARTITION_MAX_BUCKETS)
+    {
+        throw std::runtime_error("A partition has at most " + std::to_string(PARTITION_MAX_BUCKETS) +
+                                 " buckets.");
+    }
+    if constexpr (IntervalSet<T>::SUPPORTED)
+    {
+        if (representation == SetRepresentation::INTERVAL)
+        {
+            return this->partitionRunsByModulo(modulus, scheduler);
+        }
+    }
+    return this->partitionBy(static_cast<size_t>(modulus), [&modulus](const T &value)
+                             { return static_cast<size_t>(simd_detail::floorModulo(value, modulus)); }, scheduler);
+}
+
 /**
- * @brief Returns the Cartesian product A × B as a set of (a, b) pairs.
+ * @brief partitionByModulo for INTERVAL sets. The values of a run [lo, hi]
+ *        with one residue form a stride of step `modulus`, so each run adds
+ *        at most `modulus` strides. They reach every bucket in ascending order:
+ *        a bucket dense enough for a bitmap sets its bits directly, any other
+ *        bucket collects its values for a TREE. No copy of the set is made.
  */
 template <typename T>
-DataSet<std::pair<T, T>> DataSet<T>::cartesianProductWith(const DataSet<T> &other) const
+std::vector<DataSet<T>> DataSet<T>::partitionRunsByModulo(const T &modulus, TaskScheduler *scheduler) const
+{
+    typedef typename std::make_unsigned<T>::type Unsigned;
+    const size_t buckets = static_cast<size_t>(modulus);
+    std::vector<DataSet<T>> parts(buckets, DataSet<T>(SetName()));
+    if (buckets == 1)
+    {
+        parts[0].useRepresentation(SetRepresentation::INTERVAL);
+        parts[0].intervals = intervals;
+        parts[0].adaptive = adaptive;
+        return parts;
+    }
+
+    // Calls emit(bucket, first, count) for every stride of every run, in ascending order
+    const Unsigned step = static_cast<Unsigned>(modulus);
+    auto forEachStride = [&](auto &&emit)
+    {
+        for (const typename IntervalSet<T>::Run &run : intervals.getRuns())
+        {
+            const Unsigned base = static_cast<Unsigned>(run.lo);
+            const Unsigned last = static_cast<Unsigned>(static_cast<Unsigned>(run.hi) - base); // Length - 1
+            const size_t residue = static_cast<size_t>(simd_detail::floorModulo(run.lo, modulus));
+            const Unsigned reach = std::min<Unsigned>(last, static_cast<Unsigned>(step - 1));
+            for (Unsigned offset = 0;; ++offset)
+            {
+                emit((residue + offset) % buckets, static_cast<Unsigned>(base + offset),
+                     static_cast<Unsigned>((last - offset) / step));
+                if (offset == reach)
+                {
+                    break;
+                }
+            }
+        }
+    };
+
+    // Pass 1: size and extent of every bucket (`more` is the stride's count - 1)
+    std::vector<size_t> counts(buckets, 0);
+    std::vector<Unsigned> lowest(buckets, 0), highest(buckets, 0);
+    forEachStride([&](size_t b, Unsigned first, Unsigned more)
+                  {
+        if (counts[b] == 0)
+        {
+            lowest[b] = first;
+        }
+        counts[b] += static_cast<size_t>(more) + 1;
+        highest[b] = static_cast<Unsigned>(first + more * step); });
+    std::vector<unsigned char> dense(buckets, 0);
+    std::vector<std::vector<T>> sparse(buckets);
+    for (size_t b = 0; b < buckets; ++b)
+    {
+        dense[b] = counts[b] > 0 && valueSpan(static_cast<T>(lowest[b]), static_cast<T>(highest[b])) <=
+                                        maxBitsetSpan(counts[b]);
+        if (dense[b])
+        {
+            parts[b].useRepresentation(SetRepresentation::BITSET);
+            parts[b].adaptive = adaptive;
+        }
+        else
+        {
+            sparse[b].reserve(counts[b]);
+        }
+    }
+
+    // Pass 2: emit every stride into its bucket
+    forEachStride([&](size_t b, Unsigned first, Unsigned more)
+                  {
+        Unsigned value = first;
+        for (Unsigned i = 0;; ++i, value = static_cast<Unsigned>(value + step))
+        {
+            if (dense[b])
+            {
+                parts[b].bitmap.insert(static_cast<T>(value));
+            }
+            else
+            {
+                sparse[b].push_back(static_cast<T>(value));
+            }
+            if (i == more)
+            {
+                break;
+            }
+        } });
+
+    auto build = [&](size_t lo, size_t hi)
+    {
+        for (size_t b = lo; b < hi; ++b)
+        {
+            if (dense[b])
+            {
+                parts[b].version.add(1); // The bitmap was filled behind insert()'s back
+            }
+            else
+            {
+                parts[b] = this->derivedSet(sparse[b], SetRepresentation::TREE);
+            }
+        }
+    };
+    if (scheduler != nullptr)
+    {
+        scheduler->parallelFor(0, buckets, 1, build);
+    }
+    else
+    {
+        build(0, buckets);
+    }
+    return parts;
+}
+
+/**
+ * @brief Splits the set by disjoint inclusive value ranges.
+ */
+template <typename T>
+std::vector<DataSet<T>> DataSet<T>::partitionByRanges(const std::vector<std::pair<T, T>> &ranges,
+                                                      TaskScheduler *scheduler) const
+{
+    static_assert(std::is_integral<T>::value, "partitionByRanges() needs an integral element type");
+    if (ranges.size() > PARTITION_MAX_BUCKETS)
+    {
+        throw std::runtime_error("A partition has at most " + std::to_string(PARTITION_MAX_BUCKETS) +
+                                 " buckets.");
+    }
+    // Range indices by lower bound, so that an element's range is one binary search away
+    std::vector<size_t> order(ranges.size());
+    for (size_t i = 0; i < order.size(); ++i)
+    {
+        order[i] = i;
+    }
+    std::sort(order.begin(), order.end(), [&ranges](size_t a, size_t b)
+              { return ranges[a].first < ranges[b].first; });
+    std::vector<T> starts;
+    starts.reserve(order.size());
+    for (size_t k = 0; k < order.size(); ++k)
+    {
+        const std::pair<T, T> &range = ranges[order[k]];
+        if (range.second < range.first)
+        {
+            throw std::runtime_error("Empty range in a partition.");
+        }
+        if (k > 0 && !(ranges[order[k - 1]].second < range.first))
+        {
+            throw std::runtime_error("Ranges of a partition must not overlap.");
+        }
+        starts.push_back(range.first);
+    }
+
+    if constexpr (IntervalSet<T>::SUPPORTED)
+    {
+        if (representation == SetRepresentation::INTERVAL)
+        {
+            // Clip the runs to every range: O(runs + buckets), nothing is expanded
+            std::vector<DataSet<T>> parts;
+            parts.reserve(ranges.size());
+            for (size_t i = 0; i < ranges.size(); ++i)
+            {
+                parts.emplace_back(SetName());
+                parts.back().useRepresentation(SetRepresentation::INTERVAL);
+                parts.back().adaptive = adaptive;
+            }
+            const std::vector<typename IntervalSet<T>::Run> &runs = intervals.getRuns();
+            size_t r = 0;
+            for (size_t k = 0; k < order.size(); ++k)
+            {
+                const std::pair<T, T> &range = ranges[order[k]];
+                while (r < runs.size() && runs[r].hi < range.first)
+                {
+                    ++r;
+                }
+                for (size_t next = r; next < runs.size() && !(range.second < runs[next].lo); ++next)
+                {
+                    parts[order[k]].insertRange(std::max(runs[next].lo, range.first),
+                                                std::min(runs[next].hi, range.second));
+                }
+            }
+            return parts;
+        }
+    }
+    const size_t buckets = ranges.size();
+    return this->partitionBy(buckets, [&](const T &value)
+                             {
+        size_t k = static_cast<size_t>(std::upper_bound(starts.begin(), starts.end(), value) - starts.begin());
+        if (k == 0 || ranges[order[k - 1]].second < value)
+        {
+            return buckets; // Below the first range, or between two
+        }
+        return order[k - 1]; }, scheduler);
+}
+
+/**
+ * @brief Bumps the version after an insert that added a value, and adds the
+ *        value to the statistics when they were current.
+ */
+template <typename T>
+void DataSet<T>::noteInserted(const T &value, bool added)
+{
+    if (!added)
+    {
+        return; // Nothing changed: cached text and statistics stay valid
+    }
+    size_t previous = version;
+    version.add(1);
+    if (!catalog.describes(previous))
+    {
+        return; // Missing or stale: statistics() rebuilds them
+    }
+    catalog.block->add(value);
+    catalog.version = version;
+}
+
+/**
+ * @brief Representation for sets derived from this one: the same layout,
+ *        except that a FROZEN set produces TREE results (which accept inserts).
+ */
+template <typename T>
+SetRepresentation DataSet<T>::derivedRepresentation() const
+{
+    if (representation == SetRepresentation::FROZEN)
+    {
+        return SetRepresentation::TREE;
+    }
+    return representation;
+}
+
+/**
+ * @brief Pre-sizes the storage for `count` elements. Results of the set
+ *        operations are filled in the iteration order of their HASH operands,
+ *        which is slot order; inserted into a smaller table with the same
+ *        hash, those keys would pile up in long probe clusters.
+ */
+template <typename T>
+void DataSet<T>::reserve(size_t count)
+{
+    if constexpr (ConcurrentHashSet<T>::SUPPORTED)
+    {
+        if (representation == SetRepresentation::HASH)
+        {
+            hashTable.reserve(count);
+        }
+    }
+}
+
+/**
+ * @brief Calls fn(element) for every element of the current representation.
+ *        VECTOR visits insertion order, HASH table order, and the ordered
+ *        representations (see isOrderedRepresentation) ascending order.
+ * @param fn Callable taking const T&.
+ */
+template <typename T>
+template <typename Fn>
+void DataSet<T>::forEachElement(Fn &&fn) const
+{
+    if (representation == SetRepresentation::TREE)
+    {
+        tree.forEach(fn);
+        return;
+    }
+    if (representation == SetRepresentation::HASH)
+    {
+        if constexpr (ConcurrentHashSet<T>::SUPPORTED)
+        {
+            hashTable.forEach(fn);
+        }
+        return;
+    }
+    if (representation == SetRepresentation::FROZEN)
+    {
+        if constexpr (IsOrderable<T>::value)
+        {
+            frozenLayout.forEach(fn);
+        }
+        return;
+    }
+    if (representation == SetRepresentation::INTERVAL)
+    {
+        if constexpr (IntervalSet<T>::SUPPORTED)
+        {
+            intervals.forEach(fn);
+        }
+        return;
+    }
+    if (representation == SetRepresentation::BITSET)
+    {
+        if constexpr (BitsetSet<T>::SUPPORTED)
+        {
+            bitmap.forEach(fn);
+        }
+        return;
+    }
+    for (const T &val : elements)
+    {
+        fn(val);
+    }
+}
+
+/**
+ * @brief Calls fn(data, count) on blocks of elements in forEachElement() order.
+ * @param fn Callable taking (const T*, size_t).
+ */
+template <typename T>
+template <typename Fn>
+void DataSet<T>::forEachBlock(Fn &&fn) const
+{
+    if (representation == SetRepresentation::VECTOR)
+    {
+        if (!elements.empty())
+        {
+            fn(elements.data(), elements.size());
+        }
+        return;
+    }
+    if constexpr (IsOrderable<T>::value)
+    {
+        if (representation == SetRepresentation::TREE)
+        {
+            tree.forEachLeaf(fn);
+            return;
+        }
+    }
+    std::vector<T> block;
+    block.reserve(std::min(SCAN_BLOCK, this->size()));
+    this->forEachElement([&block, &fn](const T &val)
+                         {
+        block.push_back(val);
+        if (block.size() == SCAN_BLOCK)
+        {
+            fn(block.data(), block.size());
+            block.clear();
+        } });
+    if (!block.empty())
+    {
+        fn(block.data(), block.size());
+    }
+}
+
+/**
+ * @brief Merges two TREE sets leaf by leaf into a sorted vector.
+ * @param other The other TREE operand.
+ * @param keepOnlyThis Keep elements found only in this set.
+ * @param keepBoth Keep elements found in both sets.
+ * @param keepOnlyOther Keep elements found only in the other set.
+ * @return Ascending elements selected by the flags.
+ */
+template <typename T>
+std::vector<T> DataSet<T>::mergeTrees(const DataSet<T> &other, bool keepOnlyThis,
+                                      bool keepBoth, bool keepOnlyOther) const
+{
+    return mergeAscending(tree.begin(), tree.end(), other.tree.begin(), other.tree.end(),
+                          keepOnlyThis, keepBoth, keepOnlyOther);
+}
+
+/**
+ * @brief Merges two ascending sequences, keeping elements selected by the flags.
+ * @param itA, endA First sequence.
+ * @param itB, endB Second sequence.
+ * @param keepOnlyThis Keep elements found only in the first sequence.
+ * @param keepBoth Keep elements found in both sequences.
+ * @param keepOnlyOther Keep elements found only in the second sequence.
+ * @return Ascending elements selected by the flags.
+ */
+template <typename T>
+template <typename ItA, typename ItB>
+std::vector<T> DataSet<T>::mergeAscending(ItA itA, ItA endA, ItB itB, ItB endB,
+                                          bool keepOnlyThis, bool keepBoth, bool keepOnlyOther)
+{
+    std::vector<T> merged;
+    while (itA != endA && itB != endB)
+    {
+        if (*itA < *itB)
+        {
+            if (keepOnlyThis)
+                merged.push_back(*itA);
+            ++itA;
+        }
+        else if (*itB < *itA)
+        {
+            if (keepOnlyOther)
+                merged.push_back(*itB);
+            ++itB;
+        }
+        else
+        {
+            if (keepBoth)
+                merged.push_back(*itA);
+            ++itA;
+            ++itB;
+        }
+    }
+    for (; keepOnlyThis && itA != endA; ++itA)
+    {
+        merged.push_back(*itA);
+    }
+    for (; keepOnlyOther && itB != endB; ++itB)
+    {
+        merged.push_back(*itB);
+    }
+    return merged;
+}
+
+/**
+ * @brief Tells whether every element of [itA, endA) is in [itB, endB), both
+ *        ascending; stops at the first element of the first sequence missing
+ *        from the second.
+ */
+template <typename T>
+template <typename ItA, typename EndA, typename ItB, typename EndB>
+bool DataSet<T>::includesAscending(ItA itA, EndA endA, ItB itB, EndB endB)
+{
+    for (; itA != endA; ++itA)
+    {
+        while (itB != endB && *itB < *itA)
+        {
+            ++itB;
+        }
+        if (itB == endB || *itA < *itB)
+        {
+            return false;
+        }
+        ++itB;
+    }
+    return true;
+}
+
+/**
+ * @brief Runs the specialised kernel for a binary operation when one applies
+ *        to this pair of representations: leaf merge (TREE), run sweep
+ *        (INTERVAL), word-wise logic (BITSET), a linear merge of two
+ *        ordered operands of comparable size, or, for a union or difference
+ *        whose smaller operand holds PARTITIONED_MIN_BYTES, radix partitioning
+ *        into cache-sized partition pairs (never for a VECTOR result, whose
+ *        order is that of the operands). Also marks result adaptive if either
+ *        operand is.
+ * @param other The other operand.
+ * @param keepOnlyThis Keep elements found only in this set.
+ * @param keepBoth Keep elements found in both sets.
+ * @param keepOnlyOther Keep elements found only in the other set.
+ * @param result Receives the selected elements when a kernel ran.
+ * @param scheduler Pool for the partitioned kernel (nullptr: sequential).
+ * @return False if the caller must fall back to probing.
+ */
+template <typename T>
+bool DataSet<T>::combineWithKernel(const DataSet<T> &other, bool keepOnlyThis, bool keepBoth,
+                                   bool keepOnlyOther, DataSet<T> &result,
+                                   TaskScheduler *scheduler) const
 {
+    result.adaptive = adaptive || other.adaptive;
+    if constexpr (IsOrderable<T>::value)
+    {
+        if (representation == SetRepresentation::TREE &&
+            other.representation == SetRepresentation::TREE)
+        {
+            result.representation = SetRepresentation::TREE;
+            result.tree.assignSorted(mergeTrees(other, keepOnlyThis, keepBoth, keepOnlyOther));
+            return true;
+        }
+    }
+    if constexpr (IntervalSet<T>::SUPPORTED)
+    {
+        if (representation == SetRepresentation::INTERVAL &&
+            other.representation == SetRepresentation::INTERVAL)
+        {
+            result.representation = SetRepresentation::INTERVAL;
+            result.intervals = IntervalSet<T>::combine(intervals, other.intervals,
+                                                       keepOnlyThis, keepBoth, keepOnlyOther);
+            return true;
+        }
+        if (representation == SetRepresentation::BITSET &&
+            other.representation == SetRepresentation::BITSET &&
+            BitsetSet<T>::combinedSpan(bitmap, other.bitmap) <= maxBitsetSpan(size() + other.size()))
+        {
+            result.representation = SetRepresentation::BITSET;
+            result.bitmap = BitsetSet<T>::combine(bitmap, other.bitmap,
+                                                  keepOnlyThis, keepBoth, keepOnlyOther);
+            return true;
+        }
+    }
+    if constexpr (IsOrderable<T>::value)
+    {
+        // Two ascending operands of comparable size: one linear merge beats
+        // probing the larger one for every element of the smaller one
+        size_t smaller = std::min(this->size(), other.size());
+        size_t larger = std::max(this->size(), other.size());
+        if (isOrderedRepresentation(representation) &&
+            isOrderedRepresentation(other.representation) &&
+            larger <= MERGE_MAX_SIZE_RATIO * smaller)
+        {
+            std::vector<T> a = this->getElements();
+            std::vector<T> b = other.getElements();
+            std::vector<T> merged = mergeAscending(a.begin(), a.end(), b.begin(), b.end(),
+                                                   keepOnlyThis, keepBoth, keepOnlyOther);
+            SetRepresentation target = derivedRepresentation();
+            if constexpr (BitsetSet<T>::SUPPORTED)
+            {
+                if (target == SetRepresentation::BITSET && !merged.empty() &&
+                    valueSpan(merged.front(), merged.back()) > maxBitsetSpan(merged.size()))
+                {
+                    target = SetRepresentation::TREE;
+                }
+            }
+            result.useRepresentation(target);
+            result.assignElements(merged);
+            return true;
+        }
+    }
+    if constexpr (IsHashable<T>::value)
+    {
+        // Two huge operands of comparable size: inserting one operand's elements
+        // in its table order misses the caches on nearly every element (and
+        // clusters in a hash result), while partitioning streams. An intersection
+        // keeps probing: its batched, prefetched lookups touch only the smaller set
+        size_t smaller = std::min(this->size(), other.size());
+        size_t larger = std::max(this->size(), other.size());
+        SetRepresentation target = derivedRepresentation();
+        if (target != SetRepresentation::VECTOR && (keepOnlyThis || keepOnlyOther) &&
+            smaller * sizeof(T) >= PARTITIONED_MIN_BYTES && larger <= MERGE_MAX_SIZE_RATIO * smaller)
+        {
+            std::vector<T> a = this->getElements();
+            std::vector<T> b = other.getElements();
+            std::vector<T> combined = partitionedCombine<T>(a, b, keepOnlyThis, keepBoth,
+                                                            keepOnlyOther, scheduler);
+            if constexpr (IsOrderable<T>::value)
+            {
+                if (isOrderedRepresentation(target))
+                {
+                    sortValues(combined, scheduler);
+                }
+            }
+            if constexpr (BitsetSet<T>::SUPPORTED)
+            {
+                if (target == SetRepresentation::BITSET && !combined.empty() &&
+                    valueSpan(combined.front(), combined.back()) > maxBitsetSpan(combined.size()))
+                {
+                    target = SetRepresentation::TREE;
+                }
+            }
+            result.useRepresentation(target);
+            result.assignElements(combined);
+            return true;
+        }
+    }
+    return false;
+}
 
-    DataSet<std::pair<T, T>> result(this->getName() + " × " + other.getName());
-    // TODO #11: Implementar la operación producto cartesiano (cartesianProductWith)
-    // Esta función debe retornar un nuevo conjunto que represente el producto cartesiano
-    // A × B, es decir, el conjunto de todos los pares ordenados (a, b) donde
-    // a pertenece al conjunto actual (`this`) y b pertenece al conjunto `other`.
-    //
-    // No se deben modificar los conjuntos originales.
-    // El resultado debe incluir todos los pares posibles del producto A × B.
+/**
+ * @brief Returns the power set (set of all subsets) of the current set.
+ * @return The compact power set.
+ */
+template <typename T>
+PowerSet<T> DataSet<T>::powerSet() const
+{
+    return PowerSet<T>(*this);
+}
 
+/**
+ * @brief Returns the Cartesian product of this set with another.
+ * @param other The other set to combine with.
+ * @return A DataSet<std::pair<T, T>> representing the Cartesian product.
+ */
+template <typename T>
+DataSet<std::pair<T, T>> DataSet<T>::cartesianProductWith(const DataSet<T> &other) const
+{
+    DataSet<std::pair<T, T>> result(SetName::combine(name, " × ", other.name));
+    if constexpr (IsOrderable<std::pair<T, T>>::value)
+    {
+        // |A| * |B| inserts: keep each one O(log n)
+        result.useRepresentation(SetRepresentation::TREE);
+    }
+    for (const std::pair<T, T> &pair : this->pairsWith(other))
+    {
+        result.insert(pair);
+    }
     return result;
 }
 
+/**
+ * @brief Enumerates the Cartesian product lazily: (a, b) for every a of this
+ *        set and every b of other, in values() order. Both sets must outlive
+ *        the generator.
+ * @param other The right-hand set.
+ * @return A generator of pairs.
+ */
+template <typename T>
+Generator<std::pair<T, T>> DataSet<T>::pairsWith(const DataSet<T> &other) const
+{
+    for (const T &a : this->values())
+    {
+        for (const T &b : other.values())
+        {
+            co_yield std::pair<T, T>(a, b);
+        }
+    }
+}
+
+/**
+ * @brief Appends a binary image of the set to out. Layout (native byte order):
+ *        uint64 name length, name bytes, uint8 representation, uint64 count,
+ *        then count values of T, or count runs (lo, hi) for an INTERVAL set.
+ * @param out Buffer the image is appended to.
+ * @throws std::runtime_error if T is not trivially copyable.
+ */
+template <typename T>
+void DataSet<T>::appendSnapshot(std::string &out) const
+{
+    if constexpr (!std::is_trivially_copyable<T>::value)
+    {
+        throw std::runtime_error("Set '" + name.str() + "' cannot be stored in a snapshot.");
+    }
+    else
+    {
+        auto put = [&out](const void *bytes, size_t length)
+        { out.append(static_cast<const char *>(bytes), length); };
+
+        std::string text = name.str();
+        uint64_t nameLength = text.size();
+        uint8_t layout = static_cast<uint8_t>(representation);
+        put(&nameLength, sizeof(nameLength));
+        put(text.data(), text.size());
+        put(&layout, sizeof(layout));
+
+        if constexpr (IntervalSet<T>::SUPPORTED)
+        {
+            if (representation == SetRepresentation::INTERVAL)
+            {
+                const std::vector<typename IntervalSet<T>::Run> &runs = intervals.getRuns();
+                uint64_t count = runs.size();
+                put(&count, sizeof(count));
+                for (const typename IntervalSet<T>::Run &run : runs)
+                {
+                    put(&run.lo, sizeof(T));
+                    put(&run.hi, sizeof(T));
+                }
+                return;
+            }
+        }
+
+        // A VECTOR set is written in place; the other layouts are listed first
+        std::vector<T> listed;
+        const std::vector<T> *values = &elements;
+        if (representation != SetRepresentation::VECTOR)
+        {
+            listed = this->getElements();
+            values = &listed;
+        }
+        uint64_t count = values->size();
+        put(&count, sizeof(count));
+        put(values->data(), values->size() * sizeof(T));
+    }
+}
+
+/**
+ * @brief Rebuilds a set from an image written by appendSnapshot().
+ * @param cursor Start of the image; moved past it on success.
+ * @param end End of the readable bytes.
+ * @return The restored set.
+ * @throws std::runtime_error if the image is truncated or malformed.
+ */
+template <typename T>
+DataSet<T> DataSet<T>::readSnapshot(const char *&cursor, const char *end)
+{
+    if constexpr (!std::is_trivially_copyable<T>::value)
+    {
+        throw std::runtime_error("Sets of this element type cannot be read from a snapshot.");
+    }
+    else
+    {
+        const char *next = cursor;
+        auto take = [&next, end](uint64_t length)
+        {
+            if (static_cast<uint64_t>(end - next) < length)
+            {
+                throw std::runtime_error("Set snapshot is truncated.");
+            }
+            const char *bytes = next;
+            next += length;
+            return bytes;
+        };
+
+        uint64_t nameLength;
+        std::memcpy(&nameLength, take(sizeof(nameLength)), sizeof(nameLength));
+        DataSet<T> set(std::string(take(nameLength), nameLength));
+        uint8_t layout;
+        std::memcpy(&layout, take(sizeof(layout)), sizeof(layout));
+        if (layout > static_cast<uint8_t>(SetRepresentation::BITSET))
+        {
+            throw std::runtime_error("Set snapshot has an unknown representation.");
+        }
+        uint64_t count;
+        std::memcpy(&count, take(sizeof(count)), sizeof(count));
+        set.useRepresentation(static_cast<SetRepresentation>(layout)); // Still empty: no copy
+
+        if constexpr (IntervalSet<T>::SUPPORTED)
+        {
+            if (set.representation == SetRepresentation::INTERVAL)
+            {
+                if (count > static_cast<uint64_t>(end - next) / (2 * sizeof(T)))
+                {
+                    throw std::runtime_error("Set snapshot is truncated.");
+                }
+                const char *bytes = take(count * 2 * sizeof(T));
+                T previous{};
+                for (uint64_t i = 0; i < count; ++i)
+                {
+                    T lo;
+                    T hi;
+                    std::memcpy(&lo, bytes + (2 * i) * sizeof(T), sizeof(T));
+                    std::memcpy(&hi, bytes + (2 * i + 1) * sizeof(T), sizeof(T));
+                    // Runs are written sorted, disjoint and non-adjacent (hi + 1 < next.lo)
+                    if (hi < lo || (i > 0 && !(previous < lo && previous + 1 < lo)))
+                    {
+                        throw std::runtime_error("Set snapshot has unordered or overlapping runs.");
+                    }
+                    set.intervals.insertRange(lo, hi);
+                    previous = hi;
+                }
+                cursor = next;
+                return set;
+            }
+        }
+
+        if (count > static_cast<uint64_t>(end - next) / sizeof(T))
+        {
+            throw std::runtime_error("Set snapshot is truncated.");
+        }
+        std::vector<T> values(count);
+        const char *bytes = take(count * sizeof(T));
+        if (count > 0)
+        {
+            std::memcpy(values.data(), bytes, count * sizeof(T));
+        }
+        if constexpr (IsOrderable<T>::value)
+        {
+            // The ordered layouts are built assuming strictly ascending input
+            if (isOrderedRepresentation(set.representation) &&
+                std::adjacent_find(values.begin(), values.end(),
+                                   [](const T &a, const T &b)
+                                   { return !(a < b); }) != values.end())
+            {
+                throw std::runtime_error("Set snapshot lists elements out of order.");
+            }
+        }
+        set.assignElements(values);
+        cursor = next;
+        return set;
+    }
+}
+
 /**
  * @brief Equality operator for DataSet<T>.
  *        Two sets are equal if they have the same elements (ignoring order).
@@ -4,40 +4,102 @@
 // Date:        2025-07-27
 // Description: Declaration of the class DataSetCollection<T>, which stores and manages
 //              multiple named DataSet<T> instances using a linear structure (std::deque).
+//              Names are resolved through a hash index that accepts std::string_view
+//              keys directly, so looking a set up never copies or allocates its name.
+//
+//              With a memory budget, the least recently used sets are written to a
+//              spill file whenever the resident sets would exceed it, and are
+//              read back on their next access. Callers never see the difference
+//              except in speed.
 //
 //              Supported operations:
 //              ----------------------------------------------------------------------
 //              void addSet(const DataSet<T>& set)
 //                  Adds a new named set to the collection.
 //
-//              bool hasSet(const std::string& name) const
+//              void addSets(std::vector<DataSet<T>> sets)
+//                  Adds a batch of named sets, moving them in under one lock.
+//
+//              bool hasSet(std::string_view name) const
 //                  Checks if a set with the given name exists.
 //
-//              void insertInto(const std::string& name, const T& value)
-//                  Inserts a value into the named set.
+//              void insertInto(std::string_view name, const T& value)
+//                  Inserts a value into the named set. Sets that keep growing through
+//                  insertInto are moved to the B+-tree representation automatically.
 //
-//              DataSet<T> getSet(const std::string& name) const
+//              DataSet<T> getSet(std::string_view name) const
 //                  Returns a copy of the named set.
 //
-//              void printSet(const std::string& name) const
+//              const DataSet<T>& viewSet(std::string_view name) const
+//                  Returns the named set itself, read-only (e.g. for generators).
+//                  Under a memory budget any later access may evict it and
+//                  invalidate the reference; shareSet() pins it instead.
+//
+//              std::shared_ptr<const DataSet<T>> shareSet(std::string_view name) const
+//                  Same, but keeps the set in memory for as long as the pointer lives.
+//
+//              void printSet(std::string_view name, std::ostream& os) const
 //                  Prints the contents of the named set.
 //
 //              std::vector<std::string> getSetNames() const
 //                  Returns a list of all registered set names.
 //
-//              DataSet<T> operate(const std::string& nameA,
-//                                  const std::string& op,
-//                                  const std::string& nameB) const
+//              void freezeAll()
+//                  Converts every large set to the read-only FROZEN layout, or to
+//                  the INTERVAL layout when it consists of long runs.
+//
+//              void setAdaptive(bool enable)
+//                  Lets every set of the collection choose its own representation.
+//
+//              void setScheduler(TaskScheduler* pool)
+//                  Runs freezeAll and large set operations on a work-stealing pool.
+//
+//              void setAdmissionControl(const AdmissionControl& control)
+//                  Refuses operate/operateUnarySet/cartesianProduct calls whose
+//                  estimated result exceeds the given limits.
+//
+//              void setMemoryBudget(size_t bytes, const std::string& spillPath)
+//                  Keeps at most `bytes` of sets in memory; colder ones are spilled.
+//
+//              MemoryStats getMemoryStats() const
+//                  Returns resident/spilled counts and the hit, miss and eviction counters.
+//
+//              DataSet<T>::Stats getStats(std::string_view name) const
+//                  Returns the statistics and representation of the named set.
+//
+//              SetStatistics<T> getStatistics(std::string_view name) const
+//              std::vector<CatalogEntry> getCatalog() const
+//                  The statistics block of one set, or of every set (catalog);
+//                  spilled sets answer without being read back.
+//
+//              void containsMany(std::string_view name, std::span<const T> keys,
+//                                std::vector<bool>& out) const
+//                  Checks several values for membership in the named set.
+//
+//              DataSet<T> operate(std::string_view nameA,
+//                                  std::string_view op,
+//                                  std::string_view nameB) const
 //                  Executes a binary set operation between two named sets.
 // ===================================================================================
 
 #ifndef DATASETCOLLECTION_H
 #define DATASETCOLLECTION_H
 
+#include <cstdint>
 #include <deque>
+#include <fstream>
+#include <functional> // For std::equal_to<>, std::hash
+#include <list>
+#include <memory>
+#include <mutex>
+#include <span>
 #include <string>
+#include <string_view>
+#include <unordered_map>
 #include <vector>
+#include "CostEstimator.h"
 #include "DataSet.h"
+#include "PowerSet.h"
 
 /**
  * @class DataSetCollection
@@ -50,21 +112,159 @@ template <typename T>
 class DataSetCollection
 {
 private:
-    std::deque<DataSet<T>> sets; ///< Linear storage of DataSet<T> objects.
+    /**
+     * @brief Transparent string hash: std::string and std::string_view keys
+     *        hash alike, which enables lookups by view (C++20 heterogeneous lookup).
+     */
+    struct NameHash
+    {
+        using is_transparent = void;
+        size_t operator()(std::string_view name) const
+        {
+            return std::hash<std::string_view>{}(name);
+        }
+    };
+
+    /**
+     * @brief One named set. Under a memory budget a cold set lives only in the
+     *        spill file (set == nullptr) until it is accessed again. Residency
+     *        fields change on const accesses and are guarded by Spill::mutex.
+     */
+    struct Slot
+    {
+        std::string name;                        ///< Name (known while spilled too).
+        mutable std::shared_ptr<DataSet<T>> set; ///< The set, or nullptr while spilled.
+        mutable size_t footprint = 0;            ///< memoryUsage() when last measured.
+        mutable typename std::list<const Slot *>::iterator
+            recency;                             ///< Its entry in Spill::recency while resident.
+        mutable uint64_t imageOffset = 0;        ///< Position of its image in the spill file.
+        mutable uint64_t imageLength = 0;        ///< Bytes of that image (0: none yet).
+        mutable bool imageCurrent = false;       ///< Whether the image matches the set.
+        mutable SetStatistics<T> statistics;     ///< Statistics when it was last spilled.
+    };
+
+    /**
+     * @brief Spill file and bookkeeping of the memory budget.
+     */
+    struct Spill
+    {
+        std::mutex mutex;         ///< Guards everything below and the Slot residency fields.
+        std::string path;         ///< Spill file (empty: none open).
+        std::fstream file;        ///< Open spill file.
+        uint64_t end = 0;         ///< Bytes written to the file so far.
+        std::list<const Slot *>
+            recency;              ///< Resident sets, least recently used first.
+        size_t residentBytes = 0; ///< Sum of the footprints of the resident sets.
+        size_t hits = 0;          ///< Accesses that found the set in memory.
+        size_t misses = 0;        ///< Accesses that read the set back from the file.
+        size_t evictions = 0;     ///< Sets dropped from memory.
+    };
+
+    std::deque<Slot> slots;   ///< Linear storage of the named sets.
+    std::unordered_map<std::string, size_t, NameHash, std::equal_to<>>
+        positions;            ///< Index of every set in `slots`, by name.
+    bool adaptive;            ///< Whether sets choose their own representation.
+    TaskScheduler *scheduler; ///< Pool for parallel work (nullptr: sequential).
+    size_t memoryBudget;      ///< Bytes of sets kept in memory (0: unlimited).
+    AdmissionControl limits;  ///< Limits on the results of operate() and friends.
+    mutable Spill spill;      ///< Spill file and LRU state (used when memoryBudget > 0).
+
+    /// Size at which a VECTOR set receiving insertInto calls is converted to TREE.
+    static constexpr size_t TREE_PROMOTION_THRESHOLD = 256;
+
+    /// Minimum size for freezeAll() to convert a set; smaller sets stay VECTOR.
+    static constexpr size_t FREEZE_MIN_SIZE = 64;
 
     /**
-     * @brief Returns the position index of a set by name.
+     * @brief Returns the position index of a set by name (hash lookup, O(1)).
      * @param name Name to search.
      * @return Index of the set in the deque, or -1 if not found.
      */
-    int findIndexByName(const std::string &name) const;
+    int findIndexByName(std::string_view name) const;
+
+    /**
+     * @brief Returns a set, reloading it if it was spilled, and marks it as recently used.
+     */
+    std::shared_ptr<DataSet<T>> acquire(size_t index) const;
+
+    /**
+     * @brief Returns a set for one operation; `pinned` keeps it resident under a budget.
+     */
+    DataSet<T> &pin(size_t index, std::shared_ptr<DataSet<T>> &pinned) const;
+
+    /**
+     * @brief Marks a set as modified: its spilled image is stale and its footprint is remeasured.
+     */
+    void noteChanged(size_t index);
+
+    /**
+     * @brief Moves a resident set to the most recently used end of Spill::recency.
+     */
+    void markUsed(const Slot &slot) const;
+
+    /**
+     * @brief Evicts least recently used sets until the resident ones fit the budget.
+     */
+    void enforceBudget(size_t keep) const;
+
+    /**
+     * @brief Drops a set from memory, writing its image to the spill file if needed.
+     */
+    void spillOut(const Slot &slot) const;
+
+    /**
+     * @brief Reads an evicted set back from the spill file.
+     */
+    void loadBack(const Slot &slot) const;
+
+    /**
+     * @brief Closes and deletes the spill file.
+     */
+    void closeSpillFile();
+
+    /**
+     * @brief Statistics of a slot's set, kept in the slot while the set is spilled.
+     */
+    SetStatistics<T> statisticsOf(const Slot &slot) const;
 
 public:
+    /**
+     * @brief Statistics of the memory budget (see setMemoryBudget).
+     */
+    struct MemoryStats
+    {
+        size_t budget;        ///< Configured budget in bytes (0: unlimited).
+        size_t residentBytes; ///< Estimated bytes of the sets in memory.
+        size_t residentSets;  ///< Sets currently in memory.
+        size_t spilledSets;   ///< Sets currently only in the spill file.
+        size_t hits;          ///< Accesses that found their set in memory.
+        size_t misses;        ///< Accesses that read their set back from the spill file.
+        size_t evictions;     ///< Sets dropped from memory to respect the budget.
+    };
+
+    /**
+     * @brief One row of the catalog (see getCatalog).
+     */
+    struct CatalogEntry
+    {
+        std::string name;            ///< Name of the set.
+        SetStatistics<T> statistics; ///< Its statistics block.
+    };
+
     /**
      * @brief Default constructor.
      */
     DataSetCollection();
 
+    /**
+     * @brief Closes and deletes the spill file, if any.
+     */
+    ~DataSetCollection();
+
+    /// Not copyable: the sets may live in a spill file owned by the collection.
+    DataSetCollection(const DataSetCollection &) = delete;
+    DataSetCollection &operator=(const DataSetCollection &) = delete;
+
     /**
      * @brief Adds a new DataSet<T> to the collection.
      *        If a set with the same name already exists, it is overwritten.
@@ -72,19 +272,31 @@ public:
      */
     void addSet(const DataSet<T> &set);
 
+    /**
+     * @brief Adds many sets, as addSet() would one by one in order, but moves
+     *        them in instead of copying them and takes the memory-budget lock
+     *        once; the budget is enforced after the last set.
+     * @param sets Named DataSet<T> instances (consumed).
+     */
+    void addSets(std::vector<DataSet<T>> sets);
+
     /**
      * @brief Checks if a set with the given name exists in the collection.
      * @param name Name to search.
      * @return True if found, false otherwise.
      */
-    bool hasSet(const std::string &name) const;
+    bool hasSet(std::string_view name) const;
 
     /**
      * @brief Inserts a value into a specific named set.
+     *        Once a VECTOR set reaches TREE_PROMOTION_THRESHOLD elements it is
+     *        converted to TREE so further inserts cost O(log n) (orderable T only,
+     *        non-adaptive sets).
+     *        Several threads may insert into the same HASH set concurrently.
      * @param name Name of the set.
      * @param value Value to insert.
      */
-    void insertInto(const std::string &name, const T &value);
+    void insertInto(std::string_view name, const T &value);
 
     /**
      * @brief Retrieves a copy of a set by name.
@@ -92,13 +304,36 @@ public:
      * @return A copy of the DataSet<T> with that name.
      * @throws std::runtime_error if not found.
      */
-    DataSet<T> getSet(const std::string &name) const;
+    DataSet<T> getSet(std::string_view name) const;
+
+    /**
+     * @brief Returns a read-only reference to a named set, without copying it.
+     *        The reference stays valid while the collection exists; the set's
+     *        contents change if it is overwritten or inserted into. Under a
+     *        memory budget it is only valid until the set is evicted, which
+     *        any later access to another set (from any thread) may cause, so
+     *        use shareSet() there.
+     * @param name Name of the set.
+     * @return The stored DataSet<T>.
+     * @throws std::runtime_error if not found.
+     */
+    const DataSet<T> &viewSet(std::string_view name) const;
+
+    /**
+     * @brief Returns a named set without copying it, pinned in memory: a set
+     *        is never evicted while a pointer returned here is alive.
+     * @param name Name of the set.
+     * @return Shared pointer to the stored DataSet<T>.
+     * @throws std::runtime_error if not found.
+     */
+    std::shared_ptr<const DataSet<T>> shareSet(std::string_view name) const;
 
     /**
      * @brief Prints the contents of a named set.
      * @param name Name of the set to print.
+     * @param os Output stream (defaults to std::cout).
      */
-    void printSet(const std::string &name) const;
+    void printSet(std::string_view name, std::ostream &os = std::cout) const;
 
     /**
      * @brief Returns the list of all set names in the collection.
@@ -106,36 +341,140 @@ public:
      */
     std::vector<std::string> getSetNames() const;
 
+    /**
+     * @brief Converts every set with at least FREEZE_MIN_SIZE elements to the
+     *        read-only FROZEN layout (orderable T only). Intended for the end of
+     *        the loading phase; a later insertInto thaws the set to TREE.
+     *        Integer sets whose runs of consecutive values average at least
+     *        DataSet<T>::INTERVAL_MIN_RUN_LENGTH elements switch to INTERVAL
+     *        instead; sets already stored as INTERVAL are left as they are.
+     *        In adaptive mode the loading phase is over, so every set forgets
+     *        its insert counts and re-plans for a read-mostly workload instead.
+     */
+    void freezeAll();
+
+    /**
+     * @brief Enables or disables adaptive mode for every current and future set.
+     *        Adaptive sets are not promoted by insertInto or frozen by freezeAll;
+     *        they follow their own cost model (see DataSet<T>::adapt).
+     * @param enable True to enable.
+     */
+    void setAdaptive(bool enable);
+
+    /**
+     * @brief Sets the pool used by freezeAll() (one task per set) and by the
+     *        set operations of large sets in operate(). The collection does
+     *        not own the pool.
+     * @param pool Scheduler to use, or nullptr to run everything sequentially.
+     */
+    void setScheduler(TaskScheduler *pool);
+
+    /**
+     * @brief Sets the limits checked by operate(), operateUnarySet() and
+     *        cartesianProduct() before they build a result (see CostEstimator.h).
+     *        Those results are materialized, so a call beyond a limit throws
+     *        whatever the configured action; streaming callers should consult
+     *        AdmissionControl::admit themselves.
+     * @param control Limits to apply (a default AdmissionControl removes them).
+     */
+    void setAdmissionControl(const AdmissionControl &control);
+
+    /**
+     * @brief Limits the estimated bytes of sets held in memory (see
+     *        DataSet<T>::memoryUsage). When an access or insert leaves the
+     *        resident sets above the budget, the least recently used sets
+     *        that nobody holds (see shareSet) are written to the spill file and
+     *        dropped; an unchanged set is written only once. The next access
+     *        reads a spilled set back. Lookups of a spilled set pay one read
+     *        of its image, and sets in use may keep memory above the budget.
+     *        Changing the budget first reloads every spilled set and starts a
+     *        new spill file; a budget of 0 switches spilling off. Stale images
+     *        are not compacted while a spill file is in use.
+     * @param bytes Budget in bytes, or 0 for unlimited.
+     * @param spillPath File to spill to (created or truncated; deleted with the
+     *        collection). Ignored when bytes is 0.
+     * @throws std::runtime_error if the spill file cannot be created, or if T
+     *         cannot be stored in a snapshot (see DataSet<T>::appendSnapshot).
+     */
+    void setMemoryBudget(size_t bytes, const std::string &spillPath);
+
+    /**
+     * @brief Returns the state of the memory budget. Hits and misses are only
+     *        counted while a budget is set.
+     * @return A MemoryStats snapshot.
+     */
+    MemoryStats getMemoryStats() const;
+
+    /**
+     * @brief Returns the statistics and representation of a named set.
+     * @param name Name of the set.
+     * @return The set's DataSet<T>::Stats.
+     * @throws std::runtime_error if not found.
+     */
+    typename DataSet<T>::Stats getStats(std::string_view name) const;
+
+    /**
+     * @brief Returns the statistics block of a named set (see
+     *        DataSet<T>::statistics). A spilled set is not read back: it
+     *        answers with the statistics it had when it was evicted, which are
+     *        still exact since a spilled set cannot change. Reading the
+     *        catalog does not count as an access for the memory budget.
+     * @param name Name of the set.
+     * @return A copy of the statistics.
+     * @throws std::runtime_error if not found.
+     */
+    SetStatistics<T> getStatistics(std::string_view name) const;
+
+    /**
+     * @brief Returns the statistics block of every set, in insertion order.
+     * @return One CatalogEntry per set.
+     */
+    std::vector<CatalogEntry> getCatalog() const;
+
+    /**
+     * @brief Checks several values for membership in a named set in one batch.
+     * @param name Name of the set.
+     * @param keys Values to look up.
+     * @param out Receives one flag per key.
+     * @throws std::runtime_error if not found.
+     */
+    void containsMany(std::string_view name, std::span<const T> keys,
+                      std::vector<bool> &out) const;
+
     /**
      * @brief Executes an operation between two sets (by name).
      * @param nameA First set name.
      * @param op Operation name ("union", "intersection", etc.)
      * @param nameB Second set name.
      * @return Resulting DataSet<T> from the operation.
-     * @throws std::runtime_error if sets or operation are invalid.
+     * @throws std::runtime_error if sets or operation are invalid, or if the
+     *         result would exceed the admission limits.
      */
-    DataSet<T> operate(const std::string &nameA,
-                       const std::string &op,
-                       const std::string &nameB) const;
+    DataSet<T> operate(std::string_view nameA,
+                       std::string_view op,
+                       std::string_view nameB) const;
 
     /**
      * @brief Executes a unary operation on a named set.
      *        Supported: "powerset"
      * @param name Name of the target set.
      * @param op Operation to execute.
-     * @return Resulting DataSet<DataSet<T>> (for powerset).
+     * @return The compact power set (for powerset).
+     * @throws std::runtime_error if the set or operation is invalid, or if the
+     *         2^n subsets would exceed the admission limits.
      */
-    DataSet<DataSet<T>> operateUnarySet(const std::string &name,
-                                        const std::string &op) const;
+    PowerSet<T> operateUnarySet(std::string_view name, std::string_view op) const;
 
     /**
      * @brief Executes a Cartesian product between two sets.
      * @param nameA First set name.
      * @param nameB Second set name.
      * @return A DataSet<std::pair<T, T>> representing A × B.
+     * @throws std::runtime_error if a set is missing, or if the n·m pairs
+     *         would exceed the admission limits.
      */
-    DataSet<std::pair<T, T>> cartesianProduct(const std::string &nameA,
-                                              const std::string &nameB) const;
+    DataSet<std::pair<T, T>> cartesianProduct(std::string_view nameA,
+                                              std::string_view nameB) const;
 };
 
 #include "DataSetCollection.hxx"
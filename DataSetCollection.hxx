@@ -2,8 +2,9 @@
 // File:        DataSetCollection.hxx
 // Author:      Alejandro Castro
 // Date:        2025-07-27
-// Description: Implementation of the class DataSetCollection<T>, using a deque
-//              to store named sets and allowing linear access and manipulation.
+// Description: Implementation of the class DataSetCollection<T>. Sets live in
+//              a deque; names are looked up through a transparent hash index
+//              over it, and spilled sets are read back on access.
 // ===================================================================================
 
 #ifndef DATASETCOLLECTION_HXX
@@ -12,32 +13,225 @@
 #include "DataSetCollection.h"
 #include <stdexcept>
 #include <iostream>
+#include <filesystem>  // For std::filesystem::remove
+#include <type_traits> // For std::is_trivially_copyable
+#include <utility>     // For std::move
 
 /**
  * @brief Default constructor.
  */
 template <typename T>
-DataSetCollection<T>::DataSetCollection() : sets()
+DataSetCollection<T>::DataSetCollection()
+    : slots(), positions(), adaptive(false), scheduler(nullptr), memoryBudget(0), limits(), spill()
 {
     // No initialization needed; deque starts empty.
 }
 
 /**
- * @brief Returns the position index of a set by name.
+ * @brief Closes and deletes the spill file, if any.
+ */
+template <typename T>
+DataSetCollection<T>::~DataSetCollection()
+{
+    closeSpillFile();
+}
+
+/**
+ * @brief Returns the position index of a set by name (hash lookup, O(1)).
  * @param name Name to search.
  * @return Index of the set in the deque, or -1 if not found.
  */
 template <typename T>
-int DataSetCollection<T>::findIndexByName(const std::string &name) const
+int DataSetCollection<T>::findIndexByName(std::string_view name) const
 {
-    for (size_t i = 0; i < sets.size(); ++i)
+    auto found = positions.find(name); // Heterogeneous: no std::string is built
+    return found == positions.end() ? -1 : static_cast<int>(found->second);
+}
+
+/**
+ * @brief Returns a set, reading it back from the spill file if it was evicted,
+ *        and marks it as the most recently used (memory budget only).
+ * @param index Position of the set.
+ * @return The set; holding the pointer keeps it in memory.
+ * @throws std::runtime_error if the spill file cannot be read.
+ */
+template <typename T>
+std::shared_ptr<DataSet<T>> DataSetCollection<T>::acquire(size_t index) const
+{
+    std::lock_guard<std::mutex> lock(spill.mutex);
+    const Slot &slot = slots[index];
+    if (slot.set)
+    {
+        ++spill.hits;
+        // Re-measure: e.g. print() caches text without the collection knowing
+        spill.residentBytes -= slot.footprint;
+        slot.footprint = slot.set->memoryUsage();
+        spill.residentBytes += slot.footprint;
+        markUsed(slot);
+    }
+    else
+    {
+        loadBack(slot);
+    }
+    std::shared_ptr<DataSet<T>> pinned = slot.set;
+    enforceBudget(index);
+    return pinned;
+}
+
+/**
+ * @brief Returns a set for the duration of one operation. Without a budget
+ *        this is a plain reference; with one, `pinned` keeps the set resident.
+ */
+template <typename T>
+DataSet<T> &DataSetCollection<T>::pin(size_t index, std::shared_ptr<DataSet<T>> &pinned) const
+{
+    if (memoryBudget == 0)
+    {
+        return *slots[index].set;
+    }
+    pinned = acquire(index);
+    return *pinned;
+}
+
+/**
+ * @brief Records that a set was modified: its spilled image is stale and its
+ *        footprint is measured again (memory budget only).
+ */
+template <typename T>
+void DataSetCollection<T>::noteChanged(size_t index)
+{
+    if (memoryBudget == 0)
+    {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(spill.mutex);
+    const Slot &slot = slots[index];
+    slot.imageCurrent = false;
+    if (slot.set)
     {
-        if (sets[i].getName() == name)
+        spill.residentBytes -= slot.footprint;
+        slot.footprint = slot.set->memoryUsage();
+        spill.residentBytes += slot.footprint;
+    }
+    enforceBudget(index);
+}
+
+/**
+ * @brief Moves a resident set to the back (most recently used end) of the
+ *        LRU list in O(1). Caller holds spill.mutex.
+ */
+template <typename T>
+void DataSetCollection<T>::markUsed(const Slot &slot) const
+{
+    spill.recency.splice(spill.recency.end(), spill.recency, slot.recency);
+}
+
+/**
+ * @brief Evicts least recently used sets until the resident ones fit the
+ *        budget, walking the LRU list from its front. Sets somebody holds,
+ *        and the set at `keep`, are skipped. Caller holds spill.mutex.
+ * @param keep Position of the set being accessed (or any invalid index).
+ */
+template <typename T>
+void DataSetCollection<T>::enforceBudget(size_t keep) const
+{
+    const Slot *exempt = keep < slots.size() ? &slots[keep] : nullptr;
+    while (spill.residentBytes > memoryBudget)
+    {
+        typename std::list<const Slot *>::iterator victim = spill.recency.begin();
+        // use_count() is exact here: new holders need the mutex we hold
+        while (victim != spill.recency.end() &&
+               (*victim == exempt || (*victim)->set.use_count() != 1))
+        {
+            ++victim;
+        }
+        if (victim == spill.recency.end())
+        {
+            return; // Everything still resident is in use
+        }
+        spillOut(**victim);
+    }
+}
+
+/**
+ * @brief Drops a set from memory, first writing its image unless the spill
+ *        file already holds an up-to-date one. A new image overwrites the old
+ *        one when it fits, otherwise it is appended. Caller holds spill.mutex.
+ * @throws std::runtime_error if the spill file cannot be written.
+ */
+template <typename T>
+void DataSetCollection<T>::spillOut(const Slot &slot) const
+{
+    if (!slot.imageCurrent)
+    {
+        std::string image;
+        slot.set->appendSnapshot(image);
+        uint64_t offset = image.size() <= slot.imageLength ? slot.imageOffset : spill.end;
+        spill.file.clear();
+        spill.file.seekp(static_cast<std::streamoff>(offset));
+        spill.file.write(image.data(), static_cast<std::streamsize>(image.size()));
+        if (!spill.file)
         {
-            return static_cast<int>(i);
+            throw std::runtime_error("Cannot spill set '" + slot.name + "' to '" + spill.path + "'.");
         }
+        if (offset == spill.end)
+        {
+            spill.end += image.size();
+        }
+        slot.imageOffset = offset;
+        slot.imageLength = image.size();
+        slot.imageCurrent = true;
+    }
+    slot.statistics = slot.set->statistics(); // Kept for the catalog
+    slot.set.reset();
+    spill.recency.erase(slot.recency);
+    spill.residentBytes -= slot.footprint;
+    ++spill.evictions;
+}
+
+/**
+ * @brief Reads an evicted set back from the spill file. Caller holds spill.mutex.
+ * @throws std::runtime_error if the image cannot be read.
+ */
+template <typename T>
+void DataSetCollection<T>::loadBack(const Slot &slot) const
+{
+    std::string image(slot.imageLength, '\0');
+    spill.file.clear();
+    spill.file.seekg(static_cast<std::streamoff>(slot.imageOffset));
+    spill.file.read(image.data(), static_cast<std::streamsize>(image.size()));
+    if (!spill.file)
+    {
+        throw std::runtime_error("Cannot reload set '" + slot.name + "' from '" + spill.path + "'.");
+    }
+    const char *cursor = image.data();
+    slot.set = std::make_shared<DataSet<T>>(
+        DataSet<T>::readSnapshot(cursor, image.data() + image.size()));
+    slot.recency = spill.recency.insert(spill.recency.end(), &slot);
+    if (adaptive)
+    {
+        slot.set->setAdaptive(true); // Workload counters restart after a reload
+    }
+    slot.footprint = slot.set->memoryUsage();
+    spill.residentBytes += slot.footprint;
+    ++spill.misses;
+}
+
+/**
+ * @brief Closes and deletes the current spill file (every set must be resident).
+ */
+template <typename T>
+void DataSetCollection<T>::closeSpillFile()
+{
+    if (spill.path.empty())
+    {
+        return;
     }
-    return -1;
+    spill.file.close();
+    std::error_code ignored;
+    std::filesystem::remove(spill.path, ignored);
+    spill.path.clear();
+    spill.end = 0;
 }
 
 /**
@@ -48,14 +242,100 @@ int DataSetCollection<T>::findIndexByName(const std::string &name) const
 template <typename T>
 void DataSetCollection<T>::addSet(const DataSet<T> &set)
 {
-    int index = findIndexByName(set.getName());
-    if (index != -1)
+    std::string name = set.getName();
+    int index = findIndexByName(name);
+    if (index == -1)
     {
-        sets[index] = set; // Overwrite existing set
+        slots.emplace_back(); // Add new set
+        slots.back().name = name;
+        index = static_cast<int>(slots.size() - 1);
+        positions.emplace(std::move(name), slots.size() - 1);
+    }
+
+    std::lock_guard<std::mutex> lock(spill.mutex);
+    const Slot &slot = slots[index];
+    if (slot.set)
+    {
+        *slot.set = set; // Overwrite in place: references to the set stay valid
+        if (memoryBudget != 0)
+        {
+            spill.residentBytes -= slot.footprint;
+        }
+        markUsed(slot);
     }
     else
     {
-        sets.push_back(set); // Add new set
+        slot.set = std::make_shared<DataSet<T>>(set); // New, or replaces a spilled set
+        slot.recency = spill.recency.insert(spill.recency.end(), &slot);
+    }
+    if (adaptive && !slot.set->isAdaptive())
+    {
+        slot.set->setAdaptive(true);
+    }
+    slot.imageCurrent = false;
+    if (memoryBudget != 0)
+    {
+        slot.footprint = slot.set->memoryUsage();
+        spill.residentBytes += slot.footprint;
+        enforceBudget(index);
+    }
+}
+
+/**
+ * @brief Adds many sets at once, moving them into their slots.
+ * @param sets Named DataSet<T> instances.
+ */
+template <typename T>
+void DataSetCollection<T>::addSets(std::vector<DataSet<T>> sets)
+{
+    std::vector<size_t> indices;
+    indices.reserve(sets.size());
+    for (const DataSet<T> &set : sets)
+    {
+        std::string name = set.getName();
+        int index = findIndexByName(name);
+        if (index == -1)
+        {
+            slots.emplace_back();
+            slots.back().name = name;
+            index = static_cast<int>(slots.size() - 1);
+            positions.emplace(std::move(name), slots.size() - 1);
+        }
+        indices.push_back(static_cast<size_t>(index));
+    }
+
+    std::lock_guard<std::mutex> lock(spill.mutex);
+    for (size_t i = 0; i < sets.size(); ++i)
+    {
+        const Slot &slot = slots[indices[i]];
+        if (slot.set)
+        {
+            *slot.set = std::move(sets[i]);
+            if (memoryBudget != 0)
+            {
+                spill.residentBytes -= slot.footprint;
+            }
+            markUsed(slot);
+        }
+        else
+        {
+            slot.set = std::make_shared<DataSet<T>>(std::move(sets[i]));
+            slot.recency = spill.recency.insert(spill.recency.end(), &slot);
+        }
+        if (adaptive && !slot.set->isAdaptive())
+        {
+            slot.set->setAdaptive(true);
+        }
+        slot.imageCurrent = false;
+        if (memoryBudget != 0)
+        {
+            slot.footprint = slot.set->memoryUsage();
+            spill.residentBytes += slot.footprint;
+        }
+    }
+    if (memoryBudget != 0)
+    {
+        enforceBudget(slots.size()); // No set is exempt
     }
 }
 
@@ -65,33 +345,50 @@ void DataSetCollection<T>::addSet(const DataSet<T> &set)
  * @return True if found, false otherwise.
  */
 template <typename T>
-bool DataSetCollection<T>::hasSet(const std::string &name) const
+bool DataSetCollection<T>::hasSet(std::string_view name) const
 {
     return findIndexByName(name) != -1;
 }
 
 /**
  * @brief Inserts a value into a specific named set.
+ *        Once a VECTOR set reaches TREE_PROMOTION_THRESHOLD elements it is
+ *        converted to TREE so further inserts cost O(log n) (orderable T only,
+ *        non-adaptive sets).
+ *        Several threads may insert into the same HASH set concurrently.
  * @param name Name of the set.
  * @param value Value to insert.
  */
 template <typename T>
-void DataSetCollection<T>::insertInto(const std::string &name, const T &value)
+void DataSetCollection<T>::insertInto(std::string_view name, const T &value)
 {
     int index = findIndexByName(name);
     if (index == -1)
     {
-        throw std::runtime_error("Set '" + name + "' not found.");
+        throw std::runtime_error("Set '" + std::string(name) + "' not found.");
+    }
+    std::shared_ptr<DataSet<T>> pinned;
+    DataSet<T> &set = pin(index, pinned);
+    set.insert(value);
+
+    if constexpr (IsOrderable<T>::value)
+    {
+        if (!set.isAdaptive() && set.getRepresentation() == SetRepresentation::VECTOR &&
+            set.size() >= TREE_PROMOTION_THRESHOLD)
+        {
+            set.useRepresentation(SetRepresentation::TREE);
+        }
     }
-    sets[index].insert(value);
+    noteChanged(index);
 }
 
 /**
  * @brief Prints the contents of a named set.
  * @param name Name of the set to print.
+ * @param os Output stream (defaults to std::cout).
  */
 template <typename T>
-void DataSetCollection<T>::printSet(const std::string &name) const
+void DataSetCollection<T>::printSet(std::string_view name, std::ostream &os) const
 {
     int index = findIndexByName(name);
     if (index == -1)
@@ -99,8 +396,9 @@ void DataSetCollection<T>::printSet(const std::string &name) const
         std::cerr << "Set '" << name << "' not found." << std::endl;
         return;
     }
-    sets[index].print(std::cout);
-    std::cout << std::endl;
+    std::shared_ptr<DataSet<T>> pinned;
+    pin(index, pinned).print(os);
+    os << std::endl;
 }
 
 /**
@@ -110,14 +408,53 @@ void DataSetCollection<T>::printSet(const std::string &name) const
  * @throws std::runtime_error if not found.
  */
 template <typename T>
-DataSet<T> DataSetCollection<T>::getSet(const std::string &name) const
+DataSet<T> DataSetCollection<T>::getSet(std::string_view name) const
+{
+    int index = findIndexByName(name);
+    if (index == -1)
+    {
+        throw std::runtime_error("Set '" + std::string(name) + "' not found.");
+    }
+    std::shared_ptr<DataSet<T>> pinned;
+    return pin(index, pinned);
+}
+
+/**
+ * @brief Returns a read-only reference to a named set, without copying it.
+ *        The reference stays valid while the collection exists; the set's
+ *        contents change if it is overwritten or inserted into. Under a
+ *        memory budget it is only valid until the set is evicted.
+ * @param name Name of the set.
+ * @return The stored DataSet<T>.
+ * @throws std::runtime_error if not found.
+ */
+template <typename T>
+const DataSet<T> &DataSetCollection<T>::viewSet(std::string_view name) const
+{
+    int index = findIndexByName(name);
+    if (index == -1)
+    {
+        throw std::runtime_error("Set '" + std::string(name) + "' not found.");
+    }
+    std::shared_ptr<DataSet<T>> pinned;
+    return pin(index, pinned); // The slot still owns the set after `pinned` goes
+}
+
+/**
+ * @brief Returns a named set without copying it, pinned in memory.
+ * @param name Name of the set.
+ * @return Shared pointer to the stored DataSet<T>.
+ * @throws std::runtime_error if not found.
+ */
+template <typename T>
+std::shared_ptr<const DataSet<T>> DataSetCollection<T>::shareSet(std::string_view name) const
 {
     int index = findIndexByName(name);
     if (index == -1)
     {
-        throw std::runtime_error("Set '" + name + "' not found.");
+        throw std::runtime_error("Set '" + std::string(name) + "' not found.");
     }
-    return sets[index];
+    return memoryBudget == 0 ? slots[index].set : acquire(index);
 }
 
 /**
@@ -128,13 +465,292 @@ template <typename T>
 std::vector<std::string> DataSetCollection<T>::getSetNames() const
 {
     std::vector<std::string> names;
-    for (const DataSet<T> &set : sets)
+    for (const Slot &slot : slots)
     {
-        names.push_back(set.getName());
+        names.push_back(slot.name);
     }
     return names;
 }
 
+/**
+ * @brief Converts every set with at least FREEZE_MIN_SIZE elements to the
+ *        read-only FROZEN layout (orderable T only). Intended for the end of
+ *        the loading phase; a later insertInto thaws the set to TREE.
+ *        Integer sets whose runs of consecutive values average at least
+ *        DataSet<T>::INTERVAL_MIN_RUN_LENGTH elements switch to INTERVAL
+ *        instead; sets already stored as INTERVAL are left as they are.
+ *        In adaptive mode the loading phase is over, so every set forgets
+ *        its insert counts and re-plans for a read-mostly workload instead.
+ */
+template <typename T>
+void DataSetCollection<T>::freezeAll()
+{
+    if constexpr (IsOrderable<T>::value)
+    {
+        auto convert = [](DataSet<T> &set)
+        {
+            if (set.isAdaptive())
+            {
+                set.clearWorkload();
+                set.adapt();
+                return;
+            }
+            if (set.size() < FREEZE_MIN_SIZE ||
+                set.getRepresentation() == SetRepresentation::INTERVAL)
+            {
+                return; // Small, or already stored as runs (never expand those)
+            }
+            if (IntervalSet<T>::SUPPORTED &&
+                set.countRuns() * DataSet<T>::INTERVAL_MIN_RUN_LENGTH <= set.size())
+            {
+                set.useRepresentation(SetRepresentation::INTERVAL);
+            }
+            else
+            {
+                set.freeze();
+            }
+        };
+        if (memoryBudget != 0)
+        {
+            // One set at a time, so that spilled sets are reloaded one by one
+            for (size_t i = 0; i < slots.size(); ++i)
+            {
+                std::shared_ptr<DataSet<T>> pinned;
+                convert(pin(i, pinned));
+                noteChanged(i);
+            }
+        }
+        else if (scheduler != nullptr)
+        {
+            // Sets are independent: one task each, idle threads steal the big ones
+            scheduler->parallelFor(0, slots.size(), 1, [this, &convert](size_t lo, size_t hi)
+                                   {
+                for (size_t i = lo; i < hi; ++i)
+                {
+                    convert(*slots[i].set);
+                } });
+        }
+        else
+        {
+            for (const Slot &slot : slots)
+            {
+                convert(*slot.set);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Enables or disables adaptive mode for every current and future set.
+ *        Adaptive sets are not promoted by insertInto or frozen by freezeAll;
+ *        they follow their own cost model (see DataSet<T>::adapt).
+ * @param enable True to enable.
+ */
+template <typename T>
+void DataSetCollection<T>::setAdaptive(bool enable)
+{
+    adaptive = enable;
+    for (const Slot &slot : slots)
+    {
+        if (slot.set)
+        {
+            slot.set->setAdaptive(enable); // Spilled sets get the flag when reloaded
+        }
+    }
+}
+
+/**
+ * @brief Sets the pool used by freezeAll() (one task per set) and by the
+ *        set operations of large sets in operate(). The collection does not
+ *        own the pool.
+ * @param pool Scheduler to use, or nullptr to run everything sequentially.
+ */
+template <typename T>
+void DataSetCollection<T>::setScheduler(TaskScheduler *pool)
+{
+    scheduler = pool;
+}
+
+/**
+ * @brief Sets the limits checked before a result is materialized.
+ * @param control Limits to apply.
+ */
+template <typename T>
+void DataSetCollection<T>::setAdmissionControl(const AdmissionControl &control)
+{
+    limits = control;
+}
+
+/**
+ * @brief Limits the estimated bytes of sets held in memory; colder sets are
+ *        spilled to a file and read back on their next access.
+ * @param bytes Budget in bytes, or 0 for unlimited.
+ * @param spillPath File to spill to (created or truncated; deleted with the collection).
+ * @throws std::runtime_error if the spill file cannot be created or T cannot be spilled.
+ */
+template <typename T>
+void DataSetCollection<T>::setMemoryBudget(size_t bytes, const std::string &spillPath)
+{
+    if (!std::is_trivially_copyable<T>::value && bytes != 0)
+    {
+        throw std::runtime_error("Sets of this element type cannot be spilled to disk.");
+    }
+    std::lock_guard<std::mutex> lock(spill.mutex);
+
+    // Start over: every set back in memory, then a fresh (or no) spill file
+    for (const Slot &slot : slots)
+    {
+        if (!slot.set)
+        {
+            loadBack(slot);
+        }
+        slot.imageCurrent = false;
+        slot.imageLength = 0;
+    }
+    closeSpillFile();
+    memoryBudget = 0;
+    spill.residentBytes = 0;
+    spill.hits = 0;
+    spill.misses = 0;
+    spill.evictions = 0;
+    if (bytes == 0)
+    {
+        return;
+    }
+
+    spill.file.open(spillPath, std::ios::in | std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!spill.file.is_open())
+    {
+        throw std::runtime_error("Cannot create spill file '" + spillPath + "'.");
+    }
+    spill.path = spillPath;
+    memoryBudget = bytes;
+    for (const Slot &slot : slots)
+    {
+        slot.footprint = slot.set->memoryUsage();
+        spill.residentBytes += slot.footprint;
+    }
+    enforceBudget(slots.size());
+}
+
+/**
+ * @brief Returns the state of the memory budget.
+ * @return A MemoryStats snapshot.
+ */
+template <typename T>
+typename DataSetCollection<T>::MemoryStats DataSetCollection<T>::getMemoryStats() const
+{
+    std::lock_guard<std::mutex> lock(spill.mutex);
+    MemoryStats stats{memoryBudget, spill.residentBytes, 0, 0,
+                      spill.hits, spill.misses, spill.evictions};
+    for (const Slot &slot : slots)
+    {
+        ++(slot.set ? stats.residentSets : stats.spilledSets);
+    }
+    if (memoryBudget == 0)
+    {
+        stats.residentBytes = 0;
+        for (const Slot &slot : slots)
+        {
+            stats.residentBytes += slot.set->memoryUsage(); // Not tracked without a budget
+        }
+    }
+    return stats;
+}
+
+/**
+ * @brief Returns the statistics and representation of a named set.
+ * @param name Name of the set.
+ * @return The set's DataSet<T>::Stats.
+ * @throws std::runtime_error if not found.
+ */
+template <typename T>
+typename DataSet<T>::Stats DataSetCollection<T>::getStats(std::string_view name) const
+{
+    int index = findIndexByName(name);
+    if (index == -1)
+    {
+        throw std::runtime_error("Set '" + std::string(name) + "' not found.");
+    }
+    std::shared_ptr<DataSet<T>> pinned;
+    return pin(index, pinned).getStats();
+}
+
+/**
+ * @brief Statistics of a slot's set, taken from the slot while it is spilled.
+ */
+template <typename T>
+SetStatistics<T> DataSetCollection<T>::statisticsOf(const Slot &slot) const
+{
+    if (memoryBudget == 0)
+    {
+        return slot.set->statistics();
+    }
+    std::shared_ptr<DataSet<T>> resident;
+    {
+        std::lock_guard<std::mutex> lock(spill.mutex);
+        if (!slot.set)
+        {
+            return slot.statistics;
+        }
+        resident = slot.set; // Keeps the set alive once the lock is released
+    }
+    return resident->statistics();
+}
+
+/**
+ * @brief Returns the statistics block of a named set.
+ * @param name Name of the set.
+ * @return A copy of the statistics.
+ * @throws std::runtime_error if not found.
+ */
+template <typename T>
+SetStatistics<T> DataSetCollection<T>::getStatistics(std::string_view name) const
+{
+    int index = findIndexByName(name);
+    if (index == -1)
+    {
+        throw std::runtime_error("Set '" + std::string(name) + "' not found.");
+    }
+    return statisticsOf(slots[index]);
+}
+
+/**
+ * @brief Returns the statistics block of every set.
+ * @return One CatalogEntry per set, in insertion order.
+ */
+template <typename T>
+std::vector<typename DataSetCollection<T>::CatalogEntry> DataSetCollection<T>::getCatalog() const
+{
+    std::vector<CatalogEntry> catalog;
+    catalog.reserve(slots.size());
+    for (const Slot &slot : slots)
+    {
+        catalog.push_back(CatalogEntry{slot.name, statisticsOf(slot)});
+    }
+    return catalog;
+}
+
+/**
+ * @brief Checks several values for membership in a named set in one batch.
+ * @param name Name of the set.
+ * @param keys Values to look up.
+ * @param out Receives one flag per key.
+ * @throws std::runtime_error if not found.
+ */
+template <typename T>
+void DataSetCollection<T>::containsMany(std::string_view name, std::span<const T> keys,
+                                        std::vector<bool> &out) const
+{
+    int index = findIndexByName(name);
+    if (index == -1)
+    {
+        throw std::runtime_error("Set '" + std::string(name) + "' not found.");
+    }
+    std::shared_ptr<DataSet<T>> pinned;
+    pin(index, pinned).containsMany(keys, out);
+}
+
 /**
  * @brief Executes an operation between two sets (by name).
  * @param nameA First set name.
@@ -144,62 +760,78 @@ std::vector<std::string> DataSetCollection<T>::getSetNames() const
  * @throws std::runtime_error if sets or operation are invalid.
  */
 template <typename T>
-DataSet<T> DataSetCollection<T>::operate(const std::string &nameA,
-                                         const std::string &op,
-                                         const std::string &nameB) const
+DataSet<T> DataSetCollection<T>::operate(std::string_view nameA,
+                                         std::string_view op,
+                                         std::string_view nameB) const
 {
-    DataSet<T> A = getSet(nameA);
-    DataSet<T> B = getSet(nameB);
-    DataSet<T> result(A.getName() + " " + op + " " + B.getName());
+    std::shared_ptr<const DataSet<T>> pinnedA = shareSet(nameA);
+    std::shared_ptr<const DataSet<T>> pinnedB = shareSet(nameB);
+    const DataSet<T> &A = *pinnedA;
+    const DataSet<T> &B = *pinnedB;
+    if (!limits.isUnlimited())
+    {
+        limits.require(estimateSetOperation(op, A.size(), B.size(),
+                                            SetStatistics<T>::estimateOverlap(A.statistics(),
+                                                                              B.statistics())));
+    }
+    DataSet<T> result{SetName()};
+    const char *symbol; // Static text: the name below is rendered only when read
 
     if (op == "union")
     {
-        result = A.unionWith(B);
+        result = scheduler != nullptr ? A.unionWith(B, *scheduler) : A.unionWith(B);
+        symbol = " union ";
     }
     else if (op == "intersection")
     {
-        result = A.intersectionWith(B);
+        result = scheduler != nullptr ? A.intersectionWith(B, *scheduler) : A.intersectionWith(B);
+        symbol = " intersection ";
     }
     else if (op == "difference")
     {
-        result = A.differenceWith(B);
+        result = scheduler != nullptr ? A.differenceWith(B, *scheduler) : A.differenceWith(B);
+        symbol = " difference ";
     }
     else if (op == "symmetric_difference")
     {
-        result = A.symmetricDifferenceWith(B);
+        result = scheduler != nullptr ? A.symmetricDifferenceWith(B, *scheduler)
+                                      : A.symmetricDifferenceWith(B);
+        symbol = " symmetric_difference ";
     }
     else
     {
-        throw std::runtime_error("Invalid operation: '" + op + "'");
+        throw std::runtime_error("Invalid operation: '" + std::string(op) + "'");
     }
 
-    // Opcional: construir un nombre para el resultado
-    result.setName("(" + nameA + " " + op + " " + nameB + ")");
+    // "(A op B)", shared with the operands' names instead of concatenated
+    result.setName(SetName::group(A.getSetName(), symbol, B.getSetName()));
     return result;
 }
 
 template <typename T>
-DataSet<DataSet<T>> DataSetCollection<T>::operateUnarySet(const std::string &name,
-                                                          const std::string &op) const
+PowerSet<T> DataSetCollection<T>::operateUnarySet(std::string_view name,
+                                                  std::string_view op) const
 {
-    DataSet<T> A = getSet(name);
+    std::shared_ptr<const DataSet<T>> A = shareSet(name);
     if (op == "powerset")
     {
-        return A.powerSet();
+        limits.require(estimatePowerSet(A->size()));
+        return A->powerSet();
     }
     else
     {
-        throw std::runtime_error("Unsupported unary operation: '" + op + "'");
+        throw std::runtime_error("Unsupported unary operation: '" + std::string(op) + "'");
     }
 }
 
 template <typename T>
-DataSet<std::pair<T, T>> DataSetCollection<T>::cartesianProduct(const std::string &nameA,
-                                                                const std::string &nameB) const
+DataSet<std::pair<T, T>> DataSetCollection<T>::cartesianProduct(std::string_view nameA,
+                                                                std::string_view nameB) const
 {
-    DataSet<T> A = getSet(nameA);
-    DataSet<T> B = getSet(nameB);
-    return A.cartesianProductWith(B);
+    std::shared_ptr<const DataSet<T>> A = shareSet(nameA);
+    std::shared_ptr<const DataSet<T>> B = shareSet(nameB);
+    limits.require(estimateCartesianProduct(A->size(), B->size()));
+    return A->cartesianProductWith(*B);
 }
 
 #endif // DATASETCOLLECTION_HXX
@@ -0,0 +1,149 @@
+// ===================================================================================
+// File:        EytzingerArray.h
+// Author:      Group 4
+// Date:        2026-10-18
+// Description: Declaration of EytzingerArray<T>, a read-only sorted set stored in
+//              Eytzinger (BFS) order: the children of position k live at 2k and
+//              2k + 1. Searches descend without data-dependent branches and
+//              prefetch the cache line holding the node four levels further down,
+//              so they stay ahead of memory latency on large arrays.
+//
+//              Supported operations:
+//              ----------------------------------------------------------------------
+//              void assignSorted(const std::vector<T>& sorted)
+//                  Builds the layout from strictly ascending keys.
+//
+//              bool contains(const T& value) const
+//                  Branchless, prefetching search for a single key.
+//
+//              void lookupBatch(const T* keys, size_t keyCount, Fn report) const
+//                  Searches a batch of keys in lockstep groups; calls
+//                  report(i, found) for each key.
+//
+//              size_t size() const
+//                  Returns the number of keys stored.
+//
+//              size_t memoryUsage() const
+//                  Returns the bytes allocated for the layout array.
+//
+//              void forEach(Fn fn) const
+//                  Calls fn(key) for every key in ascending order.
+//
+//              Generator<T> values() const
+//                  Yields every key lazily in ascending order.
+//
+//              T select(size_t rank) const
+//                  Key of a given rank, descending by subtree sizes.
+//
+//              std::span<const T> storage() const
+//                  The keys in layout order, for order-independent scans.
+// ===================================================================================
+
+#ifndef EYTZINGERARRAY_H
+#define EYTZINGERARRAY_H
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+#include "Generator.h"
+#include "Prefetch.h"
+
+/**
+ * @class EytzingerArray
+ * @brief Immutable ordered set laid out in BFS order for fast lookups.
+ *
+ * @tparam T Key type; requires operator< and default construction.
+ */
+template <typename T>
+class EytzingerArray
+{
+private:
+    /// Keys per cache line; the prefetch distance (in nodes) of one search.
+    static constexpr size_t KEYS_PER_LINE = 64 / sizeof(T) > 0 ? 64 / sizeof(T) : 1;
+
+    /// Searches advanced together by lookupBatch.
+    static constexpr size_t BATCH_GROUP = 16;
+
+    std::vector<T> layout; ///< layout[1..n] in BFS order; layout[0] is unused.
+    size_t count;          ///< Number of keys (n).
+    size_t levels;         ///< Depth of the implicit tree, floor(log2 n) + 1.
+
+    size_t fillFrom(const std::vector<T> &sorted, size_t next, size_t k);
+    size_t lowerBoundIndex(const T &value) const;
+    size_t subtreeSize(size_t k) const;
+    void prefetchDescendants(size_t k) const;
+
+public:
+    /**
+     * @brief Constructs an empty array.
+     */
+    EytzingerArray();
+
+    /**
+     * @brief Builds the layout from strictly ascending keys in O(n).
+     * @param sorted Keys in ascending order without duplicates.
+     */
+    void assignSorted(const std::vector<T> &sorted);
+
+    /**
+     * @brief Checks whether a key is present.
+     * @param value The key to search.
+     * @return True if found.
+     */
+    bool contains(const T &value) const;
+
+    /**
+     * @brief Searches many keys, advancing BATCH_GROUP independent searches one
+     *        level at a time so their cache misses overlap.
+     * @param keys Keys to search.
+     * @param keyCount Number of keys.
+     * @param report Callable invoked as report(index, found) for every key.
+     */
+    template <typename Fn>
+    void lookupBatch(const T *keys, size_t keyCount, Fn &&report) const;
+
+    /**
+     * @brief Returns the number of keys stored.
+     */
+    size_t size() const;
+
+    /**
+     * @brief Returns the bytes allocated for the layout array.
+     */
+    size_t memoryUsage() const;
+
+    /**
+     * @brief Removes every key.
+     */
+    void clear();
+
+    /**
+     * @brief Calls fn(key) for every key in ascending order (in-order traversal).
+     * @param fn Callable taking const T&.
+     */
+    template <typename Fn>
+    void forEach(Fn &&fn) const;
+
+    /**
+     * @brief Yields every key lazily in ascending order (same traversal as forEach).
+     */
+    Generator<T> values() const;
+
+    /**
+     * @brief Returns the key of rank `rank` (0 = smallest): the descent goes
+     *        left or right by the size of the left subtree, O(log² n) in all.
+     * @param rank Rank below size().
+     */
+    T select(size_t rank) const;
+
+    /**
+     * @brief Returns the keys in layout (BFS) order. Sums, minima and maxima do
+     *        not depend on order and scan this contiguous array directly.
+     */
+    std::span<const T> storage() const;
+};
+
+#include "EytzingerArray.hxx"
+
+#endif // EYTZINGERARRAY_H
@@ -0,0 +1,301 @@
+// ===================================================================================
+// File:        EytzingerArray.hxx
+// Author:      Group 4
+// Date:        2026-10-18
+// Description: Implementation of the templated class EytzingerArray<T>.
+// ===================================================================================
+// Group 4 | Joel Felipe Martinez | Xamuel Perez | Rafael Held
+
+#ifndef EYTZINGERARRAY_HXX
+#define EYTZINGERARRAY_HXX
+
+#include "EytzingerArray.h"
+#include <algorithm> // For std::min
+
+/**
+ * @brief Constructs an empty array.
+ */
+template <typename T>
+EytzingerArray<T>::EytzingerArray() : layout(), count(0), levels(0) {}
+
+/**
+ * @brief Builds the layout from strictly ascending keys in O(n).
+ * @param sorted Keys in ascending order without duplicates.
+ */
+template <typename T>
+void EytzingerArray<T>::assignSorted(const std::vector<T> &sorted)
+{
+    count = sorted.size();
+    layout.assign(count + 1, T());
+    levels = 0;
+    for (size_t n = count; n > 0; n >>= 1)
+    {
+        ++levels;
+    }
+    fillFrom(sorted, 0, 1);
+}
+
+/**
+ * @brief In-order fill: the subtree rooted at k receives the next keys of `sorted`.
+ *        Recursion depth is the tree height, O(log n).
+ * @return Index of the next unused key.
+ */
+template <typename T>
+size_t EytzingerArray<T>::fillFrom(const std::vector<T> &sorted, size_t next, size_t k)
+{
+    if (k <= count)
+    {
+        next = fillFrom(sorted, next, 2 * k);
+        layout[k] = sorted[next++];
+        next = fillFrom(sorted, next, 2 * k + 1);
+    }
+    return next;
+}
+
+/**
+ * @brief Prefetches the cache line holding the descendants of k that the search
+ *        will reach log2(KEYS_PER_LINE) levels later.
+ */
+template <typename T>
+void EytzingerArray<T>::prefetchDescendants(size_t k) const
+{
+    prefetchRead(reinterpret_cast<const char *>(layout.data()) + k * KEYS_PER_LINE * sizeof(T));
+}
+
+/**
+ * @brief Branchless descent; returns the BFS index of the first key >= value,
+ *        or 0 when every key is smaller.
+ */
+template <typename T>
+size_t EytzingerArray<T>::lowerBoundIndex(const T &value) const
+{
+    size_t k = 1;
+    while (k <= count)
+    {
+        prefetchDescendants(k);
+        k = 2 * k + static_cast<size_t>(layout[k] < value);
+    }
+    // Undo the trailing right turns plus the final left turn
+    while (k & 1)
+    {
+        k >>= 1;
+    }
+    return k >> 1;
+}
+
+/**
+ * @brief Checks whether a key is present.
+ * @param value The key to search.
+ * @return True if found.
+ */
+template <typename T>
+bool EytzingerArray<T>::contains(const T &value) const
+{
+    size_t k = lowerBoundIndex(value);
+    return k != 0 && !(value < layout[k]);
+}
+
+/**
+ * @brief Searches many keys, advancing BATCH_GROUP independent searches one
+ *        level at a time so their cache misses overlap.
+ * @param keys Keys to search.
+ * @param keyCount Number of keys.
+ * @param report Callable invoked as report(index, found) for every key.
+ */
+template <typename T>
+template <typename Fn>
+void EytzingerArray<T>::lookupBatch(const T *keys, size_t keyCount, Fn &&report) const
+{
+    size_t positions[BATCH_GROUP];
+    for (size_t base = 0; base < keyCount; base += BATCH_GROUP)
+    {
+        size_t group = std::min(BATCH_GROUP, keyCount - base);
+        for (size_t g = 0; g < group; ++g)
+        {
+            positions[g] = 1;
+        }
+
+        // Every search runs `levels` steps; finished ones simply stop moving
+        for (size_t level = 0; level < levels; ++level)
+        {
+            for (size_t g = 0; g < group; ++g)
+            {
+                size_t k = positions[g];
+                if (k <= count)
+                {
+                    prefetchDescendants(k);
+                    positions[g] = 2 * k + static_cast<size_t>(layout[k] < keys[base + g]);
+                }
+            }
+        }
+
+        for (size_t g = 0; g < group; ++g)
+        {
+            size_t k = positions[g];
+            while (k & 1)
+            {
+                k >>= 1;
+            }
+            k >>= 1;
+            report(base + g, k != 0 && !(keys[base + g] < layout[k]));
+        }
+    }
+}
+
+/**
+ * @brief Returns the number of keys stored.
+ */
+template <typename T>
+size_t EytzingerArray<T>::size() const
+{
+    return count;
+}
+
+/**
+ * @brief Returns the bytes allocated for the layout array.
+ */
+template <typename T>
+size_t EytzingerArray<T>::memoryUsage() const
+{
+    return layout.capacity() * sizeof(T);
+}
+
+/**
+ * @brief Removes every key.
+ */
+template <typename T>
+void EytzingerArray<T>::clear()
+{
+    layout.clear();
+    layout.shrink_to_fit();
+    count = 0;
+    levels = 0;
+}
+
+/**
+ * @brief Calls fn(key) for every key in ascending order (in-order traversal).
+ * @param fn Callable taking const T&.
+ */
+template <typename T>
+template <typename Fn>
+void EytzingerArray<T>::forEach(Fn &&fn) const
+{
+    if (count == 0)
+    {
+        return;
+    }
+    size_t k = 1;
+    while (2 * k <= count)
+    {
+        k = 2 * k; // Leftmost node holds the smallest key
+    }
+    for (size_t visited = 0; visited < count; ++visited)
+    {
+        fn(layout[k]);
+        if (2 * k + 1 <= count)
+        {
+            k = 2 * k + 1; // Successor: leftmost node of the right subtree
+            while (2 * k <= count)
+            {
+                k = 2 * k;
+            }
+        }
+        else
+        {
+            while (k & 1)
+            {
+                k >>= 1; // Climb while we are a right child
+            }
+            k >>= 1;
+        }
+    }
+}
+
+/**
+ * @brief Yields every key lazily in ascending order (same traversal as forEach).
+ */
+template <typename T>
+Generator<T> EytzingerArray<T>::values() const
+{
+    if (count == 0)
+    {
+        co_return;
+    }
+    size_t k = 1;
+    while (2 * k <= count)
+    {
+        k = 2 * k; // Leftmost node holds the smallest key
+    }
+    for (size_t visited = 0; visited < count; ++visited)
+    {
+        co_yield layout[k];
+        if (2 * k + 1 <= count)
+        {
+            k = 2 * k + 1; // Successor: leftmost node of the right subtree
+            while (2 * k <= count)
+            {
+                k = 2 * k;
+            }
+        }
+        else
+        {
+            while (k & 1)
+            {
+                k >>= 1; // Climb while we are a right child
+            }
+            k >>= 1;
+        }
+    }
+}
+
+/**
+ * @brief Number of nodes in the subtree rooted at k: level by level, the
+ *        descendants of k are a contiguous range of BFS indices.
+ */
+template <typename T>
+size_t EytzingerArray<T>::subtreeSize(size_t k) const
+{
+    size_t total = 0;
+    for (size_t first = k, width = 1; first <= count; first *= 2, width *= 2)
+    {
+        total += std::min(first + width - 1, count) - first + 1;
+    }
+    return total;
+}
+
+/**
+ * @brief Returns the key of rank `rank` by descending on left-subtree sizes.
+ */
+template <typename T>
+T EytzingerArray<T>::select(size_t rank) const
+{
+    size_t k = 1;
+    while (true)
+    {
+        size_t left = subtreeSize(2 * k);
+        if (rank == left)
+        {
+            return layout[k];
+        }
+        if (rank < left)
+        {
+            k = 2 * k;
+        }
+        else
+        {
+            rank -= left + 1;
+            k = 2 * k + 1;
+        }
+    }
+}
+
+/**
+ * @brief Returns the keys in layout (BFS) order.
+ */
+template <typename T>
+std::span<const T> EytzingerArray<T>::storage() const
+{
+    return count == 0 ? std::span<const T>() : std::span<const T>(layout.data() + 1, count);
+}
+
+#endif // EYTZINGERARRAY_HXX
@@ -0,0 +1,132 @@
+// ===================================================================================
+// File:        Generator.h
+// Author:      Group 4
+// Date:        2026-10-18
+// Description: Declaration of Generator<T>, a C++20 coroutine that yields a
+//              sequence of values lazily. The body of a generator runs only as
+//              far as the consumer asks: each increment of the iterator resumes
+//              it until its next co_yield. Generators are move-only ranges and
+//              can be passed by value into other generators to build pipelines.
+//
+//              Supported operations:
+//              ----------------------------------------------------------------------
+//              iterator begin() / std::default_sentinel_t end()
+//                  Input-iterator range over the yielded values (single pass).
+//
+//              Generator<T> generateFrom(const Range& range)
+//                  Yields every element of a range the caller keeps alive.
+// ===================================================================================
+
+#ifndef GENERATOR_H
+#define GENERATOR_H
+
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+
+/**
+ * @class Generator
+ * @brief Lazily evaluated sequence produced by a coroutine with co_yield.
+ *        A yielded value stays valid until the iterator is incremented.
+ *
+ * @tparam T Type of the yielded values.
+ */
+template <typename T>
+class Generator
+{
+public:
+    /**
+     * @brief Coroutine state: the value of the last co_yield and any exception.
+     */
+    struct promise_type
+    {
+        const T *current = nullptr; ///< Last yielded value (lives in the coroutine frame).
+        std::exception_ptr error;   ///< Exception thrown by the body, rethrown to the consumer.
+
+        Generator get_return_object();
+        std::suspend_always initial_suspend() const noexcept;
+        std::suspend_always final_suspend() const noexcept;
+        std::suspend_always yield_value(const T &value) noexcept;
+        void return_void() const noexcept;
+        void unhandled_exception();
+    };
+
+    typedef std::coroutine_handle<promise_type> Handle;
+
+    /**
+     * @class iterator
+     * @brief Single-pass input iterator; incrementing resumes the coroutine.
+     */
+    class iterator
+    {
+    private:
+        Handle handle;
+
+    public:
+        typedef std::input_iterator_tag iterator_category;
+        typedef T value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const T *pointer;
+        typedef const T &reference;
+
+        iterator();
+        explicit iterator(Handle coroutine);
+
+        /**
+         * @brief Returns the value of the last co_yield.
+         */
+        const T &operator*() const;
+        const T *operator->() const;
+
+        /**
+         * @brief Resumes the coroutine until its next co_yield (or its end).
+         * @throws Whatever the generator body threw.
+         */
+        iterator &operator++();
+        void operator++(int);
+
+        /**
+         * @brief True once the coroutine has finished.
+         */
+        bool operator==(std::default_sentinel_t) const;
+    };
+
+    Generator(const Generator &) = delete;
+    Generator &operator=(const Generator &) = delete;
+    Generator(Generator &&other) noexcept;
+    Generator &operator=(Generator &&other) noexcept;
+
+    /**
+     * @brief Destroys the coroutine frame (stopping the generator if unfinished).
+     */
+    ~Generator();
+
+    /**
+     * @brief Runs the body up to its first co_yield. Call once.
+     * @throws Whatever the generator body threw.
+     */
+    iterator begin();
+
+    /**
+     * @brief Sentinel compared against by the iterator.
+     */
+    std::default_sentinel_t end() const noexcept;
+
+private:
+    Handle handle;
+
+    explicit Generator(Handle coroutine);
+};
+
+/**
+ * @brief Yields every element of a range in its own order.
+ *        The range must outlive the generator and must not change meanwhile.
+ * @param range Any range whose elements convert to T.
+ */
+template <typename T, typename Range>
+Generator<T> generateFrom(const Range &range);
+
+#include "Generator.hxx"
+
+#endif // GENERATOR_H
@@ -0,0 +1,182 @@
+// ===================================================================================
+// File:        Generator.hxx
+// Author:      Group 4
+// Date:        2026-10-18
+// Description: Implementation of the templated class Generator<T>.
+// ===================================================================================
+// Group 4 | Joel Felipe Martinez | Xamuel Perez | Rafael Held
+
+#ifndef GENERATOR_HXX
+#define GENERATOR_HXX
+
+#include "Generator.h"
+#include <memory>  // For std::addressof
+#include <utility> // For std::exchange
+
+template <typename T>
+Generator<T> Generator<T>::promise_type::get_return_object()
+{
+    return Generator(Handle::from_promise(*this));
+}
+
+/**
+ * @brief Generators are lazy: nothing runs before the first begin().
+ */
+template <typename T>
+std::suspend_always Generator<T>::promise_type::initial_suspend() const noexcept
+{
+    return {};
+}
+
+/**
+ * @brief Keeps the frame alive after the body ends so that done() can be queried.
+ */
+template <typename T>
+std::suspend_always Generator<T>::promise_type::final_suspend() const noexcept
+{
+    return {};
+}
+
+/**
+ * @brief Publishes a value and suspends. Temporaries passed to co_yield live
+ *        until the coroutine resumes, so storing their address is safe.
+ */
+template <typename T>
+std::suspend_always Generator<T>::promise_type::yield_value(const T &value) noexcept
+{
+    current = std::addressof(value);
+    return {};
+}
+
+template <typename T>
+void Generator<T>::promise_type::return_void() const noexcept {}
+
+template <typename T>
+void Generator<T>::promise_type::unhandled_exception()
+{
+    error = std::current_exception();
+}
+
+template <typename T>
+Generator<T>::iterator::iterator() : handle(nullptr) {}
+
+template <typename T>
+Generator<T>::iterator::iterator(Handle coroutine) : handle(coroutine) {}
+
+/**
+ * @brief Returns the value of the last co_yield.
+ */
+template <typename T>
+const T &Generator<T>::iterator::operator*() const
+{
+    return *handle.promise().current;
+}
+
+template <typename T>
+const T *Generator<T>::iterator::operator->() const
+{
+    return handle.promise().current;
+}
+
+/**
+ * @brief Resumes the coroutine until its next co_yield (or its end).
+ * @throws Whatever the generator body threw.
+ */
+template <typename T>
+typename Generator<T>::iterator &Generator<T>::iterator::operator++()
+{
+    handle.resume();
+    if (handle.promise().error)
+    {
+        std::rethrow_exception(std::exchange(handle.promise().error, nullptr));
+    }
+    return *this;
+}
+
+template <typename T>
+void Generator<T>::iterator::operator++(int)
+{
+    ++*this;
+}
+
+/**
+ * @brief True once the coroutine has finished.
+ */
+template <typename T>
+bool Generator<T>::iterator::operator==(std::default_sentinel_t) const
+{
+    return !handle || handle.done();
+}
+
+template <typename T>
+Generator<T>::Generator(Handle coroutine) : handle(coroutine) {}
+
+template <typename T>
+Generator<T>::Generator(Generator &&other) noexcept
+    : handle(std::exchange(other.handle, nullptr)) {}
+
+template <typename T>
+Generator<T> &Generator<T>::operator=(Generator &&other) noexcept
+{
+    if (this != &other)
+    {
+        if (handle)
+        {
+            handle.destroy();
+        }
+        handle = std::exchange(other.handle, nullptr);
+    }
+    return *this;
+}
+
+/**
+ * @brief Destroys the coroutine frame (stopping the generator if unfinished).
+ */
+template <typename T>
+Generator<T>::~Generator()
+{
+    if (handle)
+    {
+        handle.destroy();
+    }
+}
+
+/**
+ * @brief Runs the body up to its first co_yield. Call once.
+ * @throws Whatever the generator body threw.
+ */
+template <typename T>
+typename Generator<T>::iterator Generator<T>::begin()
+{
+    iterator it(handle);
+    if (handle)
+    {
+        ++it;
+    }
+    return it;
+}
+
+/**
+ * @brief Sentinel compared against by the iterator.
+ */
+template <typename T>
+std::default_sentinel_t Generator<T>::end() const noexcept
+{
+    return std::default_sentinel;
+}
+
+/**
+ * @brief Yields every element of a range in its own order.
+ *        The range must outlive the generator and must not change meanwhile.
+ * @param range Any range whose elements convert to T.
+ */
+template <typename T, typename Range>
+Generator<T> generateFrom(const Range &range)
+{
+    for (const auto &value : range)
+    {
+        co_yield value;
+    }
+}
+
+#endif // GENERATOR_HXX
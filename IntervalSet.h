@@ -0,0 +1,203 @@
+// ===================================================================================
+// File:        IntervalSet.h
+// Author:      Group 4
+// Date:        2026-10-18
+// Description: Declaration of IntervalSet<T>, a set of integers stored as a sorted
+//              vector of disjoint, non-adjacent runs [lo, hi]. A set made of long
+//              runs of consecutive values costs one run (two keys) per run instead
+//              of one key per element, and set algebra walks runs, not elements.
+//
+//              Supported operations:
+//              ----------------------------------------------------------------------
+//              bool insert(const T& value)
+//                  Inserts a value, extending or joining neighbouring runs.
+//
+//              void insertRange(const T& lo, const T& hi)
+//                  Inserts every value of [lo, hi] in O(log r + merged runs).
+//
+//              bool contains(const T& value) const
+//                  Binary search over the runs in O(log r).
+//
+//              size_t size() const
+//                  Returns the number of values (the sum of the run lengths).
+//
+//              size_t memoryUsage() const
+//                  Returns the bytes allocated for the run list.
+//
+//              size_t runCount() const
+//                  Returns the number of runs stored.
+//
+//              const std::vector<Run>& getRuns() const
+//                  Returns the runs in ascending order.
+//
+//              void clear()
+//                  Removes every value.
+//
+//              void assignSorted(const std::vector<T>& sorted)
+//                  Rebuilds the runs from strictly ascending values in O(n).
+//
+//              static IntervalSet combine(a, b, keepOnlyA, keepBoth, keepOnlyB)
+//                  Union, intersection, difference or symmetric difference of two
+//                  sets in O(ra + rb), selected by the flags.
+//
+//              bool isSubsetOf(const IntervalSet& other) const
+//                  Checks inclusion run by run.
+//
+//              void forEach(Fn fn) const
+//                  Calls fn(value) for every value in ascending order.
+//
+//              Generator<T> values() const
+//                  Yields every value lazily in ascending order, run by run.
+//
+//              int64_t sum() const / T select(size_t rank) const
+//                  Sum of the values and value of a given rank, run by run.
+// ===================================================================================
+
+#ifndef INTERVALSET_H
+#define INTERVALSET_H
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+#include "Generator.h"
+
+/**
+ * @class IntervalSet
+ * @brief Run-length encoded set of integers. Runs are kept sorted and are never
+ *        adjacent (hi + 1 < next.lo), so every set has exactly one encoding.
+ *
+ * @tparam T Integral value type.
+ */
+template <typename T>
+class IntervalSet
+{
+public:
+    /// True for value types this container accepts.
+    static constexpr bool SUPPORTED = std::is_integral<T>::value && !std::is_same<T, bool>::value;
+
+    /**
+     * @brief Inclusive run of consecutive values.
+     */
+    struct Run
+    {
+        T lo;
+        T hi;
+    };
+
+private:
+    std::vector<Run> runs; ///< Disjoint, non-adjacent runs in ascending order.
+    size_t count;          ///< Sum of the run lengths.
+
+    static size_t runLength(const Run &run);
+    void appendRun(const T &lo, const T &hi);
+    size_t runAfter(const T &value) const;
+
+public:
+    /**
+     * @brief Constructs an empty set.
+     */
+    IntervalSet();
+
+    /**
+     * @brief Inserts a value, extending or joining the neighbouring runs.
+     * @param value The value to insert.
+     * @return True if the value was added, false if it already existed.
+     */
+    bool insert(const T &value);
+
+    /**
+     * @brief Inserts every value of [lo, hi], merging all runs it overlaps or touches.
+     *        An empty range (hi < lo) leaves the set unchanged.
+     * @param lo First value of the range.
+     * @param hi Last value of the range (inclusive).
+     */
+    void insertRange(const T &lo, const T &hi);
+
+    /**
+     * @brief Checks whether a value lies inside one of the runs.
+     * @param value The value to search.
+     * @return True if found.
+     */
+    bool contains(const T &value) const;
+
+    /**
+     * @brief Returns the number of values (sum of the run lengths).
+     */
+    size_t size() const;
+
+    /**
+     * @brief Returns the bytes allocated for the run list.
+     */
+    size_t memoryUsage() const;
+
+    /**
+     * @brief Returns the number of runs stored.
+     */
+    size_t runCount() const;
+
+    /**
+     * @brief Returns the runs in ascending order.
+     */
+    const std::vector<Run> &getRuns() const;
+
+    /**
+     * @brief Removes every value.
+     */
+    void clear();
+
+    /**
+     * @brief Rebuilds the runs from strictly ascending values.
+     * @param sorted Values in ascending order without duplicates.
+     */
+    void assignSorted(const std::vector<T> &sorted);
+
+    /**
+     * @brief Sweeps the runs of two sets and keeps the segments selected by the flags.
+     * @param a First operand.
+     * @param b Second operand.
+     * @param keepOnlyA Keep values found only in a.
+     * @param keepBoth Keep values found in both sets.
+     * @param keepOnlyB Keep values found only in b.
+     * @return The combined set.
+     */
+    static IntervalSet combine(const IntervalSet &a, const IntervalSet &b,
+                               bool keepOnlyA, bool keepBoth, bool keepOnlyB);
+
+    /**
+     * @brief Checks whether every run of this set lies inside a run of the other.
+     * @param other The candidate superset.
+     * @return True if this set is a subset of other.
+     */
+    bool isSubsetOf(const IntervalSet &other) const;
+
+    /**
+     * @brief Calls fn(value) for every value in ascending order.
+     * @param fn Callable taking const T&.
+     */
+    template <typename Fn>
+    void forEach(Fn &&fn) const;
+
+    /**
+     * @brief Yields every value lazily in ascending order; runs are expanded one
+     *        value at a time, never materialized.
+     */
+    Generator<T> values() const;
+
+    /**
+     * @brief Returns the sum of the values in O(r): each run adds the sum of
+     *        an arithmetic series. Wraps modulo 2^64.
+     */
+    int64_t sum() const;
+
+    /**
+     * @brief Returns the value of rank `rank` (0 = smallest) in O(r), skipping
+     *        whole runs by their lengths.
+     * @param rank Rank below size().
+     */
+    T select(size_t rank) const;
+};
+
+#include "IntervalSet.hxx"
+
+#endif // INTERVALSET_H
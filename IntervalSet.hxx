@@ -0,0 +1,395 @@
+// ===================================================================================
+// File:        IntervalSet.hxx
+// Author:      Group 4
+// Date:        2026-10-18
+// Description: Implementation of the templated class IntervalSet<T>.
+// ===================================================================================
+// Group 4 | Joel Felipe Martinez | Xamuel Perez | Rafael Held
+
+#ifndef INTERVALSET_HXX
+#define INTERVALSET_HXX
+
+#include "IntervalSet.h"
+#include <algorithm> // For std::upper_bound
+#include <limits>    // For std::numeric_limits
+
+/**
+ * @brief Constructs an empty set.
+ */
+template <typename T>
+IntervalSet<T>::IntervalSet()
+    : runs(), count(0) {}
+
+/**
+ * @brief Number of values in a run, computed in unsigned arithmetic so that
+ *        runs spanning negative and positive values cannot overflow.
+ */
+template <typename T>
+size_t IntervalSet<T>::runLength(const Run &run)
+{
+    typedef typename std::make_unsigned<T>::type Unsigned;
+    return static_cast<size_t>(static_cast<Unsigned>(static_cast<Unsigned>(run.hi) -
+                                                     static_cast<Unsigned>(run.lo))) +
+           1;
+}
+
+/**
+ * @brief Appends [lo, hi] after the last run, joining it when the two touch.
+ *        lo must be greater than the last stored value.
+ */
+template <typename T>
+void IntervalSet<T>::appendRun(const T &lo, const T &hi)
+{
+    if (!runs.empty() && runs.back().hi != std::numeric_limits<T>::max() &&
+        runs.back().hi + 1 == lo)
+    {
+        runs.back().hi = hi;
+    }
+    else
+    {
+        runs.push_back(Run{lo, hi});
+    }
+    count += runLength(Run{lo, hi});
+}
+
+/**
+ * @brief Index of the first run that starts after value (runs.size() if none).
+ */
+template <typename T>
+size_t IntervalSet<T>::runAfter(const T &value) const
+{
+    typename std::vector<Run>::const_iterator it =
+        std::upper_bound(runs.begin(), runs.end(), value,
+                         [](const T &key, const Run &run)
+                         { return key < run.lo; });
+    return static_cast<size_t>(it - runs.begin());
+}
+
+/**
+ * @brief Inserts a value, extending or joining the neighbouring runs.
+ * @param value The value to insert.
+ * @return True if the value was added, false if it already existed.
+ */
+template <typename T>
+bool IntervalSet<T>::insert(const T &value)
+{
+    size_t next = runAfter(value);
+    if (next > 0 && !(runs[next - 1].hi < value))
+    {
+        return false; // Inside the previous run
+    }
+
+    // Both checks are overflow-free: prev.hi < value < next.lo
+    bool touchesPrev = next > 0 && runs[next - 1].hi + 1 == value;
+    bool touchesNext = next < runs.size() && value + 1 == runs[next].lo;
+    if (touchesPrev && touchesNext)
+    {
+        runs[next - 1].hi = runs[next].hi;
+        runs.erase(runs.begin() + next);
+    }
+    else if (touchesPrev)
+    {
+        runs[next - 1].hi = value;
+    }
+    else if (touchesNext)
+    {
+        runs[next].lo = value;
+    }
+    else
+    {
+        runs.insert(runs.begin() + next, Run{value, value});
+    }
+    ++count;
+    return true;
+}
+
+/**
+ * @brief Inserts every value of [lo, hi], merging all runs it overlaps or touches.
+ *        An empty range (hi < lo) leaves the set unchanged.
+ * @param lo First value of the range.
+ * @param hi Last value of the range (inclusive).
+ */
+template <typename T>
+void IntervalSet<T>::insertRange(const T &lo, const T &hi)
+{
+    if (hi < lo)
+    {
+        return;
+    }
+
+    // Runs [first, last) overlap [lo, hi] or touch one of its ends
+    size_t first = runAfter(lo);
+    if (first > 0 && (!(runs[first - 1].hi < lo) || runs[first - 1].hi + 1 == lo))
+    {
+        --first;
+    }
+    size_t last = runAfter(hi);
+    if (last < runs.size() && hi != std::numeric_limits<T>::max() && hi + 1 == runs[last].lo)
+    {
+        ++last;
+    }
+
+    Run merged{lo, hi};
+    if (first < last)
+    {
+        merged.lo = std::min(lo, runs[first].lo);
+        merged.hi = std::max(hi, runs[last - 1].hi);
+        for (size_t i = first; i < last; ++i)
+        {
+            count -= runLength(runs[i]);
+        }
+        runs[first] = merged;
+        runs.erase(runs.begin() + first + 1, runs.begin() + last);
+    }
+    else
+    {
+        runs.insert(runs.begin() + first, merged);
+    }
+    count += runLength(merged);
+}
+
+/**
+ * @brief Checks whether a value lies inside one of the runs.
+ * @param value The value to search.
+ * @return True if found.
+ */
+template <typename T>
+bool IntervalSet<T>::contains(const T &value) const
+{
+    size_t next = runAfter(value);
+    return next > 0 && !(runs[next - 1].hi < value);
+}
+
+/**
+ * @brief Returns the number of values (sum of the run lengths).
+ */
+template <typename T>
+size_t IntervalSet<T>::size() const
+{
+    return count;
+}
+
+/**
+ * @brief Returns the bytes allocated for the run list.
+ */
+template <typename T>
+size_t IntervalSet<T>::memoryUsage() const
+{
+    return runs.capacity() * sizeof(Run);
+}
+
+/**
+ * @brief Returns the number of runs stored.
+ */
+template <typename T>
+size_t IntervalSet<T>::runCount() const
+{
+    return runs.size();
+}
+
+/**
+ * @brief Returns the runs in ascending order.
+ */
+template <typename T>
+const std::vector<typename IntervalSet<T>::Run> &IntervalSet<T>::getRuns() const
+{
+    return runs;
+}
+
+/**
+ * @brief Removes every value.
+ */
+template <typename T>
+void IntervalSet<T>::clear()
+{
+    runs.clear();
+    runs.shrink_to_fit();
+    count = 0;
+}
+
+/**
+ * @brief Rebuilds the runs from strictly ascending values.
+ * @param sorted Values in ascending order without duplicates.
+ */
+template <typename T>
+void IntervalSet<T>::assignSorted(const std::vector<T> &sorted)
+{
+    clear();
+    for (const T &value : sorted)
+    {
+        appendRun(value, value);
+    }
+}
+
+/**
+ * @brief Sweeps the runs of two sets and keeps the segments selected by the flags.
+ *        The number line is cut at every run boundary; within each segment
+ *        membership in a and b is constant, so one decision covers the segment.
+ * @param a First operand.
+ * @param b Second operand.
+ * @param keepOnlyA Keep values found only in a.
+ * @param keepBoth Keep values found in both sets.
+ * @param keepOnlyB Keep values found only in b.
+ * @return The combined set.
+ */
+template <typename T>
+IntervalSet<T> IntervalSet<T>::combine(const IntervalSet &a, const IntervalSet &b,
+                                       bool keepOnlyA, bool keepBoth, bool keepOnlyB)
+{
+    IntervalSet result;
+    const std::vector<Run> &ra = a.runs;
+    const std::vector<Run> &rb = b.runs;
+    size_t i = 0;
+    size_t j = 0;
+    if (ra.empty() && rb.empty())
+    {
+        return result;
+    }
+
+    // Invariant: every run still ahead (ra[i], rb[j]) ends at or after position
+    T position = ra.empty() ? rb[0].lo : (rb.empty() ? ra[0].lo : std::min(ra[0].lo, rb[0].lo));
+    while (i < ra.size() || j < rb.size())
+    {
+        bool inA = i < ra.size() && !(position < ra[i].lo);
+        bool inB = j < rb.size() && !(position < rb[j].lo);
+        if (!inA && !inB)
+        {
+            // Gap in both sets: jump to the next run start
+            position = (j >= rb.size() || (i < ra.size() && ra[i].lo < rb[j].lo)) ? ra[i].lo : rb[j].lo;
+            continue;
+        }
+
+        // Last value of the segment starting at position
+        T end;
+        if (inA && inB)
+        {
+            end = std::min(ra[i].hi, rb[j].hi);
+        }
+        else if (inA)
+        {
+            end = (j < rb.size() && !(ra[i].hi < rb[j].lo)) ? rb[j].lo - 1 : ra[i].hi;
+        }
+        else
+        {
+            end = (i < ra.size() && !(rb[j].hi < ra[i].lo)) ? ra[i].lo - 1 : rb[j].hi;
+        }
+
+        if ((inA && inB && keepBoth) || (inA && !inB && keepOnlyA) || (!inA && inB && keepOnlyB))
+        {
+            result.appendRun(position, end);
+        }
+        if (inA && ra[i].hi == end)
+        {
+            ++i;
+        }
+        if (inB && rb[j].hi == end)
+        {
+            ++j;
+        }
+        if (end == std::numeric_limits<T>::max())
+        {
+            break;
+        }
+        position = end + 1;
+    }
+    return result;
+}
+
+/**
+ * @brief Checks whether every run of this set lies inside a run of the other.
+ * @param other The candidate superset.
+ * @return True if this set is a subset of other.
+ */
+template <typename T>
+bool IntervalSet<T>::isSubsetOf(const IntervalSet &other) const
+{
+    if (count > other.count)
+    {
+        return false;
+    }
+    for (const Run &run : runs)
+    {
+        size_t next = other.runAfter(run.lo);
+        if (next == 0 || other.runs[next - 1].hi < run.hi)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Calls fn(value) for every value in ascending order.
+ * @param fn Callable taking const T&.
+ */
+template <typename T>
+template <typename Fn>
+void IntervalSet<T>::forEach(Fn &&fn) const
+{
+    for (const Run &run : runs)
+    {
+        for (T value = run.lo;; ++value)
+        {
+            fn(value);
+            if (value == run.hi)
+            {
+                break;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Yields every value lazily in ascending order; runs are expanded one
+ *        value at a time, never materialized.
+ */
+template <typename T>
+Generator<T> IntervalSet<T>::values() const
+{
+    for (const Run &run : runs)
+    {
+        for (T value = run.lo;; ++value)
+        {
+            co_yield value;
+            if (value == run.hi)
+            {
+                break;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Returns the sum of the values, run by run: a run of length n starting
+ *        at lo adds n * lo + n * (n - 1) / 2.
+ */
+template <typename T>
+int64_t IntervalSet<T>::sum() const
+{
+    uint64_t total = 0;
+    for (const Run &run : runs)
+    {
+        uint64_t length = runLength(run);
+        uint64_t series = length % 2 == 0 ? (length / 2) * (length - 1) : length * ((length - 1) / 2);
+        total += length * static_cast<uint64_t>(static_cast<int64_t>(run.lo)) + series;
+    }
+    return static_cast<int64_t>(total);
+}
+
+/**
+ * @brief Returns the value of rank `rank`, skipping whole runs by their lengths.
+ */
+template <typename T>
+T IntervalSet<T>::select(size_t rank) const
+{
+    size_t r = 0;
+    while (rank >= runLength(runs[r]))
+    {
+        rank -= runLength(runs[r]);
+        ++r;
+    }
+    typedef typename std::make_unsigned<T>::type Unsigned;
+    return static_cast<T>(static_cast<Unsigned>(static_cast<Unsigned>(runs[r].lo) + rank));
+}
+
+#endif // INTERVALSET_HXX
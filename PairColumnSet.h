@@ -0,0 +1,214 @@
+// ===================================================================================
+// File:        PairColumnSet.h
+// Author:      Group 4
+// Date:        2026-10-18
+// Description: Declaration of PairColumnSet<T>, a set of pairs (a, b) stored as two
+//              parallel columns: one contiguous array of first components and
+//              one of second components (struct of arrays), instead of one
+//              array of std::pair<T, T>.
+//
+//              A predicate on one component then scans a single dense array,
+//              16 values per instruction with AVX-512 (see simdCompare), and a
+//              projection reads only the column it needs. This is the layout
+//              in which filtering a Cartesian product runs at the speed of the
+//              memory rather than of the pair-by-pair loop.
+//
+//              Supported operations:
+//              ----------------------------------------------------------------------
+//              static PairColumnSet product(const DataSet<T>& a, const DataSet<T>& b)
+//              static PairColumnSet fromSet(const DataSet<std::pair<T, T>>& set)
+//                  Build the columns of A × B, or of an existing set of pairs.
+//
+//              bool insert(const T& first, const T& second) / bool contains(...) const
+//              size_t size() const / std::pair<T, T> at(size_t row) const
+//              std::span<const T> column(PairColumn which) const
+//                  Element access, row by row or column by column.
+//
+//              size_t countWhere(PairColumn which, Comparison op, const T& value) const
+//              PairColumnSet where(PairColumn which, Comparison op, const T& value) const
+//                  Vectorized selection of the pairs whose component satisfies op.
+//
+//              DataSet<T> domain() const / DataSet<T> range() const
+//                  Distinct first and second components.
+//
+//              PairColumnSet join(const PairColumnSet& other) const
+//                  Composition: (a, c) for every (a, b) here and (b, c) in other.
+//
+//              DataSet<std::pair<T, T>> toDataSet(const std::string& name) const
+//              Generator<std::pair<T, T>> values() const
+//                  Convert back to rows.
+//
+//              bool parseComparison(std::string_view text, Comparison& op)
+//              const char* comparisonSymbol(Comparison op)
+//                  Convert a Comparison to and from "==", "!=", "<", "<=", ">", ">=".
+// ===================================================================================
+
+#ifndef PAIRCOLUMNSET_H
+#define PAIRCOLUMNSET_H
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include "DataSet.h"
+#include "Generator.h"
+#include "SimdKernels.h"
+
+/**
+ * @enum PairColumn
+ * @brief Component of a pair a column holds.
+ */
+enum class PairColumn
+{
+    FIRST, ///< The a of (a, b).
+    SECOND ///< The b of (a, b).
+};
+
+/**
+ * @brief Parses a comparison operator.
+ * @param text "==", "!=", "<", "<=", ">" or ">=".
+ * @param op Receives the comparison.
+ * @return False if the operator is unknown (op is left unchanged).
+ */
+bool parseComparison(std::string_view text, Comparison &op);
+
+/**
+ * @brief Returns the operator text of a comparison ("==", "<", ...).
+ */
+const char *comparisonSymbol(Comparison op);
+
+/**
+ * @class PairColumnSet
+ * @brief Set of pairs stored column-wise. Row i is (column(FIRST)[i],
+ *        column(SECOND)[i]); rows are distinct and keep the order in which
+ *        they were added.
+ *
+ * @tparam T Component type. Predicates are vectorized for signed 4- and 8-byte
+ *           integers; domain(), range() and join() need an orderable T.
+ */
+template <typename T>
+class PairColumnSet
+{
+    std::vector<T> firsts;  ///< First component of every row.
+    std::vector<T> seconds; ///< Second component of every row.
+
+    /**
+     * @brief Returns the rows whose bit is set, in row order.
+     */
+    PairColumnSet gather(const std::vector<uint64_t> &bits, size_t matches) const;
+
+    /**
+     * @brief Distinct values of one column as a set.
+     */
+    DataSet<T> distinct(const std::vector<T> &values, const std::string &name) const;
+
+public:
+    /**
+     * @brief Creates an empty set of pairs.
+     */
+    PairColumnSet();
+
+    /**
+     * @brief Builds A × B column by column: every a of A repeated |B| times in
+     *        the first column, B tiled |A| times in the second, in getElements()
+     *        order (the order of DataSet<T>::pairsWith).
+     * @param a Left set.
+     * @param b Right set.
+     * @return The product; its rows are distinct because A and B are sets.
+     */
+    static PairColumnSet product(const DataSet<T> &a, const DataSet<T> &b);
+
+    /**
+     * @brief Splits an existing set of pairs into columns.
+     * @param set The set of pairs.
+     * @return The same pairs, column-wise.
+     */
+    static PairColumnSet fromSet(const DataSet<std::pair<T, T>> &set);
+
+    /**
+     * @brief Adds a pair if it is not present yet. The check scans the first
+     *        column, so build large sets with product() or fromSet() instead.
+     * @return True if the pair was added.
+     */
+    bool insert(const T &first, const T &second);
+
+    /**
+     * @brief Checks whether a pair is present (vectorized scan of the first column).
+     */
+    bool contains(const T &first, const T &second) const;
+
+    /**
+     * @brief Number of pairs.
+     */
+    size_t size() const;
+
+    /**
+     * @brief Returns the pair in a row.
+     * @param row Row index, below size().
+     */
+    std::pair<T, T> at(size_t row) const;
+
+    /**
+     * @brief Returns one column as a contiguous array of size() values.
+     */
+    std::span<const T> column(PairColumn which) const;
+
+    /**
+     * @brief Counts the pairs whose component satisfies `component op value`.
+     */
+    size_t countWhere(PairColumn which, Comparison op, const T &value) const;
+
+    /**
+     * @brief Selects the pairs whose component satisfies `component op value`.
+     *        The predicate is evaluated over the column into a bitmap, then
+     *        both columns are gathered at the set bits.
+     * @param which Column the predicate reads.
+     * @param op Comparison between the component and the value.
+     * @param value Right-hand side of the comparison.
+     * @return The matching pairs, in row order.
+     */
+    PairColumnSet where(PairColumn which, Comparison op, const T &value) const;
+
+    /**
+     * @brief Returns the distinct first components (the domain of the relation).
+     */
+    DataSet<T> domain() const;
+
+    /**
+     * @brief Returns the distinct second components (the range of the relation).
+     */
+    DataSet<T> range() const;
+
+    /**
+     * @brief Composes two relations: (a, c) for every (a, b) of this set and
+     *        (b, c) of other. The other set's first column is sorted once and
+     *        searched for every b; duplicates are removed.
+     * @param other Right-hand relation.
+     * @return The composition, ordered by (a, c).
+     */
+    PairColumnSet join(const PairColumnSet &other) const;
+
+    /**
+     * @brief Converts to a (VECTOR) set of pairs; rows are distinct, so they
+     *        are stored without insert()'s duplicate checks.
+     * @param name Name of the new set.
+     */
+    DataSet<std::pair<T, T>> toDataSet(const std::string &name) const;
+
+    /**
+     * @brief Yields every pair in row order. The set must outlive the generator.
+     */
+    Generator<std::pair<T, T>> values() const;
+
+    /**
+     * @brief Estimates the bytes the columns occupy.
+     */
+    size_t memoryUsage() const;
+};
+
+#include "PairColumnSet.hxx"
+
+#endif // PAIRCOLUMNSET_H
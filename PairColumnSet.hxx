@@ -0,0 +1,278 @@
+// ===================================================================================
+// File:        PairColumnSet.hxx
+// Author:      Group 4
+// Date:        2026-10-18
+// Description: Implementation of the templated class PairColumnSet<T>.
+// ===================================================================================
+// Group 4 | Joel Felipe Martinez | Xamuel Perez | Rafael Held
+
+#ifndef PAIRCOLUMNSET_HXX
+#define PAIRCOLUMNSET_HXX
+
+#include "PairColumnSet.h"
+#include <algorithm> // For std::sort, std::unique, std::equal_range
+#include <bit>       // For std::countr_zero
+
+inline bool parseComparison(std::string_view text, Comparison &op)
+{
+    if (text == "==")
+        op = Comparison::EQUAL;
+    else if (text == "!=")
+        op = Comparison::NOT_EQUAL;
+    else if (text == "<")
+        op = Comparison::LESS;
+    else if (text == "<=")
+        op = Comparison::LESS_EQUAL;
+    else if (text == ">")
+        op = Comparison::GREATER;
+    else if (text == ">=")
+        op = Comparison::GREATER_EQUAL;
+    else
+        return false;
+    return true;
+}
+
+inline const char *comparisonSymbol(Comparison op)
+{
+    switch (op)
+    {
+    case Comparison::EQUAL:
+        return "==";
+    case Comparison::NOT_EQUAL:
+        return "!=";
+    case Comparison::LESS:
+        return "<";
+    case Comparison::LESS_EQUAL:
+        return "<=";
+    case Comparison::GREATER:
+        return ">";
+    default:
+        return ">=";
+    }
+}
+
+template <typename T>
+PairColumnSet<T>::PairColumnSet() : firsts(), seconds() {}
+
+template <typename T>
+PairColumnSet<T> PairColumnSet<T>::product(const DataSet<T> &a, const DataSet<T> &b)
+{
+    std::vector<T> left = a.getElements();
+    std::vector<T> right = b.getElements();
+    PairColumnSet result;
+    result.firsts.reserve(left.size() * right.size());
+    result.seconds.reserve(left.size() * right.size());
+    for (const T &first : left)
+    {
+        result.firsts.insert(result.firsts.end(), right.size(), first);
+        result.seconds.insert(result.seconds.end(), right.begin(), right.end());
+    }
+    return result;
+}
+
+template <typename T>
+PairColumnSet<T> PairColumnSet<T>::fromSet(const DataSet<std::pair<T, T>> &set)
+{
+    PairColumnSet result;
+    result.firsts.reserve(set.size());
+    result.seconds.reserve(set.size());
+    for (const std::pair<T, T> &pair : set.values())
+    {
+        result.firsts.push_back(pair.first);
+        result.seconds.push_back(pair.second);
+    }
+    return result;
+}
+
+template <typename T>
+bool PairColumnSet<T>::insert(const T &first, const T &second)
+{
+    if (this->contains(first, second))
+    {
+        return false;
+    }
+    firsts.push_back(first);
+    seconds.push_back(second);
+    return true;
+}
+
+template <typename T>
+bool PairColumnSet<T>::contains(const T &first, const T &second) const
+{
+    std::vector<uint64_t> bits((firsts.size() + 63) / 64, 0);
+    if (simdCompare(firsts.data(), firsts.size(), Comparison::EQUAL, first, bits.data()) == 0)
+    {
+        return false;
+    }
+    for (size_t word = 0; word < bits.size(); ++word)
+    {
+        for (uint64_t rest = bits[word]; rest != 0; rest &= rest - 1)
+        {
+            if (seconds[word * 64 + std::countr_zero(rest)] == second)
+            {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+template <typename T>
+size_t PairColumnSet<T>::size() const
+{
+    return firsts.size();
+}
+
+template <typename T>
+std::pair<T, T> PairColumnSet<T>::at(size_t row) const
+{
+    return std::pair<T, T>(firsts[row], seconds[row]);
+}
+
+template <typename T>
+std::span<const T> PairColumnSet<T>::column(PairColumn which) const
+{
+    return which == PairColumn::FIRST ? std::span<const T>(firsts) : std::span<const T>(seconds);
+}
+
+template <typename T>
+size_t PairColumnSet<T>::countWhere(PairColumn which, Comparison op, const T &value) const
+{
+    std::span<const T> values = this->column(which);
+    std::vector<uint64_t> bits((values.size() + 63) / 64, 0);
+    return simdCompare(values.data(), values.size(), op, value, bits.data());
+}
+
+template <typename T>
+PairColumnSet<T> PairColumnSet<T>::where(PairColumn which, Comparison op, const T &value) const
+{
+    std::span<const T> values = this->column(which);
+    std::vector<uint64_t> bits((values.size() + 63) / 64, 0);
+    size_t matches = simdCompare(values.data(), values.size(), op, value, bits.data());
+    return this->gather(bits, matches);
+}
+
+template <typename T>
+PairColumnSet<T> PairColumnSet<T>::gather(const std::vector<uint64_t> &bits, size_t matches) const
+{
+    PairColumnSet result;
+    result.firsts.reserve(matches);
+    result.seconds.reserve(matches);
+    for (size_t word = 0; word < bits.size(); ++word)
+    {
+        if (bits[word] == ~uint64_t(0))
+        {
+            // Whole word selected: copy 64 rows of each column at once
+            result.firsts.insert(result.firsts.end(), firsts.begin() + word * 64,
+                                 firsts.begin() + word * 64 + 64);
+            result.seconds.insert(result.seconds.end(), seconds.begin() + word * 64,
+                                  seconds.begin() + word * 64 + 64);
+            continue;
+        }
+        for (uint64_t rest = bits[word]; rest != 0; rest &= rest - 1)
+        {
+            size_t row = word * 64 + std::countr_zero(rest);
+            result.firsts.push_back(firsts[row]);
+            result.seconds.push_back(seconds[row]);
+        }
+    }
+    return result;
+}
+
+template <typename T>
+DataSet<T> PairColumnSet<T>::distinct(const std::vector<T> &values, const std::string &name) const
+{
+    std::vector<T> sorted = values;
+    std::sort(sorted.begin(), sorted.end());
+    sorted.erase(std::unique(sorted.begin(), sorted.end()), sorted.end());
+    DataSet<T> result(name);
+    result.useRepresentation(SetRepresentation::TREE); // Keep each insert O(log n)
+    for (const T &value : sorted)
+    {
+        result.insert(value);
+    }
+    return result;
+}
+
+template <typename T>
+DataSet<T> PairColumnSet<T>::domain() const
+{
+    return this->distinct(firsts, "domain");
+}
+
+template <typename T>
+DataSet<T> PairColumnSet<T>::range() const
+{
+    return this->distinct(seconds, "range");
+}
+
+template <typename T>
+PairColumnSet<T> PairColumnSet<T>::join(const PairColumnSet &other) const
+{
+    // Rows of other ordered by their first component
+    std::vector<std::pair<T, T>> index;
+    index.reserve(other.size());
+    for (size_t row = 0; row < other.size(); ++row)
+    {
+        index.emplace_back(other.firsts[row], other.seconds[row]);
+    }
+    std::sort(index.begin(), index.end());
+    std::vector<T> keys;
+    keys.reserve(index.size());
+    for (const std::pair<T, T> &pair : index)
+    {
+        keys.push_back(pair.first);
+    }
+
+    std::vector<std::pair<T, T>> composed;
+    for (size_t row = 0; row < firsts.size(); ++row)
+    {
+        auto [from, to] = std::equal_range(keys.begin(), keys.end(), seconds[row]);
+        for (; from != to; ++from)
+        {
+            composed.emplace_back(firsts[row], index[from - keys.begin()].second);
+        }
+    }
+    std::sort(composed.begin(), composed.end());
+    composed.erase(std::unique(composed.begin(), composed.end()), composed.end());
+
+    PairColumnSet result;
+    result.firsts.reserve(composed.size());
+    result.seconds.reserve(composed.size());
+    for (const std::pair<T, T> &pair : composed)
+    {
+        result.firsts.push_back(pair.first);
+        result.seconds.push_back(pair.second);
+    }
+    return result;
+}
+
+template <typename T>
+DataSet<std::pair<T, T>> PairColumnSet<T>::toDataSet(const std::string &name) const
+{
+    DataSet<std::pair<T, T>> result(name);
+    result.elements.reserve(firsts.size());
+    for (size_t row = 0; row < firsts.size(); ++row)
+    {
+        result.elements.emplace_back(firsts[row], seconds[row]);
+    }
+    result.version.add(1); // Its statistics are rebuilt on demand
+    return result;
+}
+
+template <typename T>
+Generator<std::pair<T, T>> PairColumnSet<T>::values() const
+{
+    for (size_t row = 0; row < firsts.size(); ++row)
+    {
+        co_yield std::pair<T, T>(firsts[row], seconds[row]);
+    }
+}
+
+template <typename T>
+size_t PairColumnSet<T>::memoryUsage() const
+{
+    return sizeof(PairColumnSet<T>) + (firsts.capacity() + seconds.capacity()) * sizeof(T);
+}
+
+#endif // PAIRCOLUMNSET_HXX
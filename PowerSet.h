@@ -0,0 +1,165 @@
+// ===================================================================================
+// File:        PowerSet.h
+// Author:      Group 4
+// Date:        2026-10-18
+// Description: Declaration of CompactSubset<T> and PowerSet<T>, a nameless, compact
+//              representation of subsets and of whole power sets.
+//
+//              A CompactSubset is a bitmask over the element array of its parent
+//              set (element i of getElements() is bit i), shared by every subset
+//              of that parent. A PowerSet stores nothing per subset at all: its
+//              i-th subset is the one whose mask is i. Subsets therefore cost
+//              n bits instead of a full DataSet<T> with its own name, storage
+//              and statistics, and are only materialized one at a time, on
+//              request. DataSet<T>::powerSet() returns this form, and
+//              PowerSet<T>::subsets() is the one enumeration of a power set.
+//
+//              Sets of 64 or more elements have no power set that fits in memory
+//              or time, so they are refused.
+//
+//              Supported operations:
+//              ----------------------------------------------------------------------
+//              CompactSubset(std::shared_ptr<const std::vector<T>> base, uint64_t mask)
+//                  The subset of `base` selected by the bits of `mask`.
+//
+//              size_t size() const / uint64_t mask() const
+//              bool contains(const T& value) const
+//              std::vector<T> getElements() const / Generator<T> values() const
+//                  Read the subset (elements in parent order).
+//
+//              DataSet<T> toDataSet(const std::string& name = "") const
+//                  Materializes the subset as a regular (VECTOR) DataSet<T>.
+//
+//              PowerSet(const DataSet<T>& set)
+//                  The power set of a set (copies its elements once).
+//
+//              uint64_t size() const / CompactSubset<T> operator[](uint64_t index) const
+//              Generator<CompactSubset<T>> subsets() const
+//                  2^n, the subset with mask `index`, and every subset in mask order.
+// ===================================================================================
+
+#ifndef POWERSET_H
+#define POWERSET_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "DataSet.h"
+#include "Generator.h"
+
+/**
+ * @class CompactSubset
+ * @brief A subset of a parent set's elements, stored as a 64-bit mask plus a
+ *        pointer to the parent's element array (shared, never copied).
+ *
+ * @tparam T Type of the elements.
+ */
+template <typename T>
+class CompactSubset
+{
+    std::shared_ptr<const std::vector<T>> base; ///< Elements of the parent set.
+    uint64_t bits;                              ///< Bit i set: base[i] belongs to the subset.
+
+public:
+    /**
+     * @brief Creates the subset of `base` selected by `mask`.
+     * @param parent Elements of the parent set (at most 64).
+     * @param mask Bit i selects (*parent)[i]; bits past the parent's size are ignored.
+     */
+    CompactSubset(std::shared_ptr<const std::vector<T>> parent, uint64_t mask);
+
+    /**
+     * @brief Number of elements in the subset (population count of the mask).
+     */
+    size_t size() const;
+
+    /**
+     * @brief The selecting mask.
+     */
+    uint64_t mask() const;
+
+    /**
+     * @brief Checks whether a value belongs to the subset (scans the parent's
+     *        elements, of which there are at most 64).
+     * @param value The value to look for.
+     * @return True if found.
+     */
+    bool contains(const T &value) const;
+
+    /**
+     * @brief Returns the elements of the subset, in parent order.
+     */
+    std::vector<T> getElements() const;
+
+    /**
+     * @brief Yields the elements of the subset lazily, in parent order. The
+     *        subset must outlive the generator.
+     */
+    Generator<T> values() const;
+
+    /**
+     * @brief Materializes the subset as a VECTOR DataSet<T>.
+     * @param name Name of the new set (empty by default).
+     * @return The subset as a DataSet<T>.
+     */
+    DataSet<T> toDataSet(const std::string &name = "") const;
+
+    /**
+     * @brief True if both subsets hold the same elements (mask comparison when
+     *        they share a parent).
+     */
+    bool operator==(const CompactSubset &other) const;
+};
+
+/**
+ * @class PowerSet
+ * @brief The power set of a set, stored as the parent's elements alone; the
+ *        2^n subsets are produced on demand as CompactSubset values.
+ *
+ * @tparam T Type of the elements.
+ */
+template <typename T>
+class PowerSet
+{
+    SetName name;                               ///< Name of the parent set.
+    std::shared_ptr<const std::vector<T>> base; ///< Elements of the parent set.
+
+public:
+    /// Largest parent size: 2^MAX_ELEMENTS subsets still fit the 64-bit masks.
+    static constexpr size_t MAX_ELEMENTS = 63;
+
+    /**
+     * @brief Captures the elements of a set, in getElements() order.
+     * @param set The parent set.
+     * @throws std::runtime_error if the set has more than MAX_ELEMENTS elements.
+     */
+    explicit PowerSet(const DataSet<T> &set);
+
+    /**
+     * @brief Number of subsets, 2^n.
+     */
+    uint64_t size() const;
+
+    /**
+     * @brief Returns the subset whose mask is `index` (0: the empty set).
+     * @param index Mask of the subset, below size().
+     */
+    CompactSubset<T> operator[](uint64_t index) const;
+
+    /**
+     * @brief Yields every subset in mask order (binary counting: the empty set
+     *        first, the whole set last). Only the current subset exists at a time.
+     */
+    Generator<CompactSubset<T>> subsets() const;
+
+    /**
+     * @brief Estimates the bytes the power set occupies (parent elements only).
+     */
+    size_t memoryUsage() const;
+};
+
+#include "PowerSet.hxx"
+
+#endif // POWERSET_H
@@ -0,0 +1,147 @@
+// ===================================================================================
+// File:        PowerSet.hxx
+// Author:      Group 4
+// Date:        2026-10-18
+// Description: Implementation of the templated classes CompactSubset<T> and PowerSet<T>.
+// ===================================================================================
+// Group 4 | Joel Felipe Martinez | Xamuel Perez | Rafael Held
+
+#ifndef POWERSET_HXX
+#define POWERSET_HXX
+
+#include "PowerSet.h"
+#include <bit>       // For std::popcount, std::countr_zero
+#include <stdexcept> // For std::runtime_error
+
+template <typename T>
+CompactSubset<T>::CompactSubset(std::shared_ptr<const std::vector<T>> parent, uint64_t mask)
+    : base(std::move(parent)), bits(mask)
+{
+    if (base->size() < 64)
+    {
+        bits &= (uint64_t(1) << base->size()) - 1;
+    }
+}
+
+template <typename T>
+size_t CompactSubset<T>::size() const
+{
+    return static_cast<size_t>(std::popcount(bits));
+}
+
+template <typename T>
+uint64_t CompactSubset<T>::mask() const
+{
+    return bits;
+}
+
+template <typename T>
+bool CompactSubset<T>::contains(const T &value) const
+{
+    for (uint64_t rest = bits; rest != 0; rest &= rest - 1)
+    {
+        if ((*base)[std::countr_zero(rest)] == value)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+template <typename T>
+std::vector<T> CompactSubset<T>::getElements() const
+{
+    std::vector<T> items;
+    items.reserve(this->size());
+    for (uint64_t rest = bits; rest != 0; rest &= rest - 1)
+    {
+        items.push_back((*base)[std::countr_zero(rest)]);
+    }
+    return items;
+}
+
+template <typename T>
+Generator<T> CompactSubset<T>::values() const
+{
+    for (uint64_t rest = bits; rest != 0; rest &= rest - 1)
+    {
+        co_yield (*base)[std::countr_zero(rest)];
+    }
+}
+
+/**
+ * @brief Materializes the subset. Its elements are distinct by construction,
+ *        so they are stored directly instead of being inserted one by one.
+ */
+template <typename T>
+DataSet<T> CompactSubset<T>::toDataSet(const std::string &name) const
+{
+    DataSet<T> subset(name);
+    subset.elements = this->getElements();
+    subset.version.add(1); // Its statistics are rebuilt on demand
+    return subset;
+}
+
+template <typename T>
+bool CompactSubset<T>::operator==(const CompactSubset &other) const
+{
+    if (base == other.base)
+    {
+        return bits == other.bits;
+    }
+    if (this->size() != other.size())
+    {
+        return false;
+    }
+    for (uint64_t rest = bits; rest != 0; rest &= rest - 1)
+    {
+        if (!other.contains((*base)[std::countr_zero(rest)]))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename T>
+PowerSet<T>::PowerSet(const DataSet<T> &set)
+    : name(set.getSetName()), base()
+{
+    if (set.size() > MAX_ELEMENTS)
+    {
+        throw std::runtime_error("Set '" + name.str() + "' has " + std::to_string(set.size()) +
+                                 " elements; power sets are limited to " +
+                                 std::to_string(MAX_ELEMENTS) + ".");
+    }
+    base = std::make_shared<const std::vector<T>>(set.getElements());
+}
+
+template <typename T>
+uint64_t PowerSet<T>::size() const
+{
+    return uint64_t(1) << base->size();
+}
+
+template <typename T>
+CompactSubset<T> PowerSet<T>::operator[](uint64_t index) const
+{
+    return CompactSubset<T>(base, index);
+}
+
+template <typename T>
+Generator<CompactSubset<T>> PowerSet<T>::subsets() const
+{
+    uint64_t count = this->size();
+    for (uint64_t mask = 0; mask < count; ++mask)
+    {
+        co_yield CompactSubset<T>(base, mask);
+    }
+}
+
+template <typename T>
+size_t PowerSet<T>::memoryUsage() const
+{
+    return sizeof(PowerSet<T>) + name.memoryUsage() + base->capacity() * sizeof(T);
+}
+
+#endif // POWERSET_HXX
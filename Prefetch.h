@@ -0,0 +1,29 @@
+// ===================================================================================
+// File:        Prefetch.h
+// Author:      Group 4
+// Date:        2026-10-18
+// Description: Software prefetch hint shared by the ordered and hashed set layouts.
+//
+//              Supported operations:
+//              ----------------------------------------------------------------------
+//              void prefetchRead(const void* address)
+//                  Asks the CPU to start loading the cache line holding `address`.
+// ===================================================================================
+
+#ifndef PREFETCH_H
+#define PREFETCH_H
+
+/**
+ * @brief Hints the CPU to fetch the cache line containing `address` for reading.
+ *        The address is never dereferenced, so it may lie past the array end.
+ */
+inline void prefetchRead(const void *address)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(address, 0, 3);
+#else
+    (void)address;
+#endif
+}
+
+#endif // PREFETCH_H
@@ -0,0 +1,74 @@
+// ===================================================================================
+// File:        RadixPartition.h
+// Author:      Group 4
+// Date:        2026-10-18
+// Description: Radix-partitioned set algebra for operands much larger than the
+//              caches. A plain hash build/probe over two huge sets touches a
+//              random cache line, and often a random page, per element; here
+//              both operands are first scattered by the top bits of their
+//              hashes into partitions small enough for the L2 cache, in one
+//              pass or two (each with at most 2^PARTITION_PASS_BITS outputs, so
+//              that the scatter stays within TLB reach). Equal values land in
+//              the partition with the same index, so the operation then runs
+//              on every pair of partitions independently, with a small hash
+//              table that never leaves the cache. Partitioning is sequential
+//              streaming, so the cost per element stays flat as the sets grow.
+//
+//              Partition passes scatter chunks in parallel; partition pairs are
+//              combined in parallel.
+//
+//              Supported operations:
+//              ----------------------------------------------------------------------
+//              std::vector<T> partitionedCombine(std::span<const T> a, std::span<const T> b,
+//                                                bool keepOnlyA, bool keepBoth, bool keepOnlyB,
+//                                                TaskScheduler* scheduler)
+//                  Union, intersection, difference or symmetric difference of two
+//                  duplicate-free arrays, in partition (hash) order.
+//
+//              unsigned partitionBits(size_t bytes)
+//                  Number of hash bits that splits `bytes` into cache-sized partitions.
+// ===================================================================================
+
+#ifndef RADIXPARTITION_H
+#define RADIXPARTITION_H
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+#include "TaskScheduler.h"
+
+/// Bytes of both operands a partition pair should hold: about half the L2 cache,
+/// leaving room for the bucket's hash table.
+constexpr size_t PARTITION_TARGET_BYTES = 512 * 1024;
+
+/// Hash bits consumed by one partition pass (1024 outputs per pass).
+constexpr unsigned PARTITION_PASS_BITS = 10;
+
+/**
+ * @brief Returns the number of hash bits (at most 2 * PARTITION_PASS_BITS)
+ *        that splits `bytes` of input into partitions of about
+ *        PARTITION_TARGET_BYTES.
+ */
+unsigned partitionBits(size_t bytes);
+
+/**
+ * @brief Combines two duplicate-free arrays by radix partitioning: a value is
+ *        kept if it is only in a and keepOnlyA, in both and keepBoth, or only
+ *        in b and keepOnlyB. (true, true, true) is a union, (false, true, false)
+ *        an intersection, (true, false, false) a difference and (true, false, true)
+ *        a symmetric difference.
+ * @tparam T Element type with std::hash<T> and operator==.
+ * @param a Left operand.
+ * @param b Right operand.
+ * @param scheduler Pool for the partition passes and the partition pairs
+ *        (nullptr: sequential).
+ * @return The kept values, grouped by partition (neither sorted nor in input order).
+ */
+template <typename T>
+std::vector<T> partitionedCombine(std::span<const T> a, std::span<const T> b, bool keepOnlyA,
+                                  bool keepBoth, bool keepOnlyB, TaskScheduler *scheduler = nullptr);
+
+#include "RadixPartition.hxx"
+
+#endif // RADIXPARTITION_H
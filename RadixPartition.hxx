@@ -0,0 +1,291 @@
+// ===================================================================================
+// File:        RadixPartition.hxx
+// Author:      Group 4
+// Date:        2026-10-18
+// Description: Implementation of the radix-partitioned set operations.
+// ===================================================================================
+// Group 4 | Joel Felipe Martinez | Xamuel Perez | Rafael Held
+
+#ifndef RADIXPARTITION_HXX
+#define RADIXPARTITION_HXX
+
+#include "RadixPartition.h"
+#include <algorithm>  // For std::min, std::max
+#include <bit>        // For std::bit_ceil, std::bit_width
+#include <functional> // For std::hash
+
+namespace partition_detail
+{
+    /// Chunks per thread in a parallel partition pass.
+    constexpr size_t CHUNKS_PER_THREAD = 4;
+
+    /// Elements a parallel partition pass needs at least per chunk.
+    constexpr size_t MIN_CHUNK = 1 << 16;
+
+    /**
+     * @brief std::hash spread by the MurmurHash3 finalizer. The top bits pick
+     *        the partition and the low bits the slot of the bucket table.
+     */
+    template <typename T>
+    inline uint64_t mixedHash(const T &value)
+    {
+        uint64_t hash = static_cast<uint64_t>(std::hash<T>{}(value));
+        hash ^= hash >> 33;
+        hash *= 0xff51afd7ed558ccdULL;
+        hash ^= hash >> 33;
+        hash *= 0xc4ceb9fe1a85ec53ULL;
+        hash ^= hash >> 33;
+        return hash;
+    }
+
+    template <typename T>
+    inline size_t partitionOf(const T &value, unsigned shift, unsigned bits)
+    {
+        return static_cast<size_t>((mixedHash(value) >> shift) & ((uint64_t(1) << bits) - 1));
+    }
+
+    /**
+     * @brief Scatters in[0, count) to out by `bits` hash bits from `shift` on.
+     *        bounds receives 2^bits + 1 offsets: partition p is out[bounds[p], bounds[p + 1]).
+     *        With a scheduler, chunks of the input count and scatter in parallel.
+     */
+    template <typename T>
+    void partitionByHash(const T *in, T *out, size_t count, unsigned shift, unsigned bits,
+                         std::vector<size_t> &bounds, TaskScheduler *scheduler)
+    {
+        const size_t fanout = size_t(1) << bits;
+        size_t chunks = 1;
+        if (scheduler != nullptr && scheduler->threadCount() > 1 && count >= 2 * MIN_CHUNK)
+        {
+            chunks = std::min(scheduler->threadCount() * CHUNKS_PER_THREAD, count / MIN_CHUNK);
+        }
+        auto chunkBegin = [count, chunks](size_t c)
+        { return count * c / chunks; };
+        auto forEachChunk = [&](auto &&body)
+        {
+            if (chunks == 1)
+            {
+                body(0);
+                return;
+            }
+            scheduler->parallelFor(0, chunks, 1, [&body](size_t lo, size_t hi)
+                                   {
+                for (size_t c = lo; c < hi; ++c)
+                {
+                    body(c);
+                } });
+        };
+
+        // offsets[c * fanout + p]: first count, then where chunk c writes partition p
+        std::vector<size_t> offsets(chunks * fanout, 0);
+        forEachChunk([&](size_t c)
+                     {
+            size_t *local = offsets.data() + c * fanout;
+            for (size_t i = chunkBegin(c); i < chunkBegin(c + 1); ++i)
+            {
+                ++local[partitionOf(in[i], shift, bits)];
+            } });
+
+        bounds.assign(fanout + 1, 0);
+        size_t position = 0;
+        for (size_t p = 0; p < fanout; ++p)
+        {
+            bounds[p] = position;
+            for (size_t c = 0; c < chunks; ++c)
+            {
+                size_t n = offsets[c * fanout + p];
+                offsets[c * fanout + p] = position;
+                position += n;
+            }
+        }
+        bounds[fanout] = position;
+
+        forEachChunk([&](size_t c)
+                     {
+            size_t *local = offsets.data() + c * fanout;
+            for (size_t i = chunkBegin(c); i < chunkBegin(c + 1); ++i)
+            {
+                out[local[partitionOf(in[i], shift, bits)]++] = in[i];
+            } });
+    }
+
+    /**
+     * @brief Partitions `values` by `totalBits` hash bits, in one pass, or in two
+     *        when one pass would exceed PARTITION_PASS_BITS outputs (the second
+     *        pass runs inside every first-level partition, in parallel).
+     * @param bounds Receives 2^totalBits + 1 partition offsets into the result.
+     * @return The partitioned copy of values.
+     */
+    template <typename T>
+    std::vector<T> partitionAll(std::span<const T> values, unsigned totalBits,
+                                std::vector<size_t> &bounds, TaskScheduler *scheduler)
+    {
+        unsigned firstBits = std::min(totalBits, PARTITION_PASS_BITS);
+        unsigned secondBits = totalBits - firstBits;
+        std::vector<T> first(values.size());
+        std::vector<size_t> firstBounds;
+        partitionByHash(values.data(), first.data(), values.size(), 64 - firstBits, firstBits,
+                        firstBounds, scheduler);
+        if (secondBits == 0)
+        {
+            bounds.swap(firstBounds);
+            return first;
+        }
+
+        std::vector<T> second(values.size());
+        const size_t firstFanout = size_t(1) << firstBits;
+        const size_t secondFanout = size_t(1) << secondBits;
+        bounds.assign((firstFanout << secondBits) + 1, 0);
+        auto refine = [&](size_t lo, size_t hi)
+        {
+            std::vector<size_t> local;
+            for (size_t p = lo; p < hi; ++p)
+            {
+                size_t begin = firstBounds[p];
+                partitionByHash(first.data() + begin, second.data() + begin,
+                                firstBounds[p + 1] - begin, 64 - totalBits, secondBits, local, nullptr);
+                for (size_t q = 0; q < secondFanout; ++q)
+                {
+                    bounds[p * secondFanout + q] = begin + local[q];
+                }
+            }
+        };
+        if (scheduler != nullptr)
+        {
+            scheduler->parallelFor(0, firstFanout, 1, refine);
+        }
+        else
+        {
+            refine(0, firstFanout);
+        }
+        bounds.back() = values.size();
+        return second;
+    }
+
+    /**
+     * @brief Combines one partition pair through an open-addressing table over
+     *        b's partition (linear probing on the low hash bits).
+     * @param slots Table storage reused across the partitions of one task, so
+     *        that it stays cached instead of being reallocated per partition.
+     */
+    template <typename T>
+    void combineBucket(std::span<const T> a, std::span<const T> b, bool keepOnlyA, bool keepBoth,
+                       bool keepOnlyB, std::vector<uint32_t> &slots, std::vector<T> &out)
+    {
+        const size_t capacity = std::bit_ceil(std::max<size_t>(2 * b.size(), 16));
+        const size_t mask = capacity - 1;
+        slots.assign(capacity, 0); // 1 + index into b; 0 marks an empty slot
+        for (size_t j = 0; j < b.size(); ++j)
+        {
+            size_t slot = static_cast<size_t>(mixedHash(b[j])) & mask;
+            while (slots[slot] != 0)
+            {
+                slot = (slot + 1) & mask;
+            }
+            slots[slot] = static_cast<uint32_t>(j + 1);
+        }
+
+        std::vector<unsigned char> matched(keepOnlyB ? b.size() : 0, 0);
+        for (const T &value : a)
+        {
+            size_t slot = static_cast<size_t>(mixedHash(value)) & mask;
+            bool found = false;
+            while (slots[slot] != 0)
+            {
+                size_t j = slots[slot] - 1;
+                if (b[j] == value)
+                {
+                    found = true;
+                    if (keepOnlyB)
+                    {
+                        matched[j] = 1;
+                    }
+                    break;
+                }
+                slot = (slot + 1) & mask;
+            }
+            if (found ? keepBoth : keepOnlyA)
+            {
+                out.push_back(value);
+            }
+        }
+        if (keepOnlyB)
+        {
+            for (size_t j = 0; j < b.size(); ++j)
+            {
+                if (!matched[j])
+                {
+                    out.push_back(b[j]);
+                }
+            }
+        }
+    }
+} // namespace partition_detail
+
+inline unsigned partitionBits(size_t bytes)
+{
+    size_t partitions = bytes / PARTITION_TARGET_BYTES;
+    unsigned bits = partitions <= 1 ? 0 : static_cast<unsigned>(std::bit_width(partitions - 1));
+    return std::min(bits, 2 * PARTITION_PASS_BITS);
+}
+
+template <typename T>
+std::vector<T> partitionedCombine(std::span<const T> a, std::span<const T> b, bool keepOnlyA,
+                                  bool keepBoth, bool keepOnlyB, TaskScheduler *scheduler)
+{
+    using namespace partition_detail;
+    unsigned bits = partitionBits((a.size() + b.size()) * sizeof(T));
+    std::vector<size_t> boundsA, boundsB;
+    std::vector<T> partsA, partsB;
+    if (bits == 0)
+    {
+        boundsA = {0, a.size()};
+        boundsB = {0, b.size()};
+        partsA.assign(a.begin(), a.end());
+        partsB.assign(b.begin(), b.end());
+    }
+    else
+    {
+        partsA = partitionAll(a, bits, boundsA, scheduler);
+        partsB = partitionAll(b, bits, boundsB, scheduler);
+    }
+
+    // Every partition pair is independent: combine them on the pool
+    const size_t partitions = boundsA.size() - 1;
+    std::vector<std::vector<T>> results(partitions);
+    auto combine = [&](size_t lo, size_t hi)
+    {
+        std::vector<uint32_t> slots;
+        for (size_t p = lo; p < hi; ++p)
+        {
+            std::span<const T> sliceA(partsA.data() + boundsA[p], boundsA[p + 1] - boundsA[p]);
+            std::span<const T> sliceB(partsB.data() + boundsB[p], boundsB[p + 1] - boundsB[p]);
+            results[p].reserve(keepOnlyA * sliceA.size() + keepOnlyB * sliceB.size() +
+                               (keepBoth ? std::min(sliceA.size(), sliceB.size()) : 0));
+            combineBucket(sliceA, sliceB, keepOnlyA, keepBoth, keepOnlyB, slots, results[p]);
+        }
+    };
+    if (scheduler != nullptr)
+    {
+        scheduler->parallelFor(0, partitions, 1, combine);
+    }
+    else
+    {
+        combine(0, partitions);
+    }
+
+    size_t total = 0;
+    for (const std::vector<T> &part : results)
+    {
+        total += part.size();
+    }
+    std::vector<T> combined;
+    combined.reserve(total);
+    for (const std::vector<T> &part : results)
+    {
+        combined.insert(combined.end(), part.begin(), part.end());
+    }
+    return combined;
+}
+
+#endif // RADIXPARTITION_HXX
@@ -0,0 +1,84 @@
+// ===================================================================================
+// File:        RadixSort.h
+// Author:      Group 4
+// Date:        2026-10-18
+// Description: Least-significant-digit radix sort for 4- and 8-byte integer keys,
+//              optionally parallelized on a TaskScheduler, and the sort-and-dedupe
+//              step the bulk loader builds sets with.
+//
+//              Keys are sorted 11 bits at a time (3 passes for 32-bit keys, 6 for
+//              64-bit ones), least significant digit first, by counting sort
+//              between the array and one scratch buffer: O(n) per pass instead
+//              of O(n log n) comparisons. One read of the input counts all
+//              digits up front, so digits every key shares (the high bits of
+//              small values, typically) are skipped. In parallel, the
+//              array is cut into fixed chunks: every chunk counts its digits,
+//              a prefix sum over all chunk counts gives each chunk its own
+//              output ranges, and the chunks scatter concurrently.
+//
+//              Supported operations:
+//              ----------------------------------------------------------------------
+//              void radixSort(std::vector<T>& values, TaskScheduler* scheduler)
+//                  Sorts integers ascending (signed keys included).
+//
+//              void sortValues(std::vector<T>& values, TaskScheduler* scheduler)
+//                  radixSort for integer types, std::sort for any other type.
+//
+//              void sortUnique(std::vector<T>& values, TaskScheduler* scheduler)
+//                  Sorts and removes duplicates in place.
+// ===================================================================================
+
+#ifndef RADIXSORT_H
+#define RADIXSORT_H
+
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+#include "TaskScheduler.h"
+
+/**
+ * @brief True for key types radixSort accepts: 4- or 8-byte integers.
+ */
+template <typename T>
+struct IsRadixSortable
+    : std::integral_constant<bool, std::is_integral<T>::value && !std::is_same<T, bool>::value &&
+                                       (sizeof(T) == 4 || sizeof(T) == 8)>
+{
+};
+
+/// Arrays smaller than this are sorted with std::sort (every pass clears 2048 counters).
+constexpr size_t RADIX_SORT_MIN = 2048;
+
+/// Arrays from this size on are sorted in parallel when a scheduler is given.
+constexpr size_t PARALLEL_RADIX_SORT_MIN = 1 << 18;
+
+/**
+ * @brief Sorts integer keys in ascending order by LSD radix sort, 11 bits per
+ *        pass, through a scratch buffer of the same size. Per-chunk counts are
+ *        recounted before every pass after the first one that moved keys.
+ * @tparam T A type with IsRadixSortable<T>.
+ * @param values Keys to sort.
+ * @param scheduler Pool for the counting and scatter passes (nullptr: sequential).
+ */
+template <typename T>
+void radixSort(std::vector<T> &values, TaskScheduler *scheduler = nullptr);
+
+/**
+ * @brief Sorts in ascending order with the fastest method available for T.
+ * @param values Values to sort (T needs operator< unless it is radix-sortable).
+ * @param scheduler Pool for radixSort (nullptr: sequential).
+ */
+template <typename T>
+void sortValues(std::vector<T> &values, TaskScheduler *scheduler = nullptr);
+
+/**
+ * @brief Sorts and removes duplicates in place, leaving strictly ascending values.
+ * @param values Values to sort.
+ * @param scheduler Pool for radixSort (nullptr: sequential).
+ */
+template <typename T>
+void sortUnique(std::vector<T> &values, TaskScheduler *scheduler = nullptr);
+
+#include "RadixSort.hxx"
+
+#endif // RADIXSORT_H
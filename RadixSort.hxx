@@ -0,0 +1,192 @@
+// ===================================================================================
+// File:        RadixSort.hxx
+// Author:      Group 4
+// Date:        2026-10-18
+// Description: Implementation of the radix sort and of the sort helpers built on it.
+// ===================================================================================
+// Group 4 | Joel Felipe Martinez | Xamuel Perez | Rafael Held
+
+#ifndef RADIXSORT_HXX
+#define RADIXSORT_HXX
+
+#include "RadixSort.h"
+#include <algorithm> // For std::sort, std::unique, std::min
+#include <array>
+
+namespace radix_detail
+{
+    /// Bits sorted per pass, and the number of buckets they give (2048 counters
+    /// of 8 bytes: one histogram stays in the L1 cache during a scatter).
+    constexpr unsigned DIGIT_BITS = 11;
+    constexpr size_t BUCKETS = size_t(1) << DIGIT_BITS;
+
+    /// Chunks per thread in parallel passes, so that stealing evens out the load.
+    constexpr size_t CHUNKS_PER_THREAD = 4;
+
+    typedef std::array<size_t, BUCKETS> Histogram;
+
+    /**
+     * @brief Maps a key to an unsigned value with the same order: the sign bit
+     *        of signed keys is flipped, so negative keys sort first.
+     */
+    template <typename T>
+    inline typename std::make_unsigned<T>::type orderedBits(T value)
+    {
+        typedef typename std::make_unsigned<T>::type Unsigned;
+        Unsigned bits = static_cast<Unsigned>(value);
+        if constexpr (std::is_signed<T>::value)
+        {
+            bits ^= Unsigned(1) << (sizeof(T) * 8 - 1);
+        }
+        return bits;
+    }
+
+    template <typename T>
+    inline size_t digitOf(T value, unsigned pass)
+    {
+        return static_cast<size_t>((orderedBits(value) >> (pass * DIGIT_BITS)) & (BUCKETS - 1));
+    }
+
+    /**
+     * @brief Moves src[lo, hi) to dst by the digit of `pass`; offsets[d] is where
+     *        the next key with digit d goes and is advanced as keys are written.
+     */
+    template <typename T>
+    inline void scatter(const T *src, T *dst, size_t lo, size_t hi, unsigned pass, Histogram &offsets)
+    {
+        for (size_t i = lo; i < hi; ++i)
+        {
+            dst[offsets[digitOf(src[i], pass)]++] = src[i];
+        }
+    }
+} // namespace radix_detail
+
+template <typename T>
+void radixSort(std::vector<T> &values, TaskScheduler *scheduler)
+{
+    static_assert(IsRadixSortable<T>::value, "radixSort needs a 4- or 8-byte integral type");
+    using namespace radix_detail;
+    constexpr unsigned PASSES = (sizeof(T) * 8 + DIGIT_BITS - 1) / DIGIT_BITS;
+
+    const size_t count = values.size();
+    if (count < RADIX_SORT_MIN)
+    {
+        std::sort(values.begin(), values.end());
+        return;
+    }
+    size_t chunks = 1;
+    if (scheduler != nullptr && scheduler->threadCount() > 1 && count >= PARALLEL_RADIX_SORT_MIN)
+    {
+        chunks = std::min(scheduler->threadCount() * CHUNKS_PER_THREAD, count / RADIX_SORT_MIN);
+    }
+    auto chunkBegin = [count, chunks](size_t c)
+    { return count * c / chunks; };
+    auto forEachChunk = [&](auto &&body)
+    {
+        if (chunks == 1)
+        {
+            body(0);
+            return;
+        }
+        scheduler->parallelFor(0, chunks, 1, [&body](size_t lo, size_t hi)
+                               {
+            for (size_t c = lo; c < hi; ++c)
+            {
+                body(c);
+            } });
+    };
+
+    // One read counts every digit of every chunk
+    std::vector<std::array<Histogram, PASSES>> counts(chunks);
+    forEachChunk([&](size_t c)
+                 {
+        std::array<Histogram, PASSES> &local = counts[c];
+        for (Histogram &histogram : local)
+        {
+            histogram.fill(0);
+        }
+        for (size_t i = chunkBegin(c); i < chunkBegin(c + 1); ++i)
+        {
+            auto bits = orderedBits(values[i]);
+            for (unsigned pass = 0; pass < PASSES; ++pass)
+            {
+                ++local[pass][(bits >> (pass * DIGIT_BITS)) & (BUCKETS - 1)];
+            }
+        } });
+
+    std::vector<T> scratch(count);
+    T *src = values.data();
+    T *dst = scratch.data();
+    bool moved = false; // Whether keys changed chunks since they were counted
+    for (unsigned pass = 0; pass < PASSES; ++pass)
+    {
+        bool trivial = false;
+        for (size_t d = 0; d < BUCKETS && !trivial; ++d)
+        {
+            size_t total = 0;
+            for (size_t c = 0; c < chunks; ++c)
+            {
+                total += counts[c][pass][d];
+            }
+            trivial = total == count;
+        }
+        if (trivial)
+        {
+            continue; // Every key has the same digit: the pass would not move anything
+        }
+        if (chunks > 1 && moved)
+        {
+            forEachChunk([&](size_t c)
+                         {
+                Histogram &local = counts[c][pass];
+                local.fill(0);
+                for (size_t i = chunkBegin(c); i < chunkBegin(c + 1); ++i)
+                {
+                    ++local[digitOf(src[i], pass)];
+                } });
+        }
+
+        // Chunk c writes digit d after every smaller digit, and after the keys
+        // with digit d of the chunks before it
+        std::vector<Histogram> offsets(chunks);
+        size_t position = 0;
+        for (size_t d = 0; d < BUCKETS; ++d)
+        {
+            for (size_t c = 0; c < chunks; ++c)
+            {
+                offsets[c][d] = position;
+                position += counts[c][pass][d];
+            }
+        }
+        forEachChunk([&](size_t c)
+                     { scatter(src, dst, chunkBegin(c), chunkBegin(c + 1), pass, offsets[c]); });
+        std::swap(src, dst);
+        moved = true;
+    }
+    if (src != values.data())
+    {
+        values.swap(scratch);
+    }
+}
+
+template <typename T>
+void sortValues(std::vector<T> &values, TaskScheduler *scheduler)
+{
+    if constexpr (IsRadixSortable<T>::value)
+    {
+        radixSort(values, scheduler);
+    }
+    else
+    {
+        std::sort(values.begin(), values.end());
+    }
+}
+
+template <typename T>
+void sortUnique(std::vector<T> &values, TaskScheduler *scheduler)
+{
+    sortValues(values, scheduler);
+    values.erase(std::unique(values.begin(), values.end()), values.end());
+}
+
+#endif // RADIXSORT_HXX
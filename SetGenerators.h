@@ -0,0 +1,140 @@
+// ===================================================================================
+// File:        SetGenerators.h
+// Author:      Group 4
+// Date:        2026-10-18
+// Description: Lazy set algebra on top of Generator<T>. Every function returns a
+//              generator that produces the result one element at a time: the
+//              first element is available immediately and no result set is
+//              ever materialized. Operand sets are read in place and must
+//              outlive (and stay unchanged during) the generators built on them.
+//
+//              Set-level operations yield the elements of the corresponding
+//              DataSet<T> operation in the order it would print them: ascending
+//              when the left operand is ordered (TREE, FROZEN, INTERVAL, BITSET),
+//              otherwise the left operand's order followed by the right
+//              operand's. (A HASH result prints in table order, which a stream
+//              cannot reproduce; its elements are the same.)
+//
+//              Stream-level operations take generators of strictly ascending
+//              values and yield strictly ascending values, so they nest:
+//                  lazyUnion(lazyIntersection(ascending(A), ascending(B)), ascending(C))
+//
+//              Supported operations:
+//              ----------------------------------------------------------------------
+//              lazyUnion / lazyIntersection / lazyDifference /
+//              lazySymmetricDifference(const DataSet<T>& a, const DataSet<T>& b)
+//                  Set-level operations (lookups are batched like the eager ones).
+//
+//              lazyUnion / lazyIntersection / lazyDifference /
+//              lazySymmetricDifference(Generator<T> a, Generator<T> b)
+//                  Merge two ascending streams.
+//
+//              Generator<T> ascending(const DataSet<T>& set, TaskScheduler* scheduler)
+//                  The elements of any set in ascending order.
+//
+//              Generator<T> lazyFilter(Generator<T> source, Pred pred)
+//                  Keeps the values for which pred(value) is true.
+//
+//              Generator<T> lazyProbe(Generator<T> source, const DataSet<T>& set, bool keepFound)
+//                  Keeps the values whose membership in set equals keepFound.
+//
+//              Generator<T> lazyConcat(Generator<T> first, Generator<T> second)
+//                  Yields first, then second.
+// ===================================================================================
+
+#ifndef SETGENERATORS_H
+#define SETGENERATORS_H
+
+#include <cstddef>
+#include "DataSet.h"
+#include "Generator.h"
+#include "TaskScheduler.h"
+
+/// Values gathered per containsMany() call by lazyProbe.
+inline constexpr size_t LAZY_PROBE_BATCH = 256;
+
+/**
+ * @brief Yields the elements of a set in ascending order (orderable T). Ordered
+ *        representations stream in place; a VECTOR or HASH set is first copied
+ *        and sorted, since its storage has no order to follow.
+ * @param set The set to read.
+ * @param scheduler Pool for sorting an unordered set (nullptr: sequential).
+ */
+template <typename T>
+Generator<T> ascending(const DataSet<T> &set, TaskScheduler *scheduler = nullptr);
+
+/**
+ * @brief Keeps the values for which pred(value) is true.
+ * @param source Values to filter.
+ * @param pred Predicate taking const T&.
+ */
+template <typename T, typename Pred>
+Generator<T> lazyFilter(Generator<T> source, Pred pred);
+
+/**
+ * @brief Keeps the values whose membership in set equals keepFound. Values are
+ *        looked up LAZY_PROBE_BATCH at a time through set.containsMany().
+ * @param source Values to test.
+ * @param set The set probed for membership.
+ * @param keepFound True to keep members, false to keep non-members.
+ */
+template <typename T>
+Generator<T> lazyProbe(Generator<T> source, const DataSet<T> &set, bool keepFound);
+
+/**
+ * @brief Yields every value of first, then every value of second.
+ */
+template <typename T>
+Generator<T> lazyConcat(Generator<T> first, Generator<T> second);
+
+/**
+ * @brief Merges two strictly ascending streams, keeping the values selected by the flags.
+ * @param a First stream.
+ * @param b Second stream.
+ * @param keepOnlyA Keep values found only in a.
+ * @param keepBoth Keep values found in both streams.
+ * @param keepOnlyB Keep values found only in b.
+ */
+template <typename T>
+Generator<T> mergeStreams(Generator<T> a, Generator<T> b,
+                          bool keepOnlyA, bool keepBoth, bool keepOnlyB);
+
+template <typename T>
+Generator<T> lazyUnion(Generator<T> a, Generator<T> b);
+
+template <typename T>
+Generator<T> lazyIntersection(Generator<T> a, Generator<T> b);
+
+template <typename T>
+Generator<T> lazyDifference(Generator<T> a, Generator<T> b);
+
+template <typename T>
+Generator<T> lazySymmetricDifference(Generator<T> a, Generator<T> b);
+
+/**
+ * @brief Lazy A ∪ B (see the file description for the order).
+ */
+template <typename T>
+Generator<T> lazyUnion(const DataSet<T> &a, const DataSet<T> &b);
+
+/**
+ * @brief Lazy A ∩ B: the elements of a, in a's order, that b contains.
+ */
+template <typename T>
+Generator<T> lazyIntersection(const DataSet<T> &a, const DataSet<T> &b);
+
+/**
+ * @brief Lazy A − B: the elements of a, in a's order, that b does not contain.
+ */
+template <typename T>
+Generator<T> lazyDifference(const DataSet<T> &a, const DataSet<T> &b);
+
+/**
+ * @brief Lazy A △ B (see the file description for the order).
+ */
+template <typename T>
+Generator<T> lazySymmetricDifference(const DataSet<T> &a, const DataSet<T> &b);
+
+#include "SetGenerators.hxx"
+
+#endif // SETGENERATORS_H
@@ -0,0 +1,253 @@
+// ===================================================================================
+// File:        SetGenerators.hxx
+// Author:      Group 4
+// Date:        2026-10-18
+// Description: Implementation of the lazy set operations declared in SetGenerators.h.
+// ===================================================================================
+// Group 4 | Joel Felipe Martinez | Xamuel Perez | Rafael Held
+
+#ifndef SETGENERATORS_HXX
+#define SETGENERATORS_HXX
+
+#include "SetGenerators.h"
+#include "RadixSort.h"
+#include <span>
+#include <utility> // For std::move
+#include <vector>
+
+/**
+ * @brief Yields the values of an owned vector (helper of ascending()).
+ */
+template <typename T>
+Generator<T> generateOwned(std::vector<T> values)
+{
+    for (const T &value : values)
+    {
+        co_yield value;
+    }
+}
+
+/**
+ * @brief Yields the elements of a set in ascending order (orderable T). Ordered
+ *        representations stream in place; a VECTOR or HASH set is first copied
+ *        and sorted (radix sort for integers, on the scheduler when given),
+ *        since its storage has no order to follow.
+ * @param set The set to read.
+ * @param scheduler Pool for the sort (nullptr: sequential).
+ */
+template <typename T>
+Generator<T> ascending(const DataSet<T> &set, TaskScheduler *scheduler)
+{
+    static_assert(IsOrderable<T>::value, "ascending() requires an orderable element type");
+    if (isOrderedRepresentation(set.getRepresentation()))
+    {
+        return set.values();
+    }
+    // The sort buffer is filled straight from the storage: no intermediate copy
+    std::vector<T> sorted;
+    sorted.reserve(set.size());
+    for (const T &value : set.values())
+    {
+        sorted.push_back(value);
+    }
+    sortValues(sorted, scheduler);
+    return generateOwned(std::move(sorted));
+}
+
+/**
+ * @brief Keeps the values for which pred(value) is true.
+ * @param source Values to filter.
+ * @param pred Predicate taking const T&.
+ */
+template <typename T, typename Pred>
+Generator<T> lazyFilter(Generator<T> source, Pred pred)
+{
+    for (const T &value : source)
+    {
+        if (pred(value))
+        {
+            co_yield value;
+        }
+    }
+}
+
+/**
+ * @brief Keeps the values whose membership in set equals keepFound. Values are
+ *        looked up LAZY_PROBE_BATCH at a time through set.containsMany().
+ * @param source Values to test.
+ * @param set The set probed for membership.
+ * @param keepFound True to keep members, false to keep non-members.
+ */
+template <typename T>
+Generator<T> lazyProbe(Generator<T> source, const DataSet<T> &set, bool keepFound)
+{
+    std::vector<T> batch;
+    std::vector<bool> found;
+    batch.reserve(LAZY_PROBE_BATCH);
+    typename Generator<T>::iterator it = source.begin();
+    while (true)
+    {
+        batch.clear();
+        for (; it != source.end() && batch.size() < LAZY_PROBE_BATCH; ++it)
+        {
+            batch.push_back(*it);
+        }
+        if (batch.empty())
+        {
+            co_return;
+        }
+        set.containsMany(std::span<const T>(batch), found);
+        for (size_t i = 0; i < batch.size(); ++i)
+        {
+            if (found[i] == keepFound)
+            {
+                co_yield batch[i];
+            }
+        }
+    }
+}
+
+/**
+ * @brief Yields every value of first, then every value of second.
+ */
+template <typename T>
+Generator<T> lazyConcat(Generator<T> first, Generator<T> second)
+{
+    for (const T &value : first)
+    {
+        co_yield value;
+    }
+    for (const T &value : second)
+    {
+        co_yield value;
+    }
+}
+
+/**
+ * @brief Merges two strictly ascending streams, keeping the values selected by the flags.
+ * @param a First stream.
+ * @param b Second stream.
+ * @param keepOnlyA Keep values found only in a.
+ * @param keepBoth Keep values found in both streams.
+ * @param keepOnlyB Keep values found only in b.
+ */
+template <typename T>
+Generator<T> mergeStreams(Generator<T> a, Generator<T> b,
+                          bool keepOnlyA, bool keepBoth, bool keepOnlyB)
+{
+    typename Generator<T>::iterator itA = a.begin();
+    typename Generator<T>::iterator itB = b.begin();
+    while (itA != a.end() && itB != b.end())
+    {
+        if (*itA < *itB)
+        {
+            if (keepOnlyA)
+            {
+                co_yield *itA;
+            }
+            ++itA;
+        }
+        else if (*itB < *itA)
+        {
+            if (keepOnlyB)
+            {
+                co_yield *itB;
+            }
+            ++itB;
+        }
+        else
+        {
+            if (keepBoth)
+            {
+                co_yield *itA;
+            }
+            ++itA;
+            ++itB;
+        }
+    }
+    for (; keepOnlyA && itA != a.end(); ++itA)
+    {
+        co_yield *itA;
+    }
+    for (; keepOnlyB && itB != b.end(); ++itB)
+    {
+        co_yield *itB;
+    }
+}
+
+template <typename T>
+Generator<T> lazyUnion(Generator<T> a, Generator<T> b)
+{
+    return mergeStreams(std::move(a), std::move(b), true, true, true);
+}
+
+template <typename T>
+Generator<T> lazyIntersection(Generator<T> a, Generator<T> b)
+{
+    return mergeStreams(std::move(a), std::move(b), false, true, false);
+}
+
+template <typename T>
+Generator<T> lazyDifference(Generator<T> a, Generator<T> b)
+{
+    return mergeStreams(std::move(a), std::move(b), true, false, false);
+}
+
+template <typename T>
+Generator<T> lazySymmetricDifference(Generator<T> a, Generator<T> b)
+{
+    return mergeStreams(std::move(a), std::move(b), true, false, true);
+}
+
+/**
+ * @brief Lazy A ∪ B: merged when a is ordered, otherwise a followed by the
+ *        elements of b that a does not contain.
+ */
+template <typename T>
+Generator<T> lazyUnion(const DataSet<T> &a, const DataSet<T> &b)
+{
+    if constexpr (IsOrderable<T>::value)
+    {
+        if (isOrderedRepresentation(a.getRepresentation()))
+        {
+            return lazyUnion(ascending(a), ascending(b));
+        }
+    }
+    return lazyConcat(a.values(), lazyProbe(b.values(), a, false));
+}
+
+/**
+ * @brief Lazy A ∩ B: the elements of a, in a's order, that b contains.
+ */
+template <typename T>
+Generator<T> lazyIntersection(const DataSet<T> &a, const DataSet<T> &b)
+{
+    return lazyProbe(a.values(), b, true);
+}
+
+/**
+ * @brief Lazy A − B: the elements of a, in a's order, that b does not contain.
+ */
+template <typename T>
+Generator<T> lazyDifference(const DataSet<T> &a, const DataSet<T> &b)
+{
+    return lazyProbe(a.values(), b, false);
+}
+
+/**
+ * @brief Lazy A △ B: merged when a is ordered, otherwise a − b followed by b − a.
+ */
+template <typename T>
+Generator<T> lazySymmetricDifference(const DataSet<T> &a, const DataSet<T> &b)
+{
+    if constexpr (IsOrderable<T>::value)
+    {
+        if (isOrderedRepresentation(a.getRepresentation()))
+        {
+            return lazySymmetricDifference(ascending(a), ascending(b));
+        }
+    }
+    return lazyConcat(lazyProbe(a.values(), b, false), lazyProbe(b.values(), a, false));
+}
+
+#endif // SETGENERATORS_HXX
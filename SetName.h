@@ -0,0 +1,122 @@
+// ===================================================================================
+// File:        SetName.h
+// Author:      Group 4
+// Date:        2026-10-18
+// Description: Declaration of SetName, the name of a DataSet. A name is either a
+//              literal string or a lazy expression over the names of the operands
+//              of a set operation ("A ∪ B", "(A union B)", ...).
+//
+//              Building an expression name allocates one small node holding the
+//              operand names (shared, not copied) and the operator symbol; the
+//              string itself is only rendered when the name is printed or asked
+//              for. Nested results therefore no longer pay for concatenations
+//              that grow with the depth of the expression and are usually
+//              overwritten before anyone reads them.
+//
+//              Supported operations:
+//              ----------------------------------------------------------------------
+//              SetName() / SetName(std::string literal)
+//                  An empty or a literal name.
+//
+//              static SetName combine(const SetName& left, const char* symbol, const SetName& right)
+//              static SetName group(const SetName& left, const char* symbol, const SetName& right)
+//                  "left<symbol>right" and "(left<symbol>right)".
+//
+//              std::string str() const
+//              void renderTo(std::ostream& os) const / void renderTo(std::string& out) const
+//                  Render the name.
+//
+//              bool empty() const / bool isLiteral() const / size_t memoryUsage() const
+//                  Inspect it without rendering.
+// ===================================================================================
+
+#ifndef SETNAME_H
+#define SETNAME_H
+
+#include <cstddef>
+#include <memory>
+#include <ostream>
+#include <string>
+
+/**
+ * @class SetName
+ * @brief Name of a set: a literal, or an operator applied to two other names
+ *        and rendered on demand. Copying a SetName copies at most the literal;
+ *        expression nodes are immutable and shared.
+ */
+class SetName
+{
+    struct Node;
+
+    std::string literal;              ///< The name, when it is a literal.
+    std::shared_ptr<const Node> node; ///< The expression, when it is not (nullptr otherwise).
+
+public:
+    /**
+     * @brief Creates an empty literal name.
+     */
+    SetName();
+
+    /**
+     * @brief Creates a literal name.
+     * @param text The name.
+     */
+    SetName(std::string text);
+
+    /**
+     * @brief Names the result of an operation: renders as left, symbol, right.
+     * @param left Name of the left operand.
+     * @param symbol Operator text including its spacing, e.g. " ∪ ". It is not
+     *        copied, so it must be a string literal (static storage).
+     * @param right Name of the right operand (may be empty, for a suffix).
+     * @return The lazy name.
+     */
+    static SetName combine(const SetName &left, const char *symbol, const SetName &right);
+
+    /**
+     * @brief Like combine(), with the rendering enclosed in parentheses.
+     */
+    static SetName group(const SetName &left, const char *symbol, const SetName &right);
+
+    /**
+     * @brief Renders the name.
+     * @return The full text.
+     */
+    std::string str() const;
+
+    /**
+     * @brief Writes the name to a stream without building the string first.
+     */
+    void renderTo(std::ostream &os) const;
+
+    /**
+     * @brief Appends the name to a string.
+     */
+    void renderTo(std::string &out) const;
+
+    /**
+     * @brief True if the name renders as the empty string.
+     */
+    bool empty() const;
+
+    /**
+     * @brief True if the name is a literal (rendering it is a copy).
+     */
+    bool isLiteral() const;
+
+    /**
+     * @brief Estimates the bytes the name holds: its literal and, for an
+     *        expression, every node below it (shared nodes included once per
+     *        owner, so the sum over several sets may overcount).
+     */
+    size_t memoryUsage() const;
+};
+
+/**
+ * @brief Writes a name to a stream (see SetName::renderTo).
+ */
+std::ostream &operator<<(std::ostream &os, const SetName &name);
+
+#include "SetName.hxx"
+
+#endif // SETNAME_H
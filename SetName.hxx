@@ -0,0 +1,126 @@
+// ===================================================================================
+// File:        SetName.hxx
+// Author:      Group 4
+// Date:        2026-10-18
+// Description: Implementation of SetName.
+// ===================================================================================
+// Group 4 | Joel Felipe Martinez | Xamuel Perez | Rafael Held
+
+#ifndef SETNAME_HXX
+#define SETNAME_HXX
+
+#include "SetName.h"
+#include <utility> // For std::move
+
+/**
+ * @brief An operator applied to two names. Nodes are never modified once built.
+ */
+struct SetName::Node
+{
+    SetName left;       ///< Left operand.
+    const char *symbol; ///< Operator text (static storage).
+    SetName right;      ///< Right operand.
+    bool parenthesized; ///< Whether the rendering is enclosed in parentheses.
+};
+
+inline SetName::SetName() : literal(), node() {}
+
+inline SetName::SetName(std::string text) : literal(std::move(text)), node() {}
+
+inline SetName SetName::combine(const SetName &left, const char *symbol, const SetName &right)
+{
+    SetName name;
+    name.node = std::make_shared<const Node>(Node{left, symbol, right, false});
+    return name;
+}
+
+inline SetName SetName::group(const SetName &left, const char *symbol, const SetName &right)
+{
+    SetName name;
+    name.node = std::make_shared<const Node>(Node{left, symbol, right, true});
+    return name;
+}
+
+inline std::string SetName::str() const
+{
+    if (node == nullptr)
+    {
+        return literal;
+    }
+    std::string out;
+    renderTo(out);
+    return out;
+}
+
+inline void SetName::renderTo(std::ostream &os) const
+{
+    if (node == nullptr)
+    {
+        os << literal;
+        return;
+    }
+    if (node->parenthesized)
+    {
+        os << '(';
+    }
+    node->left.renderTo(os);
+    os << node->symbol;
+    node->right.renderTo(os);
+    if (node->parenthesized)
+    {
+        os << ')';
+    }
+}
+
+inline void SetName::renderTo(std::string &out) const
+{
+    if (node == nullptr)
+    {
+        out += literal;
+        return;
+    }
+    if (node->parenthesized)
+    {
+        out += '(';
+    }
+    node->left.renderTo(out);
+    out += node->symbol;
+    node->right.renderTo(out);
+    if (node->parenthesized)
+    {
+        out += ')';
+    }
+}
+
+inline bool SetName::empty() const
+{
+    if (node == nullptr)
+    {
+        return literal.empty();
+    }
+    return !node->parenthesized && node->left.empty() && node->symbol[0] == '\0' &&
+           node->right.empty();
+}
+
+inline bool SetName::isLiteral() const
+{
+    return node == nullptr;
+}
+
+inline size_t SetName::memoryUsage() const
+{
+    size_t bytes = literal.capacity();
+    if (node != nullptr)
+    {
+        bytes += sizeof(Node) + node->left.memoryUsage() + node->right.memoryUsage();
+    }
+    return bytes;
+}
+
+inline std::ostream &operator<<(std::ostream &os, const SetName &name)
+{
+    name.renderTo(os);
+    return os;
+}
+
+#endif // SETNAME_HXX
@@ -0,0 +1,96 @@
+// ===================================================================================
+// File:        SetRepresentation.h
+// Author:      Group 4
+// Date:        2026-10-18
+// Description: Storage representations available to DataSet<T> and the type traits
+//              that decide which of them a given element type can use.
+//
+//              Supported operations:
+//              ----------------------------------------------------------------------
+//              enum class SetRepresentation
+//                  Identifies the internal storage currently used by a set.
+//
+//              const char* representationName(SetRepresentation rep)
+//                  Returns a printable name for a representation.
+//
+//              bool isOrderedRepresentation(SetRepresentation rep)
+//                  True if sets stored in rep iterate in ascending order.
+//
+//              IsOrderable<T>::value
+//                  True if T can be kept in an ordered structure (operator< and
+//                  default construction are available).
+// ===================================================================================
+
+#ifndef SETREPRESENTATION_H
+#define SETREPRESENTATION_H
+
+#include <type_traits>
+#include <utility>
+
+/**
+ * @enum SetRepresentation
+ * @brief Internal storage layouts a DataSet<T> can switch between.
+ */
+enum class SetRepresentation
+{
+    VECTOR,   ///< Unsorted dynamic array in insertion order (linear contains).
+    TREE,     ///< B+-tree with cache-line sized nodes (ordered, O(log n) insert).
+    HASH,     ///< Lock-free hash table; insert may run from many threads at once.
+    FROZEN,   ///< Read-only Eytzinger array (branchless, prefetching lookups).
+    INTERVAL, ///< Sorted runs [lo, hi] of consecutive integers (run-length encoded).
+    BITSET    ///< One bit per value over the span of an integer set (dense sets).
+};
+
+/**
+ * @brief Returns a printable name for a representation.
+ * @param rep The representation.
+ * @return Lower-case name ("vector", "tree", ...).
+ */
+inline const char *representationName(SetRepresentation rep)
+{
+    switch (rep)
+    {
+    case SetRepresentation::VECTOR:
+        return "vector";
+    case SetRepresentation::TREE:
+        return "tree";
+    case SetRepresentation::HASH:
+        return "hash";
+    case SetRepresentation::FROZEN:
+        return "frozen";
+    case SetRepresentation::INTERVAL:
+        return "interval";
+    case SetRepresentation::BITSET:
+        return "bitset";
+    }
+    return "unknown";
+}
+
+/**
+ * @brief Tells whether sets stored in a representation iterate in ascending order,
+ *        so that two of them can be combined by a linear merge.
+ * @param rep The representation.
+ * @return True for TREE, FROZEN, INTERVAL and BITSET.
+ */
+inline bool isOrderedRepresentation(SetRepresentation rep)
+{
+    return rep == SetRepresentation::TREE || rep == SetRepresentation::FROZEN ||
+           rep == SetRepresentation::INTERVAL || rep == SetRepresentation::BITSET;
+}
+
+/**
+ * @brief Detects whether T supports operator< and default construction,
+ *        which ordered representations require.
+ */
+template <typename T, typename = void>
+struct IsOrderable : std::false_type
+{
+};
+
+template <typename T>
+struct IsOrderable<T, std::void_t<decltype(std::declval<const T &>() < std::declval<const T &>())>>
+    : std::is_default_constructible<T>
+{
+};
+
+#endif // SETREPRESENTATION_H
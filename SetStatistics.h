@@ -0,0 +1,222 @@
+// ===================================================================================
+// File:        SetStatistics.h
+// Author:      Group 4
+// Date:        2026-10-18
+// Description: Declaration of SetStatistics<T>, the statistics block every DataSet<T>
+//              keeps for planning: element count, minimum and maximum, an
+//              order-independent content hash, a HyperLogLog sketch of the
+//              elements and an equi-depth histogram of their values.
+//
+//              Everything but the histogram is updated in O(1) per inserted
+//              element. The histogram needs the elements of a few ranks, so its
+//              owner rebuilds it lazily, once the count has drifted too far
+//              from the count it was built for (see needsHistogram).
+//
+//              Sketches of two sets merge, which estimates how many elements the
+//              sets share without looking at them; histograms estimate how many
+//              elements fall in a value range.
+//
+//              Supported operations:
+//              ----------------------------------------------------------------------
+//              void add(const T& value)
+//                  Accounts for one new element (never for a duplicate).
+//
+//              void addRun(const T& lo, const T& hi)
+//                  Accounts for every value of a run [lo, hi] (integral T).
+//
+//              void clear()
+//                  Forgets every element.
+//
+//              uint64_t count() const / bool hasRange() const
+//              const T& minimum() const / const T& maximum() const
+//              uint64_t contentHash() const
+//                  The maintained values (range only for orderable T).
+//
+//              double distinctEstimate() const
+//                  Number of elements estimated from the sketch alone.
+//
+//              bool needsHistogram() const
+//              void rebuildHistogram(Select elementOfRank)
+//                  Lazy histogram refresh from the elements of a few ranks.
+//
+//              const std::vector<T>& histogramBounds() const
+//              double estimateRange(const T& lo, const T& hi) const
+//                  Equi-depth bucket bounds and the elements estimated in [lo, hi].
+//
+//              static double estimateUnion(const SetStatistics& a, const SetStatistics& b)
+//              static uint64_t estimateOverlap(const SetStatistics& a, const SetStatistics& b)
+//                  Size of A ∪ B from the merged sketches, and an estimate of |A ∩ B|.
+// ===================================================================================
+
+#ifndef SETSTATISTICS_H
+#define SETSTATISTICS_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional> // For std::hash
+#include <optional>
+#include <type_traits>
+#include <vector>
+#include "SetRepresentation.h"
+
+/**
+ * @brief Detects whether std::hash<T> is available, which the content hash and
+ *        the sketch need.
+ */
+template <typename T, typename = void>
+struct IsHashable : std::false_type
+{
+};
+
+template <typename T>
+struct IsHashable<T, std::void_t<decltype(std::hash<T>{}(std::declval<const T &>()))>>
+    : std::true_type
+{
+};
+
+/**
+ * @class SetStatistics
+ * @brief Incrementally maintained statistics of a set. Copying it is O(1) in
+ *        the size of the set (the histogram has at most HISTOGRAM_BUCKETS + 1 bounds).
+ *
+ * @tparam T Element type. Hash and sketch need std::hash<T>; range and histogram
+ *           need an orderable T (see IsOrderable).
+ */
+template <typename T>
+class SetStatistics
+{
+public:
+    /// Registers of the HyperLogLog sketch (standard error about 1.04 / sqrt(256) = 6.5%).
+    static constexpr size_t SKETCH_REGISTERS = 256;
+
+    /// Buckets of the equi-depth histogram.
+    static constexpr size_t HISTOGRAM_BUCKETS = 32;
+
+    /// The histogram is rebuilt once the count moved by more than 1/HISTOGRAM_DRIFT
+    /// of the count it was built for.
+    static constexpr uint64_t HISTOGRAM_DRIFT = 8;
+
+private:
+    /// Bits of the hash that select a register (log2 of SKETCH_REGISTERS).
+    static constexpr unsigned SKETCH_INDEX_BITS = 8;
+
+    uint64_t elements;                                ///< Number of elements added.
+    std::optional<T> low;                             ///< Smallest element (orderable T).
+    std::optional<T> high;                            ///< Largest element (orderable T).
+    uint64_t hashSum;                                 ///< Sum of the element hashes (mod 2^64).
+    std::array<uint8_t, SKETCH_REGISTERS> registers;  ///< HyperLogLog registers.
+    std::vector<T> bounds;                            ///< Equi-depth bucket bounds (ascending).
+    uint64_t histogramCount;                          ///< Count the histogram was built for.
+
+    static uint64_t elementHash(const T &value);
+    void sketch(uint64_t hash);
+    static double sketchEstimate(const std::array<uint8_t, SKETCH_REGISTERS> &sketch);
+
+public:
+    /**
+     * @brief Creates the statistics of an empty set.
+     */
+    SetStatistics();
+
+    /**
+     * @brief Accounts for one element that was not in the set before.
+     * @param value The new element.
+     */
+    void add(const T &value);
+
+    /**
+     * @brief Accounts for every value of a run of consecutive values, none of
+     *        them in the set before. Count and range are updated once; only
+     *        the hash and the sketch visit each value.
+     * @param lo First value of the run.
+     * @param hi Last value of the run (lo <= hi).
+     */
+    void addRun(const T &lo, const T &hi);
+
+    /**
+     * @brief Resets to the statistics of an empty set.
+     */
+    void clear();
+
+    /**
+     * @brief Number of elements added.
+     */
+    uint64_t count() const;
+
+    /**
+     * @brief True if minimum() and maximum() are known (orderable T, non-empty set).
+     */
+    bool hasRange() const;
+
+    /**
+     * @brief Smallest element. Only valid when hasRange().
+     */
+    const T &minimum() const;
+
+    /**
+     * @brief Largest element. Only valid when hasRange().
+     */
+    const T &maximum() const;
+
+    /**
+     * @brief Sum of the mixed std::hash of every element: equal sets have equal
+     *        hashes whatever their layout or insertion order (0 if T has no std::hash).
+     */
+    uint64_t contentHash() const;
+
+    /**
+     * @brief Number of elements estimated from the sketch alone (0 if T has no
+     *        std::hash). count() is exact; the sketch matters once merged.
+     */
+    double distinctEstimate() const;
+
+    /**
+     * @brief True if the histogram is missing or out of date (orderable T only).
+     */
+    bool needsHistogram() const;
+
+    /**
+     * @brief Rebuilds the histogram from the elements of HISTOGRAM_BUCKETS + 1
+     *        evenly spaced ranks, so the set is never copied or sorted here.
+     * @param elementOfRank Callable returning the element of a rank in
+     *        [0, count()) (0 = smallest).
+     */
+    template <typename Select>
+    void rebuildHistogram(Select &&elementOfRank);
+
+    /**
+     * @brief Bounds of the equi-depth buckets: bucket i holds about
+     *        count() / HISTOGRAM_BUCKETS elements between bounds[i] and bounds[i + 1].
+     *        Empty until the first rebuildHistogram().
+     */
+    const std::vector<T> &histogramBounds() const;
+
+    /**
+     * @brief Estimates the elements that lie in [lo, hi] from the histogram,
+     *        interpolating inside partly covered buckets for arithmetic T.
+     *        Without a histogram, the whole count is returned if the ranges meet.
+     * @param lo Lower bound (inclusive).
+     * @param hi Upper bound (inclusive).
+     * @return Estimated number of elements.
+     */
+    double estimateRange(const T &lo, const T &hi) const;
+
+    /**
+     * @brief Estimates |A ∪ B| by merging the two sketches (register-wise maximum).
+     * @return Estimated union size, clamped to [max(|A|, |B|), |A| + |B|].
+     */
+    static double estimateUnion(const SetStatistics &a, const SetStatistics &b);
+
+    /**
+     * @brief Estimates |A ∩ B|: 0 when the value ranges are disjoint, otherwise the
+     *        smaller of what the histograms put inside the other set's range and
+     *        what inclusion-exclusion over the merged sketches gives.
+     * @return Estimated intersection size, at most min(|A|, |B|).
+     */
+    static uint64_t estimateOverlap(const SetStatistics &a, const SetStatistics &b);
+};
+
+#include "SetStatistics.hxx"
+
+#endif // SETSTATISTICS_H
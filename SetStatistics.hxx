@@ -0,0 +1,285 @@
+// ===================================================================================
+// File:        SetStatistics.hxx
+// Author:      Group 4
+// Date:        2026-10-18
+// Description: Implementation of the templated class SetStatistics<T>.
+// ===================================================================================
+// Group 4 | Joel Felipe Martinez | Xamuel Perez | Rafael Held
+
+#ifndef SETSTATISTICS_HXX
+#define SETSTATISTICS_HXX
+
+#include "SetStatistics.h"
+#include <algorithm> // For std::max, std::min
+#include <bit>       // For std::countl_zero
+#include <cmath>     // For std::log, std::ldexp
+
+template <typename T>
+SetStatistics<T>::SetStatistics()
+    : elements(0), low(), high(), hashSum(0), registers(), bounds(), histogramCount(0) {}
+
+/**
+ * @brief std::hash of a value, spread by the MurmurHash3 finalizer (std::hash
+ *        of an integer is usually the integer itself).
+ */
+template <typename T>
+uint64_t SetStatistics<T>::elementHash(const T &value)
+{
+    uint64_t hash = static_cast<uint64_t>(std::hash<T>{}(value));
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33;
+    hash *= 0xc4ceb9fe1a85ec53ULL;
+    hash ^= hash >> 33;
+    return hash;
+}
+
+/**
+ * @brief HyperLogLog estimate of a register array, with the linear counting
+ *        correction for small cardinalities.
+ */
+template <typename T>
+double SetStatistics<T>::sketchEstimate(const std::array<uint8_t, SKETCH_REGISTERS> &sketch)
+{
+    const double m = static_cast<double>(SKETCH_REGISTERS);
+    double sum = 0.0;
+    size_t zeros = 0;
+    for (uint8_t rank : sketch)
+    {
+        sum += std::ldexp(1.0, -static_cast<int>(rank));
+        zeros += rank == 0 ? 1 : 0;
+    }
+    double estimate = (0.7213 / (1.0 + 1.079 / m)) * m * m / sum;
+    if (estimate <= 2.5 * m && zeros != 0)
+    {
+        estimate = m * std::log(m / static_cast<double>(zeros));
+    }
+    return estimate;
+}
+
+template <typename T>
+void SetStatistics<T>::add(const T &value)
+{
+    ++elements;
+    if constexpr (IsOrderable<T>::value)
+    {
+        if (!low || value < *low)
+        {
+            low = value;
+        }
+        if (!high || *high < value)
+        {
+            high = value;
+        }
+    }
+    if constexpr (IsHashable<T>::value)
+    {
+        sketch(elementHash(value));
+    }
+}
+
+/**
+ * @brief Adds a hash to the content hash and the HyperLogLog registers.
+ */
+template <typename T>
+void SetStatistics<T>::sketch(uint64_t hash)
+{
+    hashSum += hash;
+    // Leading bits pick the register; the rank is the position of the
+    // first set bit among the rest
+    size_t index = static_cast<size_t>(hash >> (64 - SKETCH_INDEX_BITS));
+    uint64_t rest = (hash << SKETCH_INDEX_BITS) | (uint64_t(1) << (SKETCH_INDEX_BITS - 1));
+    uint8_t rank = static_cast<uint8_t>(std::countl_zero(rest) + 1);
+    registers[index] = std::max(registers[index], rank);
+}
+
+template <typename T>
+void SetStatistics<T>::addRun(const T &lo, const T &hi)
+{
+    static_assert(std::is_integral<T>::value, "addRun() needs an integral element type");
+    elements += static_cast<uint64_t>(hi) - static_cast<uint64_t>(lo) + 1;
+    if (!low || lo < *low)
+    {
+        low = lo;
+    }
+    if (!high || *high < hi)
+    {
+        high = hi;
+    }
+    for (T value = lo;; ++value)
+    {
+        sketch(elementHash(value));
+        if (value == hi)
+        {
+            break;
+        }
+    }
+}
+
+template <typename T>
+void SetStatistics<T>::clear()
+{
+    *this = SetStatistics<T>();
+}
+
+template <typename T>
+uint64_t SetStatistics<T>::count() const
+{
+    return elements;
+}
+
+template <typename T>
+bool SetStatistics<T>::hasRange() const
+{
+    return low.has_value();
+}
+
+template <typename T>
+const T &SetStatistics<T>::minimum() const
+{
+    return *low;
+}
+
+template <typename T>
+const T &SetStatistics<T>::maximum() const
+{
+    return *high;
+}
+
+template <typename T>
+uint64_t SetStatistics<T>::contentHash() const
+{
+    return hashSum;
+}
+
+template <typename T>
+double SetStatistics<T>::distinctEstimate() const
+{
+    if constexpr (IsHashable<T>::value)
+    {
+        return elements == 0 ? 0.0 : sketchEstimate(registers);
+    }
+    return 0.0;
+}
+
+template <typename T>
+bool SetStatistics<T>::needsHistogram() const
+{
+    if constexpr (IsOrderable<T>::value)
+    {
+        uint64_t drift = elements > histogramCount ? elements - histogramCount
+                                                   : histogramCount - elements;
+        return (bounds.empty() && elements != 0) || drift > histogramCount / HISTOGRAM_DRIFT;
+    }
+    return false;
+}
+
+/**
+ * @brief Picks HISTOGRAM_BUCKETS + 1 evenly spaced ranks (fewer for small sets),
+ *        always including the first and the last element.
+ */
+template <typename T>
+template <typename Select>
+void SetStatistics<T>::rebuildHistogram(Select &&elementOfRank)
+{
+    bounds.clear();
+    histogramCount = elements;
+    if (elements == 0)
+    {
+        return;
+    }
+    uint64_t buckets = std::min<uint64_t>(HISTOGRAM_BUCKETS, elements);
+    bounds.reserve(buckets + 1);
+    for (uint64_t i = 0; i < buckets; ++i)
+    {
+        bounds.push_back(elementOfRank(static_cast<size_t>(i * elements / buckets)));
+    }
+    bounds.push_back(elementOfRank(static_cast<size_t>(elements - 1)));
+}
+
+template <typename T>
+const std::vector<T> &SetStatistics<T>::histogramBounds() const
+{
+    return bounds;
+}
+
+template <typename T>
+double SetStatistics<T>::estimateRange(const T &lo, const T &hi) const
+{
+    if constexpr (IsOrderable<T>::value)
+    {
+        if (elements == 0 || hi < lo || (low && (hi < *low || *high < lo)))
+        {
+            return 0.0;
+        }
+        if (bounds.size() < 2)
+        {
+            return static_cast<double>(elements);
+        }
+        double depth = static_cast<double>(elements) / static_cast<double>(bounds.size() - 1);
+        double total = 0.0;
+        for (size_t i = 0; i + 1 < bounds.size(); ++i)
+        {
+            const T &first = bounds[i];
+            const T &last = bounds[i + 1];
+            if (last < lo || hi < first)
+            {
+                continue; // Bucket outside the range
+            }
+            double covered = 1.0;
+            if constexpr (std::is_arithmetic<T>::value)
+            {
+                double width = static_cast<double>(last) - static_cast<double>(first);
+                if (width > 0.0)
+                {
+                    double from = std::max(static_cast<double>(lo), static_cast<double>(first));
+                    double to = std::min(static_cast<double>(hi), static_cast<double>(last));
+                    covered = std::min(1.0, (to - from) / width);
+                }
+            }
+            total += depth * covered;
+        }
+        return std::min(total, static_cast<double>(elements));
+    }
+    return static_cast<double>(elements);
+}
+
+template <typename T>
+double SetStatistics<T>::estimateUnion(const SetStatistics &a, const SetStatistics &b)
+{
+    double smallest = static_cast<double>(std::max(a.elements, b.elements));
+    double largest = static_cast<double>(a.elements) + static_cast<double>(b.elements);
+    if constexpr (IsHashable<T>::value)
+    {
+        std::array<uint8_t, SKETCH_REGISTERS> merged;
+        for (size_t i = 0; i < SKETCH_REGISTERS; ++i)
+        {
+            merged[i] = std::max(a.registers[i], b.registers[i]);
+        }
+        return std::clamp(sketchEstimate(merged), smallest, largest);
+    }
+    return largest;
+}
+
+template <typename T>
+uint64_t SetStatistics<T>::estimateOverlap(const SetStatistics &a, const SetStatistics &b)
+{
+    double overlap = static_cast<double>(std::min(a.elements, b.elements));
+    if constexpr (IsOrderable<T>::value)
+    {
+        if (a.hasRange() && b.hasRange())
+        {
+            overlap = std::min({overlap, a.estimateRange(b.minimum(), b.maximum()),
+                                b.estimateRange(a.minimum(), a.maximum())});
+        }
+    }
+    if constexpr (IsHashable<T>::value)
+    {
+        double shared = static_cast<double>(a.elements) + static_cast<double>(b.elements) -
+                        estimateUnion(a, b);
+        overlap = std::min(overlap, std::max(shared, 0.0));
+    }
+    return static_cast<uint64_t>(overlap + 0.5);
+}
+
+#endif // SETSTATISTICS_HXX
@@ -0,0 +1,175 @@
+// ===================================================================================
+// File:        SimdKernels.h
+// Author:      Group 4
+// Date:        2026-10-18
+// Description: Vectorized scan kernels over contiguous integer arrays. Each kernel
+//              has a scalar version, an SSE2 version (x86-64 baseline) and AVX2 /
+//              AVX-512 versions; the widest one the CPU supports is selected once
+//              at startup (runtime dispatch), so the binary needs no -m flags.
+//
+//              Supported operations:
+//              ----------------------------------------------------------------------
+//              bool simdContains(const T* data, size_t count, T key)
+//                  Linear search for key over data[0..count), comparing 4-16
+//                  values per instruction. T must be a 4- or 8-byte integral type.
+//
+//              size_t simdCompare(const T* data, size_t count, Comparison op, T key,
+//                                 uint64_t* bits)
+//                  Sets bit i of `bits` where data[i] op key holds (a column
+//                  predicate), comparing 4-16 values per instruction, and
+//                  returns the number of matches.
+//
+//              int64_t simdSum(const T* data, size_t count)
+//                  Sum of data[0..count), widened to 64 bits, adding 4-16 values
+//                  per instruction.
+//
+//              void simdMinMax(const T* data, size_t count, T& lowest, T& highest)
+//                  Smallest and largest value of a non-empty array in one pass.
+//
+//              size_t simdCompareModulo(const T* data, size_t count, T modulus,
+//                                       Comparison op, T remainder, uint64_t* bits)
+//                  Like simdCompare, on the remainders data[i] mod modulus.
+//
+//              void simdAffine(const T* data, size_t count, T factor, T addend, T* out)
+//                  out[i] = data[i] * factor + addend, 8-16 values per instruction.
+//
+//              const char* simdLevelName()
+//                  Returns the instruction set chosen at runtime ("avx512", ...).
+// ===================================================================================
+
+#ifndef SIMDKERNELS_H
+#define SIMDKERNELS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+/**
+ * @brief Instruction-set levels the kernels are compiled for.
+ */
+enum class SimdLevel
+{
+    SCALAR,
+    SSE2,
+    AVX2,
+    AVX512
+};
+
+/**
+ * @brief Comparison a column predicate applies between each value and a key.
+ */
+enum class Comparison
+{
+    EQUAL,        ///< value == key
+    NOT_EQUAL,    ///< value != key
+    LESS,         ///< value < key
+    LESS_EQUAL,   ///< value <= key
+    GREATER,      ///< value > key
+    GREATER_EQUAL ///< value >= key
+};
+
+/**
+ * @brief True for element types the SIMD kernels accept.
+ */
+template <typename T>
+struct IsSimdScannable
+    : std::integral_constant<bool, std::is_integral<T>::value && !std::is_same<T, bool>::value &&
+                                       (sizeof(T) == 4 || sizeof(T) == 8)>
+{
+};
+
+/**
+ * @brief Detects the widest instruction set supported by the running CPU.
+ */
+inline SimdLevel detectSimdLevel();
+
+/**
+ * @brief Returns the instruction set chosen at runtime ("scalar", "sse2", "avx2", "avx512").
+ */
+inline const char *simdLevelName();
+
+/**
+ * @brief Linear search over a contiguous array using the widest available SIMD.
+ * @param data Array to scan.
+ * @param count Number of elements.
+ * @param key Value to look for.
+ * @return True if key occurs in data[0..count).
+ */
+template <typename T>
+bool simdContains(const T *data, size_t count, T key);
+
+/**
+ * @brief Evaluates a predicate over a contiguous array into a bitmap using the
+ *        widest available SIMD (signed 4- and 8-byte types; other types are
+ *        compared one at a time).
+ * @param data Array to scan.
+ * @param count Number of elements.
+ * @param op Comparison between each value and the key.
+ * @param key Right-hand side of the comparison.
+ * @param bits Bitmap of (count + 63) / 64 words, zeroed by the caller; bit i
+ *        (word i / 64, bit i % 64) is set if data[i] op key.
+ * @return Number of elements that satisfy the predicate.
+ */
+template <typename T>
+size_t simdCompare(const T *data, size_t count, Comparison op, T key, uint64_t *bits);
+
+/**
+ * @brief Sums a contiguous array using the widest available SIMD (signed 4- and
+ *        8-byte types; other integral types are added one at a time). 4-byte
+ *        values are widened before they are added, so their sum is exact;
+ *        8-byte sums wrap modulo 2^64.
+ * @param data Array to sum.
+ * @param count Number of elements.
+ * @return The sum (0 for an empty array).
+ */
+template <typename T>
+int64_t simdSum(const T *data, size_t count);
+
+/**
+ * @brief Finds the smallest and largest value of a contiguous array in one
+ *        pass, using the widest available SIMD (signed 4- and 8-byte types;
+ *        other types are compared one at a time).
+ * @param data Array to scan.
+ * @param count Number of elements (at least 1).
+ * @param lowest Receives the smallest value.
+ * @param highest Receives the largest value.
+ */
+template <typename T>
+void simdMinMax(const T *data, size_t count, T &lowest, T &highest);
+
+/**
+ * @brief Evaluates a predicate on the remainders of a contiguous array modulo
+ *        a positive modulus into a bitmap. Remainders are floored, so they lie
+ *        in [0, modulus) for negative values too (-7 mod 3 is 2). 4-byte
+ *        signed values are divided 4-8 at a time in double precision, where
+ *        they are exact; other types are divided one at a time.
+ * @param data Array to scan.
+ * @param count Number of elements.
+ * @param modulus Divisor (at least 1).
+ * @param op Comparison between each remainder and `remainder`.
+ * @param remainder Right-hand side of the comparison.
+ * @param bits Bitmap of (count + 63) / 64 words, zeroed by the caller; bit i is
+ *        set if (data[i] mod modulus) op remainder.
+ * @return Number of elements that satisfy the predicate.
+ */
+template <typename T>
+size_t simdCompareModulo(const T *data, size_t count, T modulus, Comparison op, T remainder,
+                         uint64_t *bits);
+
+/**
+ * @brief Applies x * factor + addend to a contiguous array using the widest
+ *        available SIMD (4-byte signed types from AVX2 on; other integral types
+ *        one at a time). Results wrap modulo 2^(8 * sizeof(T)); callers that
+ *        need exact images check the range first.
+ * @param data Array to transform.
+ * @param count Number of elements.
+ * @param factor Multiplier.
+ * @param addend Value added after the multiplication.
+ * @param out Receives count values (may be data itself).
+ */
+template <typename T>
+void simdAffine(const T *data, size_t count, T factor, T addend, T *out);
+
+#include "SimdKernels.hxx"
+
+#endif // SIMDKERNELS_H
@@ -0,0 +1,1252 @@
+// ===================================================================================
+// File:        SimdKernels.hxx
+// Author:      Group 4
+// Date:        2026-10-18
+// Description: Implementation of the SIMD scan kernels and their runtime dispatch.
+//              Kernels for wider instruction sets are compiled with per-function
+//              target attributes and only called after the CPU check succeeds.
+// ===================================================================================
+// Group 4 | Joel Felipe Martinez | Xamuel Perez | Rafael Held
+
+#ifndef SIMDKERNELS_HXX
+#define SIMDKERNELS_HXX
+
+#include "SimdKernels.h"
+#include <bit>     // For std::popcount
+#include <cstring> // For std::memcpy
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define SIMD_KERNELS_X86 1
+#include <immintrin.h>
+#else
+#define SIMD_KERNELS_X86 0
+#endif
+
+namespace simd_detail
+{
+    /// Signature shared by every contains kernel of one element width.
+    typedef bool (*Contains32Fn)(const void *, size_t, int32_t);
+    typedef bool (*Contains64Fn)(const void *, size_t, int64_t);
+
+    /// Signature shared by every compare kernel of one element width.
+    typedef size_t (*Compare32Fn)(const void *, size_t, Comparison, int32_t, uint64_t *);
+    typedef size_t (*Compare64Fn)(const void *, size_t, Comparison, int64_t, uint64_t *);
+
+    /// Signature shared by every sum kernel of one element width.
+    typedef int64_t (*Sum32Fn)(const void *, size_t);
+    typedef int64_t (*Sum64Fn)(const void *, size_t);
+
+    /// Signature shared by every min/max kernel of one element width.
+    typedef void (*MinMax32Fn)(const void *, size_t, int32_t &, int32_t &);
+    typedef void (*MinMax64Fn)(const void *, size_t, int64_t &, int64_t &);
+
+    /// Signature shared by every modulo predicate and every affine kernel (4-byte only).
+    typedef size_t (*Modulo32Fn)(const void *, size_t, int32_t, Comparison, int32_t, uint64_t *);
+    typedef void (*Affine32Fn)(const void *, size_t, int32_t, int32_t, void *);
+
+    /**
+     * @brief Scalar search from element `start` on; also finishes every SIMD tail.
+     */
+    template <typename Word>
+    inline bool containsScalar(const void *data, size_t count, Word key, size_t start = 0)
+    {
+        const char *bytes = static_cast<const char *>(data);
+        for (size_t i = start; i < count; ++i)
+        {
+            Word value;
+            std::memcpy(&value, bytes + i * sizeof(Word), sizeof(Word));
+            if (value == key)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    template <typename Word>
+    inline bool compareValue(const Word &value, Comparison op, const Word &key)
+    {
+        switch (op)
+        {
+        case Comparison::EQUAL:
+            return value == key;
+        case Comparison::NOT_EQUAL:
+            return !(value == key);
+        case Comparison::LESS:
+            return value < key;
+        case Comparison::LESS_EQUAL:
+            return !(key < value);
+        case Comparison::GREATER:
+            return key < value;
+        default:
+            return !(value < key);
+        }
+    }
+
+    /**
+     * @brief Scalar predicate from element `start` (a multiple of 64) on; also
+     *        finishes every SIMD tail. Bits are ORed into the zeroed bitmap.
+     */
+    template <typename Word>
+    inline size_t compareScalar(const void *data, size_t count, Comparison op, Word key,
+                                uint64_t *bits, size_t start = 0)
+    {
+        const char *bytes = static_cast<const char *>(data);
+        size_t matches = 0;
+        for (size_t i = start; i < count; ++i)
+        {
+            Word value;
+            std::memcpy(&value, bytes + i * sizeof(Word), sizeof(Word));
+            if (compareValue(value, op, key))
+            {
+                bits[i / 64] |= uint64_t(1) << (i % 64);
+                ++matches;
+            }
+        }
+        return matches;
+    }
+
+    /**
+     * @brief Turns the "greater" and "equal" masks of 64 values into the mask of `op`.
+     */
+    inline uint64_t combineMasks(Comparison op, uint64_t greater, uint64_t equal)
+    {
+        switch (op)
+        {
+        case Comparison::EQUAL:
+            return equal;
+        case Comparison::NOT_EQUAL:
+            return ~equal;
+        case Comparison::LESS:
+            return ~(greater | equal);
+        case Comparison::LESS_EQUAL:
+            return ~greater;
+        case Comparison::GREATER:
+            return greater;
+        default:
+            return greater | equal;
+        }
+    }
+
+    /**
+     * @brief Scalar sum from element `start` on; also finishes every SIMD tail.
+     *        Additions wrap (unsigned arithmetic) instead of overflowing.
+     */
+    template <typename Word>
+    inline int64_t sumScalar(const void *data, size_t count, size_t start = 0)
+    {
+        const char *bytes = static_cast<const char *>(data);
+        uint64_t sum = 0;
+        for (size_t i = start; i < count; ++i)
+        {
+            Word value;
+            std::memcpy(&value, bytes + i * sizeof(Word), sizeof(Word));
+            sum += static_cast<uint64_t>(static_cast<int64_t>(value));
+        }
+        return static_cast<int64_t>(sum);
+    }
+
+    /**
+     * @brief Scalar min/max from element `start` on, folded into lowest and
+     *        highest; also finishes every SIMD tail.
+     */
+    template <typename Word>
+    inline void minMaxScalar(const void *data, size_t count, Word &lowest, Word &highest,
+                             size_t start = 0)
+    {
+        const char *bytes = static_cast<const char *>(data);
+        for (size_t i = start; i < count; ++i)
+        {
+            Word value;
+            std::memcpy(&value, bytes + i * sizeof(Word), sizeof(Word));
+            lowest = value < lowest ? value : lowest;
+            highest = highest < value ? value : highest;
+        }
+    }
+
+    /**
+     * @brief Remainder of value modulo a positive modulus, in [0, modulus).
+     */
+    template <typename Word>
+    inline Word floorModulo(const Word &value, const Word &modulus)
+    {
+        Word remainder = value % modulus;
+        if constexpr (std::is_signed<Word>::value)
+        {
+            if (remainder < 0)
+            {
+                remainder += modulus;
+            }
+        }
+        return remainder;
+    }
+
+    /**
+     * @brief Scalar modulo predicate from element `start` (a multiple of 64) on;
+     *        also finishes every SIMD tail. Bits are ORed into the zeroed bitmap.
+     */
+    template <typename Word>
+    inline size_t moduloScalar(const void *data, size_t count, Word modulus, Comparison op,
+                               Word remainder, uint64_t *bits, size_t start = 0)
+    {
+        const char *bytes = static_cast<const char *>(data);
+        size_t matches = 0;
+        for (size_t i = start; i < count; ++i)
+        {
+            Word value;
+            std::memcpy(&value, bytes + i * sizeof(Word), sizeof(Word));
+            if (compareValue(floorModulo(value, modulus), op, remainder))
+            {
+                bits[i / 64] |= uint64_t(1) << (i % 64);
+                ++matches;
+            }
+        }
+        return matches;
+    }
+
+    /**
+     * @brief Scalar x * factor + addend from element `start` on; also finishes
+     *        every SIMD tail. The arithmetic is unsigned, so results wrap.
+     */
+    template <typename Word>
+    inline void affineScalar(const void *data, size_t count, Word factor, Word addend, void *out,
+                             size_t start = 0)
+    {
+        const char *bytes = static_cast<const char *>(data);
+        char *target = static_cast<char *>(out);
+        for (size_t i = start; i < count; ++i)
+        {
+            Word value;
+            std::memcpy(&value, bytes + i * sizeof(Word), sizeof(Word));
+            value = static_cast<Word>(static_cast<uint64_t>(value) * static_cast<uint64_t>(factor) +
+                                      static_cast<uint64_t>(addend));
+            std::memcpy(target + i * sizeof(Word), &value, sizeof(Word));
+        }
+    }
+
+    inline int64_t sum32Scalar(const void *data, size_t count)
+    {
+        return sumScalar<int32_t>(data, count);
+    }
+
+    inline int64_t sum64Scalar(const void *data, size_t count)
+    {
+        return sumScalar<int64_t>(data, count);
+    }
+
+    inline void minMax32Scalar(const void *data, size_t count, int32_t &lowest, int32_t &highest)
+    {
+        std::memcpy(&lowest, data, sizeof(int32_t));
+        highest = lowest;
+        minMaxScalar<int32_t>(data, count, lowest, highest, 1);
+    }
+
+    inline void minMax64Scalar(const void *data, size_t count, int64_t &lowest, int64_t &highest)
+    {
+        std::memcpy(&lowest, data, sizeof(int64_t));
+        highest = lowest;
+        minMaxScalar<int64_t>(data, count, lowest, highest, 1);
+    }
+
+    inline size_t compare32Scalar(const void *data, size_t count, Comparison op, int32_t key, uint64_t *bits)
+    {
+        return compareScalar<int32_t>(data, count, op, key, bits);
+    }
+
+    inline size_t compare64Scalar(const void *data, size_t count, Comparison op, int64_t key, uint64_t *bits)
+    {
+        return compareScalar<int64_t>(data, count, op, key, bits);
+    }
+
+    inline size_t modulo32Scalar(const void *data, size_t count, int32_t modulus, Comparison op,
+                                 int32_t remainder, uint64_t *bits)
+    {
+        return moduloScalar<int32_t>(data, count, modulus, op, remainder, bits);
+    }
+
+    inline void affine32Scalar(const void *data, size_t count, int32_t factor, int32_t addend, void *out)
+    {
+        affineScalar<int32_t>(data, count, factor, addend, out);
+    }
+
+    inline bool contains32Scalar(const void *data, size_t count, int32_t key)
+    {
+        return containsScalar<int32_t>(data, count, key);
+    }
+
+    inline bool contains64Scalar(const void *data, size_t count, int64_t key)
+    {
+        return containsScalar<int64_t>(data, count, key);
+    }
+
+#if SIMD_KERNELS_X86
+    // ---------------------------------------------------------------- SSE2 (baseline)
+
+    __attribute__((target("sse2"))) inline bool contains32Sse2(const void *data, size_t count, int32_t key)
+    {
+        const __m128i *lanes = static_cast<const __m128i *>(data);
+        __m128i needle = _mm_set1_epi32(key);
+        size_t i = 0;
+        for (; i + 4 <= count; i += 4)
+        {
+            __m128i hits = _mm_cmpeq_epi32(_mm_loadu_si128(lanes + i / 4), needle);
+            if (_mm_movemask_epi8(hits) != 0)
+            {
+                return true;
+            }
+        }
+        return containsScalar<int32_t>(data, count, key, i);
+    }
+
+    __attribute__((target("sse2"))) inline bool contains64Sse2(const void *data, size_t count, int64_t key)
+    {
+        // SSE2 has no 64-bit compare: both 32-bit halves of a lane must match
+        const __m128i *lanes = static_cast<const __m128i *>(data);
+        __m128i needle = _mm_set1_epi64x(key);
+        size_t i = 0;
+        for (; i + 2 <= count; i += 2)
+        {
+            __m128i halves = _mm_cmpeq_epi32(_mm_loadu_si128(lanes + i / 2), needle);
+            __m128i swapped = _mm_shuffle_epi32(halves, _MM_SHUFFLE(2, 3, 0, 1));
+            if (_mm_movemask_epi8(_mm_and_si128(halves, swapped)) != 0)
+            {
+                return true;
+            }
+        }
+        return containsScalar<int64_t>(data, count, key, i);
+    }
+
+    __attribute__((target("sse2"))) inline size_t compare32Sse2(const void *data, size_t count, Comparison op,
+                                                                int32_t key, uint64_t *bits)
+    {
+        // 16 compares of 4 lanes fill one 64-bit word of the bitmap
+        const __m128i *lanes = static_cast<const __m128i *>(data);
+        __m128i needle = _mm_set1_epi32(key);
+        size_t matches = 0;
+        size_t i = 0;
+        for (; i + 64 <= count; i += 64)
+        {
+            uint64_t greater = 0, equal = 0;
+            for (size_t j = 0; j < 16; ++j)
+            {
+                __m128i values = _mm_loadu_si128(lanes + i / 4 + j);
+                uint64_t gt = static_cast<uint64_t>(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(values, needle))));
+                uint64_t eq = static_cast<uint64_t>(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(values, needle))));
+                greater |= gt << (4 * j);
+                equal |= eq << (4 * j);
+            }
+            bits[i / 64] = combineMasks(op, greater, equal);
+            matches += static_cast<size_t>(std::popcount(bits[i / 64]));
+        }
+        return matches + compareScalar<int32_t>(data, count, op, key, bits, i);
+    }
+
+    __attribute__((target("sse2"))) inline int64_t sum32Sse2(const void *data, size_t count)
+    {
+        // Lanes are sign-extended to 64 bits (SSE2 has no widening load)
+        const __m128i *lanes = static_cast<const __m128i *>(data);
+        __m128i total = _mm_setzero_si128();
+        size_t i = 0;
+        for (; i + 4 <= count; i += 4)
+        {
+            __m128i values = _mm_loadu_si128(lanes + i / 4);
+            __m128i signs = _mm_cmpgt_epi32(_mm_setzero_si128(), values);
+            total = _mm_add_epi64(total, _mm_unpacklo_epi32(values, signs));
+            total = _mm_add_epi64(total, _mm_unpackhi_epi32(values, signs));
+        }
+        uint64_t halves[2];
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(halves), total);
+        return static_cast<int64_t>(halves[0] + halves[1] +
+                                    static_cast<uint64_t>(sumScalar<int32_t>(data, count, i)));
+    }
+
+    __attribute__((target("sse2"))) inline int64_t sum64Sse2(const void *data, size_t count)
+    {
+        const __m128i *lanes = static_cast<const __m128i *>(data);
+        __m128i total = _mm_setzero_si128();
+        size_t i = 0;
+        for (; i + 2 <= count; i += 2)
+        {
+            total = _mm_add_epi64(total, _mm_loadu_si128(lanes + i / 2));
+        }
+        uint64_t halves[2];
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(halves), total);
+        return static_cast<int64_t>(halves[0] + halves[1] +
+                                    static_cast<uint64_t>(sumScalar<int64_t>(data, count, i)));
+    }
+
+    __attribute__((target("sse2"))) inline void minMax32Sse2(const void *data, size_t count,
+                                                             int32_t &lowest, int32_t &highest)
+    {
+        // SSE2 has no 32-bit min/max: select lanes through the compare mask
+        const __m128i *lanes = static_cast<const __m128i *>(data);
+        size_t i = 0;
+        if (count >= 4)
+        {
+            __m128i low = _mm_loadu_si128(lanes);
+            __m128i high = low;
+            for (i = 4; i + 4 <= count; i += 4)
+            {
+                __m128i values = _mm_loadu_si128(lanes + i / 4);
+                __m128i less = _mm_cmpgt_epi32(low, values);
+                low = _mm_or_si128(_mm_and_si128(less, values), _mm_andnot_si128(less, low));
+                __m128i greater = _mm_cmpgt_epi32(values, high);
+                high = _mm_or_si128(_mm_and_si128(greater, values), _mm_andnot_si128(greater, high));
+            }
+            int32_t lows[4], highs[4];
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(lows), low);
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(highs), high);
+            lowest = lows[0];
+            highest = highs[0];
+            minMaxScalar<int32_t>(lows, 4, lowest, highest, 1);
+            minMaxScalar<int32_t>(highs, 4, lowest, highest, 1);
+            minMaxScalar<int32_t>(data, count, lowest, highest, i);
+            return;
+        }
+        minMax32Scalar(data, count, lowest, highest);
+    }
+
+    // ---------------------------------------------------------------- AVX2
+
+    __attribute__((target("avx2"))) inline bool contains32Avx2(const void *data, size_t count, int32_t key)
+    {
+        const __m256i *lanes = static_cast<const __m256i *>(data);
+        __m256i needle = _mm256_set1_epi32(key);
+        size_t i = 0;
+        for (; i + 16 <= count; i += 16)
+        {
+            // Two compares per iteration hide the latency of the movemask
+            __m256i a = _mm256_cmpeq_epi32(_mm256_loadu_si256(lanes + i / 8), needle);
+            __m256i b = _mm256_cmpeq_epi32(_mm256_loadu_si256(lanes + i / 8 + 1), needle);
+            if (_mm256_movemask_epi8(_mm256_or_si256(a, b)) != 0)
+            {
+                return true;
+            }
+        }
+        for (; i + 8 <= count; i += 8)
+        {
+            if (_mm256_movemask_epi8(_mm256_cmpeq_epi32(_mm256_loadu_si256(lanes + i / 8), needle)) != 0)
+            {
+                return true;
+            }
+        }
+        return containsScalar<int32_t>(data, count, key, i);
+    }
+
+    __attribute__((target("avx2"))) inline bool contains64Avx2(const void *data, size_t count, int64_t key)
+    {
+        const __m256i *lanes = static_cast<const __m256i *>(data);
+        __m256i needle = _mm256_set1_epi64x(key);
+        size_t i = 0;
+        for (; i + 4 <= count; i += 4)
+        {
+            if (_mm256_movemask_epi8(_mm256_cmpeq_epi64(_mm256_loadu_si256(lanes + i / 4), needle)) != 0)
+            {
+                return true;
+            }
+        }
+        return containsScalar<int64_t>(data, count, key, i);
+    }
+
+    __attribute__((target("avx2"))) inline size_t compare32Avx2(const void *data, size_t count, Comparison op,
+                                                                int32_t key, uint64_t *bits)
+    {
+        const __m256i *lanes = static_cast<const __m256i *>(data);
+        __m256i needle = _mm256_set1_epi32(key);
+        size_t matches = 0;
+        size_t i = 0;
+        for (; i + 64 <= count; i += 64)
+        {
+            uint64_t greater = 0, equal = 0;
+            for (size_t j = 0; j < 8; ++j)
+            {
+                __m256i values = _mm256_loadu_si256(lanes + i / 8 + j);
+                uint64_t gt = static_cast<uint64_t>(
+                    _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(values, needle))));
+                uint64_t eq = static_cast<uint64_t>(
+                    _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(values, needle))));
+                greater |= gt << (8 * j);
+                equal |= eq << (8 * j);
+            }
+            bits[i / 64] = combineMasks(op, greater, equal);
+            matches += static_cast<size_t>(std::popcount(bits[i / 64]));
+        }
+        return matches + compareScalar<int32_t>(data, count, op, key, bits, i);
+    }
+
+    __attribute__((target("avx2"))) inline size_t compare64Avx2(const void *data, size_t count, Comparison op,
+                                                                int64_t key, uint64_t *bits)
+    {
+        const __m256i *lanes = static_cast<const __m256i *>(data);
+        __m256i needle = _mm256_set1_epi64x(key);
+        size_t matches = 0;
+        size_t i = 0;
+        for (; i + 64 <= count; i += 64)
+        {
+            uint64_t greater = 0, equal = 0;
+            for (size_t j = 0; j < 16; ++j)
+            {
+                __m256i values = _mm256_loadu_si256(lanes + i / 4 + j);
+                uint64_t gt = static_cast<uint64_t>(
+                    _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(values, needle))));
+                uint64_t eq = static_cast<uint64_t>(
+                    _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(values, needle))));
+                greater |= gt << (4 * j);
+                equal |= eq << (4 * j);
+            }
+            bits[i / 64] = combineMasks(op, greater, equal);
+            matches += static_cast<size_t>(std::popcount(bits[i / 64]));
+        }
+        return matches + compareScalar<int64_t>(data, count, op, key, bits, i);
+    }
+
+    __attribute__((target("avx2"))) inline int64_t sum32Avx2(const void *data, size_t count)
+    {
+        const __m128i *halves = static_cast<const __m128i *>(data);
+        __m256i first = _mm256_setzero_si256();
+        __m256i second = _mm256_setzero_si256();
+        size_t i = 0;
+        for (; i + 8 <= count; i += 8)
+        {
+            // Two accumulators of four sign-extended lanes each
+            first = _mm256_add_epi64(first, _mm256_cvtepi32_epi64(_mm_loadu_si128(halves + i / 4)));
+            second = _mm256_add_epi64(second, _mm256_cvtepi32_epi64(_mm_loadu_si128(halves + i / 4 + 1)));
+        }
+        uint64_t lanes[4];
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(lanes), _mm256_add_epi64(first, second));
+        return static_cast<int64_t>(lanes[0] + lanes[1] + lanes[2] + lanes[3] +
+                                    static_cast<uint64_t>(sumScalar<int32_t>(data, count, i)));
+    }
+
+    __attribute__((target("avx2"))) inline int64_t sum64Avx2(const void *data, size_t count)
+    {
+        const __m256i *lanes = static_cast<const __m256i *>(data);
+        __m256i first = _mm256_setzero_si256();
+        __m256i second = _mm256_setzero_si256();
+        size_t i = 0;
+        for (; i + 8 <= count; i += 8)
+        {
+            first = _mm256_add_epi64(first, _mm256_loadu_si256(lanes + i / 4));
+            second = _mm256_add_epi64(second, _mm256_loadu_si256(lanes + i / 4 + 1));
+        }
+        uint64_t totals[4];
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(totals), _mm256_add_epi64(first, second));
+        return static_cast<int64_t>(totals[0] + totals[1] + totals[2] + totals[3] +
+                                    static_cast<uint64_t>(sumScalar<int64_t>(data, count, i)));
+    }
+
+    __attribute__((target("avx2"))) inline void minMax32Avx2(const void *data, size_t count,
+                                                             int32_t &lowest, int32_t &highest)
+    {
+        const __m256i *lanes = static_cast<const __m256i *>(data);
+        if (count < 8)
+        {
+            minMax32Scalar(data, count, lowest, highest);
+            return;
+        }
+        __m256i low = _mm256_loadu_si256(lanes);
+        __m256i high = low;
+        size_t i = 8;
+        for (; i + 8 <= count; i += 8)
+        {
+            __m256i values = _mm256_loadu_si256(lanes + i / 8);
+            low = _mm256_min_epi32(low, values);
+            high = _mm256_max_epi32(high, values);
+        }
+        int32_t lows[8], highs[8];
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(lows), low);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(highs), high);
+        lowest = lows[0];
+        highest = highs[0];
+        minMaxScalar<int32_t>(lows, 8, lowest, highest, 1);
+        minMaxScalar<int32_t>(highs, 8, lowest, highest, 1);
+        minMaxScalar<int32_t>(data, count, lowest, highest, i);
+    }
+
+    __attribute__((target("avx2"))) inline void minMax64Avx2(const void *data, size_t count,
+                                                             int64_t &lowest, int64_t &highest)
+    {
+        // AVX2 has no 64-bit min/max: blend through the compare mask
+        const __m256i *lanes = static_cast<const __m256i *>(data);
+        if (count < 4)
+        {
+            minMax64Scalar(data, count, lowest, highest);
+            return;
+        }
+        __m256i low = _mm256_loadu_si256(lanes);
+        __m256i high = low;
+        size_t i = 4;
+        for (; i + 4 <= count; i += 4)
+        {
+            __m256i values = _mm256_loadu_si256(lanes + i / 4);
+            low = _mm256_blendv_epi8(low, values, _mm256_cmpgt_epi64(low, values));
+            high = _mm256_blendv_epi8(high, values, _mm256_cmpgt_epi64(values, high));
+        }
+        int64_t lows[4], highs[4];
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(lows), low);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(highs), high);
+        lowest = lows[0];
+        highest = highs[0];
+        minMaxScalar<int64_t>(lows, 4, lowest, highest, 1);
+        minMaxScalar<int64_t>(highs, 4, lowest, highest, 1);
+        minMaxScalar<int64_t>(data, count, lowest, highest, i);
+    }
+
+    __attribute__((target("avx2"))) inline size_t modulo32Avx2(const void *data, size_t count, int32_t modulus,
+                                                               Comparison op, int32_t remainder, uint64_t *bits)
+    {
+        // 32-bit values are exact in double precision, and so is x - q * m for
+        // q = floor(x / m). Rounding x * (1 / m) may put q off by one, which
+        // leaves the remainder in [-m, 2m): one correction each way fixes it.
+        const __m128i *quarters = static_cast<const __m128i *>(data);
+        const __m256d divisor = _mm256_set1_pd(static_cast<double>(modulus));
+        const __m256d inverse = _mm256_set1_pd(1.0 / static_cast<double>(modulus));
+        const __m256d zero = _mm256_setzero_pd();
+        const __m256d needle = _mm256_set1_pd(static_cast<double>(remainder));
+        size_t matches = 0;
+        size_t i = 0;
+        for (; i + 64 <= count; i += 64)
+        {
+            uint64_t greater = 0, equal = 0;
+            for (size_t j = 0; j < 16; ++j)
+            {
+                __m256d values = _mm256_cvtepi32_pd(_mm_loadu_si128(quarters + i / 4 + j));
+                __m256d quotient = _mm256_floor_pd(_mm256_mul_pd(values, inverse));
+                __m256d rest = _mm256_sub_pd(values, _mm256_mul_pd(quotient, divisor));
+                rest = _mm256_add_pd(rest, _mm256_and_pd(_mm256_cmp_pd(rest, zero, _CMP_LT_OQ), divisor));
+                rest = _mm256_sub_pd(rest, _mm256_and_pd(_mm256_cmp_pd(rest, divisor, _CMP_GE_OQ), divisor));
+                uint64_t gt = static_cast<uint64_t>(_mm256_movemask_pd(_mm256_cmp_pd(rest, needle, _CMP_GT_OQ)));
+                uint64_t eq = static_cast<uint64_t>(_mm256_movemask_pd(_mm256_cmp_pd(rest, needle, _CMP_EQ_OQ)));
+                greater |= gt << (4 * j);
+                equal |= eq << (4 * j);
+            }
+            bits[i / 64] = combineMasks(op, greater, equal);
+            matches += static_cast<size_t>(std::popcount(bits[i / 64]));
+        }
+        return matches + moduloScalar<int32_t>(data, count, modulus, op, remainder, bits, i);
+    }
+
+    __attribute__((target("avx2"))) inline void affine32Avx2(const void *data, size_t count, int32_t factor,
+                                                             int32_t addend, void *out)
+    {
+        const __m256i *lanes = static_cast<const __m256i *>(data);
+        __m256i *target = static_cast<__m256i *>(out);
+        __m256i multiplier = _mm256_set1_epi32(factor);
+        __m256i offset = _mm256_set1_epi32(addend);
+        size_t i = 0;
+        for (; i + 8 <= count; i += 8)
+        {
+            __m256i values = _mm256_loadu_si256(lanes + i / 8);
+            _mm256_storeu_si256(target + i / 8, _mm256_add_epi32(_mm256_mullo_epi32(values, multiplier), offset));
+        }
+        affineScalar<int32_t>(data, count, factor, addend, out, i);
+    }
+
+    // ---------------------------------------------------------------- AVX-512
+
+    __attribute__((target("avx512f"))) inline bool contains32Avx512(const void *data, size_t count, int32_t key)
+    {
+        const int32_t *values = static_cast<const int32_t *>(data);
+        __m512i needle = _mm512_set1_epi32(key);
+        size_t i = 0;
+        for (; i + 16 <= count; i += 16)
+        {
+            if (_mm512_cmpeq_epi32_mask(_mm512_loadu_si512(values + i), needle) != 0)
+            {
+                return true;
+            }
+        }
+        if (i < count)
+        {
+            // Masked load covers the tail without reading past the array
+            __mmask16 tail = static_cast<__mmask16>((1u << (count - i)) - 1);
+            __m512i rest = _mm512_maskz_loadu_epi32(tail, values + i);
+            return _mm512_mask_cmpeq_epi32_mask(tail, rest, needle) != 0;
+        }
+        return false;
+    }
+
+    __attribute__((target("avx512f"))) inline bool contains64Avx512(const void *data, size_t count, int64_t key)
+    {
+        const int64_t *values = static_cast<const int64_t *>(data);
+        __m512i needle = _mm512_set1_epi64(key);
+        size_t i = 0;
+        for (; i + 8 <= count; i += 8)
+        {
+            if (_mm512_cmpeq_epi64_mask(_mm512_loadu_si512(values + i), needle) != 0)
+            {
+                return true;
+            }
+        }
+        if (i < count)
+        {
+            __mmask8 tail = static_cast<__mmask8>((1u << (count - i)) - 1);
+            __m512i rest = _mm512_maskz_loadu_epi64(tail, values + i);
+            return _mm512_mask_cmpeq_epi64_mask(tail, rest, needle) != 0;
+        }
+        return false;
+    }
+    __attribute__((target("avx512f"))) inline size_t compare32Avx512(const void *data, size_t count, Comparison op,
+                                                                     int32_t key, uint64_t *bits)
+    {
+        const int32_t *values = static_cast<const int32_t *>(data);
+        __m512i needle = _mm512_set1_epi32(key);
+        size_t matches = 0;
+        size_t i = 0;
+        for (; i + 64 <= count; i += 64)
+        {
+            uint64_t greater = 0, equal = 0;
+            for (size_t j = 0; j < 4; ++j)
+            {
+                __m512i block = _mm512_loadu_si512(values + i + 16 * j);
+                greater |= static_cast<uint64_t>(_mm512_cmpgt_epi32_mask(block, needle)) << (16 * j);
+                equal |= static_cast<uint64_t>(_mm512_cmpeq_epi32_mask(block, needle)) << (16 * j);
+            }
+            bits[i / 64] = combineMasks(op, greater, equal);
+            matches += static_cast<size_t>(std::popcount(bits[i / 64]));
+        }
+        return matches + compareScalar<int32_t>(data, count, op, key, bits, i);
+    }
+
+    __attribute__((target("avx512f"))) inline size_t compare64Avx512(const void *data, size_t count, Comparison op,
+                                                                     int64_t key, uint64_t *bits)
+    {
+        const int64_t *values = static_cast<const int64_t *>(data);
+        __m512i needle = _mm512_set1_epi64(key);
+        size_t matches = 0;
+        size_t i = 0;
+        for (; i + 64 <= count; i += 64)
+        {
+            uint64_t greater = 0, equal = 0;
+            for (size_t j = 0; j < 8; ++j)
+            {
+                __m512i block = _mm512_loadu_si512(values + i + 8 * j);
+                greater |= static_cast<uint64_t>(_mm512_cmpgt_epi64_mask(block, needle)) << (8 * j);
+                equal |= static_cast<uint64_t>(_mm512_cmpeq_epi64_mask(block, needle)) << (8 * j);
+            }
+            bits[i / 64] = combineMasks(op, greater, equal);
+            matches += static_cast<size_t>(std::popcount(bits[i / 64]));
+        }
+        return matches + compareScalar<int64_t>(data, count, op, key, bits, i);
+    }
+
+    __attribute__((target("avx512f"))) inline int64_t sum32Avx512(const void *data, size_t count)
+    {
+        const int32_t *values = static_cast<const int32_t *>(data);
+        __m512i first = _mm512_setzero_si512();
+        __m512i second = _mm512_setzero_si512();
+        size_t i = 0;
+        for (; i + 16 <= count; i += 16)
+        {
+            // Masked forms: GCC 12 warns about the undefined source of the plain ones
+            const __m256i *halves = reinterpret_cast<const __m256i *>(values + i);
+            first = _mm512_add_epi64(first, _mm512_maskz_cvtepi32_epi64(0xFF, _mm256_loadu_si256(halves)));
+            second = _mm512_add_epi64(second, _mm512_maskz_cvtepi32_epi64(0xFF, _mm256_loadu_si256(halves + 1)));
+        }
+        uint64_t totals[8];
+        _mm512_storeu_si512(totals, _mm512_add_epi64(first, second));
+        uint64_t total = static_cast<uint64_t>(sumScalar<int32_t>(data, count, i));
+        for (uint64_t lane : totals)
+        {
+            total += lane;
+        }
+        return static_cast<int64_t>(total);
+    }
+
+    __attribute__((target("avx512f"))) inline int64_t sum64Avx512(const void *data, size_t count)
+    {
+        const int64_t *values = static_cast<const int64_t *>(data);
+        __m512i first = _mm512_setzero_si512();
+        __m512i second = _mm512_setzero_si512();
+        size_t i = 0;
+        for (; i + 16 <= count; i += 16)
+        {
+            first = _mm512_add_epi64(first, _mm512_loadu_si512(values + i));
+            second = _mm512_add_epi64(second, _mm512_loadu_si512(values + i + 8));
+        }
+        uint64_t totals[8];
+        _mm512_storeu_si512(totals, _mm512_add_epi64(first, second));
+        uint64_t total = static_cast<uint64_t>(sumScalar<int64_t>(data, count, i));
+        for (uint64_t lane : totals)
+        {
+            total += lane;
+        }
+        return static_cast<int64_t>(total);
+    }
+
+    __attribute__((target("avx512f"))) inline void minMax32Avx512(const void *data, size_t count,
+                                                                  int32_t &lowest, int32_t &highest)
+    {
+        const int32_t *values = static_cast<const int32_t *>(data);
+        if (count < 16)
+        {
+            minMax32Scalar(data, count, lowest, highest);
+            return;
+        }
+        __m512i low = _mm512_loadu_si512(values);
+        __m512i high = low;
+        size_t i = 16;
+        for (; i + 16 <= count; i += 16)
+        {
+            // Masked forms, as in sum32Avx512
+            __m512i block = _mm512_loadu_si512(values + i);
+            low = _mm512_mask_min_epi32(low, 0xFFFF, low, block);
+            high = _mm512_mask_max_epi32(high, 0xFFFF, high, block);
+        }
+        int32_t lows[16], highs[16];
+        _mm512_storeu_si512(lows, low);
+        _mm512_storeu_si512(highs, high);
+        lowest = lows[0];
+        highest = highs[0];
+        minMaxScalar<int32_t>(lows, 16, lowest, highest, 1);
+        minMaxScalar<int32_t>(highs, 16, lowest, highest, 1);
+        minMaxScalar<int32_t>(data, count, lowest, highest, i);
+    }
+
+    __attribute__((target("avx512f"))) inline void minMax64Avx512(const void *data, size_t count,
+                                                                  int64_t &lowest, int64_t &highest)
+    {
+        const int64_t *values = static_cast<const int64_t *>(data);
+        if (count < 8)
+        {
+            minMax64Scalar(data, count, lowest, highest);
+            return;
+        }
+        __m512i low = _mm512_loadu_si512(values);
+        __m512i high = low;
+        size_t i = 8;
+        for (; i + 8 <= count; i += 8)
+        {
+            __m512i block = _mm512_loadu_si512(values + i);
+            low = _mm512_mask_min_epi64(low, 0xFF, low, block);
+            high = _mm512_mask_max_epi64(high, 0xFF, high, block);
+        }
+        int64_t lows[8], highs[8];
+        _mm512_storeu_si512(lows, low);
+        _mm512_storeu_si512(highs, high);
+        lowest = lows[0];
+        highest = highs[0];
+        minMaxScalar<int64_t>(lows, 8, lowest, highest, 1);
+        minMaxScalar<int64_t>(highs, 8, lowest, highest, 1);
+        minMaxScalar<int64_t>(data, count, lowest, highest, i);
+    }
+
+    __attribute__((target("avx512f"))) inline size_t modulo32Avx512(const void *data, size_t count, int32_t modulus,
+                                                                    Comparison op, int32_t remainder, uint64_t *bits)
+    {
+        // Same double-precision remainders as modulo32Avx2, 8 per instruction
+        const int32_t *values = static_cast<const int32_t *>(data);
+        const __m512d divisor = _mm512_set1_pd(static_cast<double>(modulus));
+        const __m512d inverse = _mm512_set1_pd(1.0 / static_cast<double>(modulus));
+        const __m512d zero = _mm512_setzero_pd();
+        const __m512d needle = _mm512_set1_pd(static_cast<double>(remainder));
+        size_t matches = 0;
+        size_t i = 0;
+        for (; i + 64 <= count; i += 64)
+        {
+            uint64_t greater = 0, equal = 0;
+            for (size_t j = 0; j < 8; ++j)
+            {
+                // Masked forms, as in sum32Avx512
+                __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(values + i + 8 * j));
+                __m512d x = _mm512_maskz_cvtepi32_pd(0xFF, block);
+                __m512d quotient = _mm512_maskz_roundscale_pd(0xFF, _mm512_mul_pd(x, inverse),
+                                                              _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+                __m512d rest = _mm512_sub_pd(x, _mm512_mul_pd(quotient, divisor));
+                rest = _mm512_mask_add_pd(rest, _mm512_cmp_pd_mask(rest, zero, _CMP_LT_OQ), rest, divisor);
+                rest = _mm512_mask_sub_pd(rest, _mm512_cmp_pd_mask(rest, divisor, _CMP_GE_OQ), rest, divisor);
+                greater |= static_cast<uint64_t>(_mm512_cmp_pd_mask(rest, needle, _CMP_GT_OQ)) << (8 * j);
+                equal |= static_cast<uint64_t>(_mm512_cmp_pd_mask(rest, needle, _CMP_EQ_OQ)) << (8 * j);
+            }
+            bits[i / 64] = combineMasks(op, greater, equal);
+            matches += static_cast<size_t>(std::popcount(bits[i / 64]));
+        }
+        return matches + moduloScalar<int32_t>(data, count, modulus, op, remainder, bits, i);
+    }
+
+    __attribute__((target("avx512f"))) inline void affine32Avx512(const void *data, size_t count, int32_t factor,
+                                                                  int32_t addend, void *out)
+    {
+        const int32_t *values = static_cast<const int32_t *>(data);
+        int32_t *target = static_cast<int32_t *>(out);
+        __m512i multiplier = _mm512_set1_epi32(factor);
+        __m512i offset = _mm512_set1_epi32(addend);
+        size_t i = 0;
+        for (; i + 16 <= count; i += 16)
+        {
+            __m512i block = _mm512_loadu_si512(values + i);
+            _mm512_storeu_si512(target + i, _mm512_add_epi32(_mm512_mullo_epi32(block, multiplier), offset));
+        }
+        affineScalar<int32_t>(data, count, factor, addend, out, i);
+    }
+#endif // SIMD_KERNELS_X86
+
+    /**
+     * @brief Kernel chosen for the running CPU (resolved once, on first use).
+     */
+    inline Contains32Fn selectContains32()
+    {
+        switch (detectSimdLevel())
+        {
+#if SIMD_KERNELS_X86
+        case SimdLevel::AVX512:
+            return contains32Avx512;
+        case SimdLevel::AVX2:
+            return contains32Avx2;
+        case SimdLevel::SSE2:
+            return contains32Sse2;
+#endif
+        default:
+            return contains32Scalar;
+        }
+    }
+
+    inline Contains64Fn selectContains64()
+    {
+        switch (detectSimdLevel())
+        {
+#if SIMD_KERNELS_X86
+        case SimdLevel::AVX512:
+            return contains64Avx512;
+        case SimdLevel::AVX2:
+            return contains64Avx2;
+        case SimdLevel::SSE2:
+            return contains64Sse2;
+#endif
+        default:
+            return contains64Scalar;
+        }
+    }
+
+    inline Compare32Fn selectCompare32()
+    {
+        switch (detectSimdLevel())
+        {
+#if SIMD_KERNELS_X86
+        case SimdLevel::AVX512:
+            return compare32Avx512;
+        case SimdLevel::AVX2:
+            return compare32Avx2;
+        case SimdLevel::SSE2:
+            return compare32Sse2;
+#endif
+        default:
+            return compare32Scalar;
+        }
+    }
+
+    inline Compare64Fn selectCompare64()
+    {
+        // SSE2 has no 64-bit ordered compare, so that level stays scalar
+        switch (detectSimdLevel())
+        {
+#if SIMD_KERNELS_X86
+        case SimdLevel::AVX512:
+            return compare64Avx512;
+        case SimdLevel::AVX2:
+            return compare64Avx2;
+#endif
+        default:
+            return compare64Scalar;
+        }
+    }
+
+    inline Sum32Fn selectSum32()
+    {
+        switch (detectSimdLevel())
+        {
+#if SIMD_KERNELS_X86
+        case SimdLevel::AVX512:
+            return sum32Avx512;
+        case SimdLevel::AVX2:
+            return sum32Avx2;
+        case SimdLevel::SSE2:
+            return sum32Sse2;
+#endif
+        default:
+            return sum32Scalar;
+        }
+    }
+
+    inline Sum64Fn selectSum64()
+    {
+        switch (detectSimdLevel())
+        {
+#if SIMD_KERNELS_X86
+        case SimdLevel::AVX512:
+            return sum64Avx512;
+        case SimdLevel::AVX2:
+            return sum64Avx2;
+        case SimdLevel::SSE2:
+            return sum64Sse2;
+#endif
+        default:
+            return sum64Scalar;
+        }
+    }
+
+    inline MinMax32Fn selectMinMax32()
+    {
+        switch (detectSimdLevel())
+        {
+#if SIMD_KERNELS_X86
+        case SimdLevel::AVX512:
+            return minMax32Avx512;
+        case SimdLevel::AVX2:
+            return minMax32Avx2;
+        case SimdLevel::SSE2:
+            return minMax32Sse2;
+#endif
+        default:
+            return minMax32Scalar;
+        }
+    }
+
+    inline MinMax64Fn selectMinMax64()
+    {
+        // SSE2 has no 64-bit ordered compare, so that level stays scalar
+        switch (detectSimdLevel())
+        {
+#if SIMD_KERNELS_X86
+        case SimdLevel::AVX512:
+            return minMax64Avx512;
+        case SimdLevel::AVX2:
+            return minMax64Avx2;
+#endif
+        default:
+            return minMax64Scalar;
+        }
+    }
+
+    inline Modulo32Fn selectModulo32()
+    {
+        // SSE2 has no rounding to -infinity, so that level stays scalar
+        switch (detectSimdLevel())
+        {
+#if SIMD_KERNELS_X86
+        case SimdLevel::AVX512:
+            return modulo32Avx512;
+        case SimdLevel::AVX2:
+            return modulo32Avx2;
+#endif
+        default:
+            return modulo32Scalar;
+        }
+    }
+
+    inline Affine32Fn selectAffine32()
+    {
+        // SSE2 has no 32-bit multiply, so that level stays scalar
+        switch (detectSimdLevel())
+        {
+#if SIMD_KERNELS_X86
+        case SimdLevel::AVX512:
+            return affine32Avx512;
+        case SimdLevel::AVX2:
+            return affine32Avx2;
+#endif
+        default:
+            return affine32Scalar;
+        }
+    }
+} // namespace simd_detail
+
+/**
+ * @brief Detects the widest instruction set supported by the running CPU.
+ */
+inline SimdLevel detectSimdLevel()
+{
+#if SIMD_KERNELS_X86
+    static const SimdLevel level = []()
+    {
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f"))
+            return SimdLevel::AVX512;
+        if (__builtin_cpu_supports("avx2"))
+            return SimdLevel::AVX2;
+        if (__builtin_cpu_supports("sse2"))
+            return SimdLevel::SSE2;
+        return SimdLevel::SCALAR;
+    }();
+    return level;
+#else
+    return SimdLevel::SCALAR;
+#endif
+}
+
+/**
+ * @brief Returns the instruction set chosen at runtime ("scalar", "sse2", "avx2", "avx512").
+ */
+inline const char *simdLevelName()
+{
+    switch (detectSimdLevel())
+    {
+    case SimdLevel::AVX512:
+        return "avx512";
+    case SimdLevel::AVX2:
+        return "avx2";
+    case SimdLevel::SSE2:
+        return "sse2";
+    default:
+        return "scalar";
+    }
+}
+
+/**
+ * @brief Linear search over a contiguous array using the widest available SIMD.
+ * @param data Array to scan.
+ * @param count Number of elements.
+ * @param key Value to look for.
+ * @return True if key occurs in data[0..count).
+ */
+template <typename T>
+bool simdContains(const T *data, size_t count, T key)
+{
+    static_assert(IsSimdScannable<T>::value, "simdContains needs a 4- or 8-byte integral type");
+    if constexpr (sizeof(T) == 4)
+    {
+        static const simd_detail::Contains32Fn kernel = simd_detail::selectContains32();
+        return kernel(data, count, static_cast<int32_t>(key));
+    }
+    else
+    {
+        static const simd_detail::Contains64Fn kernel = simd_detail::selectContains64();
+        return kernel(data, count, static_cast<int64_t>(key));
+    }
+}
+
+/**
+ * @brief Evaluates a predicate over a contiguous array into a bitmap using the
+ *        widest available SIMD. Unsigned and other types use the scalar loop:
+ *        the vector compares are signed.
+ */
+template <typename T>
+size_t simdCompare(const T *data, size_t count, Comparison op, T key, uint64_t *bits)
+{
+    if constexpr (IsSimdScannable<T>::value && std::is_signed<T>::value && sizeof(T) == 4)
+    {
+        static const simd_detail::Compare32Fn kernel = simd_detail::selectCompare32();
+        return kernel(data, count, op, static_cast<int32_t>(key), bits);
+    }
+    else if constexpr (IsSimdScannable<T>::value && std::is_signed<T>::value)
+    {
+        static const simd_detail::Compare64Fn kernel = simd_detail::selectCompare64();
+        return kernel(data, count, op, static_cast<int64_t>(key), bits);
+    }
+    else
+    {
+        size_t matches = 0;
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (simd_detail::compareValue(data[i], op, key))
+            {
+                bits[i / 64] |= uint64_t(1) << (i % 64);
+                ++matches;
+            }
+        }
+        return matches;
+    }
+}
+
+/**
+ * @brief Sums a contiguous array using the widest available SIMD. Unsigned and
+ *        other integral types use the scalar loop: the vector widening is signed.
+ */
+template <typename T>
+int64_t simdSum(const T *data, size_t count)
+{
+    if constexpr (IsSimdScannable<T>::value && std::is_signed<T>::value && sizeof(T) == 4)
+    {
+        static const simd_detail::Sum32Fn kernel = simd_detail::selectSum32();
+        return kernel(data, count);
+    }
+    else if constexpr (IsSimdScannable<T>::value && std::is_signed<T>::value)
+    {
+        static const simd_detail::Sum64Fn kernel = simd_detail::selectSum64();
+        return kernel(data, count);
+    }
+    else
+    {
+        uint64_t sum = 0;
+        for (size_t i = 0; i < count; ++i)
+        {
+            sum += static_cast<uint64_t>(data[i]);
+        }
+        return static_cast<int64_t>(sum);
+    }
+}
+
+/**
+ * @brief Smallest and largest value of a non-empty array, using the widest
+ *        available SIMD for signed 4- and 8-byte types.
+ */
+template <typename T>
+void simdMinMax(const T *data, size_t count, T &lowest, T &highest)
+{
+    if constexpr (IsSimdScannable<T>::value && std::is_signed<T>::value && sizeof(T) == 4)
+    {
+        static const simd_detail::MinMax32Fn kernel = simd_detail::selectMinMax32();
+        int32_t low, high;
+        kernel(data, count, low, high);
+        lowest = static_cast<T>(low);
+        highest = static_cast<T>(high);
+    }
+    else if constexpr (IsSimdScannable<T>::value && std::is_signed<T>::value)
+    {
+        static const simd_detail::MinMax64Fn kernel = simd_detail::selectMinMax64();
+        int64_t low, high;
+        kernel(data, count, low, high);
+        lowest = static_cast<T>(low);
+        highest = static_cast<T>(high);
+    }
+    else
+    {
+        lowest = data[0];
+        highest = data[0];
+        for (size_t i = 1; i < count; ++i)
+        {
+            lowest = data[i] < lowest ? data[i] : lowest;
+            highest = highest < data[i] ? data[i] : highest;
+        }
+    }
+}
+
+/**
+ * @brief Modulo predicate over a contiguous array into a bitmap; only 4-byte
+ *        signed values have vector kernels (their remainders are exact in double).
+ */
+template <typename T>
+size_t simdCompareModulo(const T *data, size_t count, T modulus, Comparison op, T remainder,
+                         uint64_t *bits)
+{
+    if constexpr (IsSimdScannable<T>::value && std::is_signed<T>::value && sizeof(T) == 4)
+    {
+        static const simd_detail::Modulo32Fn kernel = simd_detail::selectModulo32();
+        return kernel(data, count, static_cast<int32_t>(modulus), op, static_cast<int32_t>(remainder), bits);
+    }
+    else
+    {
+        return simd_detail::moduloScalar<T>(data, count, modulus, op, remainder, bits);
+    }
+}
+
+/**
+ * @brief x * factor + addend over a contiguous array; only 4-byte signed values
+ *        have vector kernels (there is no 64-bit multiply below AVX-512DQ).
+ */
+template <typename T>
+void simdAffine(const T *data, size_t count, T factor, T addend, T *out)
+{
+    static_assert(std::is_integral<T>::value, "simdAffine needs an integral type");
+    if constexpr (IsSimdScannable<T>::value && std::is_signed<T>::value && sizeof(T) == 4)
+    {
+        static const simd_detail::Affine32Fn kernel = simd_detail::selectAffine32();
+        kernel(data, count, static_cast<int32_t>(factor), static_cast<int32_t>(addend), out);
+    }
+    else
+    {
+        simd_detail::affineScalar<T>(data, count, factor, addend, out);
+    }
+}
+
+#endif // SIMDKERNELS_HXX
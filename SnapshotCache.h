@@ -0,0 +1,187 @@
+// ===================================================================================
+// File:        SnapshotCache.h
+// Author:      Group 4
+// Date:        2026-10-18
+// Description: Declaration of SnapshotKey and SnapshotCache<T>, an on-disk cache
+//              of loaded collections. After the definitions section of an input
+//              file has been parsed, the resulting sets are written to a binary
+//              snapshot named after a hash of that section and its length. A
+//              later run over a file with the same definitions (the queries may
+//              differ) maps the snapshot into memory and copies every set's
+//              storage in bulk instead of parsing and inserting again.
+//
+//              A snapshot holds, after a fixed header (magic, format version,
+//              element size, key), the diagnostics printed while parsing and
+//              the image of every set (see DataSet<T>::appendSnapshot), and
+//              ends with a SnapshotChecksum of every byte before it. It is a
+//              private cache: native byte order, no portability across
+//              platforms, and any mismatch or damage (a wrong checksum, or
+//              ordered elements or runs out of order) simply counts as a miss.
+//
+//              Supported operations:
+//              ----------------------------------------------------------------------
+//              void SnapshotKey::add(std::string_view text)
+//                  Feeds one line of the definitions section into the key.
+//
+//              void SnapshotChecksum::add(const char* bytes, size_t size)
+//                  Feeds the next bytes of a snapshot into its checksum.
+//
+//              SnapshotCache(const std::string& directory)
+//                  Uses (and creates on demand) the given cache directory.
+//
+//              std::string pathFor(const SnapshotKey& key) const
+//                  Returns the file that holds the snapshot for a key.
+//
+//              bool load(const SnapshotKey& key, DataSetCollection<T>& collection,
+//                        std::string& diagnostics) const
+//                  Adds the cached sets to the collection; false on a miss.
+//
+//              void store(const SnapshotKey& key, const DataSetCollection<T>& collection,
+//                         const std::string& diagnostics) const
+//                  Writes the snapshot of a collection (atomically replaced).
+// ===================================================================================
+
+#ifndef SNAPSHOTCACHE_H
+#define SNAPSHOTCACHE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include "DataSetCollection.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#define SNAPSHOT_USE_MMAP 1
+#endif
+
+/// Bumped whenever the snapshot layout changes; older files then count as misses.
+inline constexpr uint32_t SNAPSHOT_FORMAT_VERSION = 3;
+
+/// Starting value of the snapshot hashes (any odd constant).
+inline constexpr uint64_t SNAPSHOT_HASH_SEED = 0x9E3779B97F4A7C15ULL;
+
+/// Folds one 64-bit word into a snapshot hash (SnapshotKey, SnapshotChecksum).
+uint64_t mixSnapshotWord(uint64_t hash, uint64_t word);
+
+/**
+ * @class SnapshotKey
+ * @brief Identifies a definitions section: a 64-bit hash of its lines, their
+ *        total length and the loading mode (adaptive or frozen sets store
+ *        other layouts).
+ *        Comment and blank lines are not fed in, so editing them keeps the key.
+ */
+class SnapshotKey
+{
+public:
+    uint64_t hash;   ///< Hash of every line fed in, in order.
+    uint64_t length; ///< Bytes fed in, plus one per line.
+    bool adaptive;   ///< Whether the collection is loaded in adaptive mode.
+    bool frozen;     ///< Whether large sets are frozen after loading.
+
+    /**
+     * @brief Creates the key of an empty definitions section.
+     * @param adaptiveMode True when the sets are loaded adaptive.
+     * @param frozenMode True when large sets are frozen after loading.
+     */
+    SnapshotKey(bool adaptiveMode, bool frozenMode);
+
+    /**
+     * @brief Feeds one line into the key. The line is hashed eight bytes at a
+     *        time, so keying a large section costs far less than parsing it.
+     * @param text Line contents, without the line break.
+     */
+    void add(std::string_view text);
+};
+
+/**
+ * @class SnapshotChecksum
+ * @brief 64-bit checksum of a byte stream, eight bytes at a time. Feeding the
+ *        same bytes in any split gives the same value, so a snapshot can be
+ *        checked whole after it was written set by set.
+ */
+class SnapshotChecksum
+{
+    uint64_t hash;                  ///< Hash of the complete words fed in.
+    uint64_t length;                ///< Bytes fed in.
+    char pending[sizeof(uint64_t)]; ///< Bytes of the incomplete last word.
+    size_t pendingSize;             ///< Number of bytes in pending.
+
+public:
+    /**
+     * @brief Creates the checksum of no bytes.
+     */
+    SnapshotChecksum();
+
+    /**
+     * @brief Feeds the next bytes of the stream.
+     * @param bytes Start of the bytes.
+     * @param size Number of bytes.
+     */
+    void add(const char *bytes, size_t size);
+
+    /**
+     * @brief Returns the checksum of every byte fed in so far.
+     */
+    uint64_t value() const;
+};
+
+/**
+ * @class SnapshotCache
+ * @brief Stores and restores whole collections by SnapshotKey.
+ *
+ * @tparam T Element type of the sets (must be trivially copyable).
+ */
+template <typename T>
+class SnapshotCache
+{
+    std::string directory; ///< Folder holding the snapshot files.
+
+    /// First bytes of every snapshot file.
+    static constexpr char MAGIC[8] = {'D', 'S', 'E', 'T', 'S', 'N', 'A', 'P'};
+
+    static uint8_t modeOf(const SnapshotKey &key);
+    bool parse(const char *data, size_t size, const SnapshotKey &key,
+               std::vector<DataSet<T>> &sets, std::string &diagnostics) const;
+
+public:
+    /**
+     * @brief Creates a cache over a directory; nothing is touched before store().
+     * @param folder Cache directory.
+     */
+    explicit SnapshotCache(const std::string &folder);
+
+    /**
+     * @brief Returns the file that holds the snapshot for a key.
+     * @param key The definitions key.
+     * @return Path inside the cache directory.
+     */
+    std::string pathFor(const SnapshotKey &key) const;
+
+    /**
+     * @brief Restores the sets cached under a key and adds them to the
+     *        collection, in their original order. The file is memory-mapped
+     *        where the platform allows it. Nothing is added on a miss.
+     * @param key The definitions key.
+     * @param collection Receives the sets.
+     * @param diagnostics Receives the messages printed while the sets were parsed.
+     * @return True on a hit; false if the file is missing, stale or damaged.
+     */
+    bool load(const SnapshotKey &key, DataSetCollection<T> &collection,
+              std::string &diagnostics) const;
+
+    /**
+     * @brief Writes the snapshot of a collection under a key. The file is
+     *        written under a temporary name and renamed, so concurrent runs
+     *        never read a partial snapshot.
+     * @param key The definitions key.
+     * @param collection The sets to store.
+     * @param diagnostics Messages printed while the sets were parsed.
+     * @throws std::runtime_error if the snapshot cannot be written.
+     */
+    void store(const SnapshotKey &key, const DataSetCollection<T> &collection,
+               const std::string &diagnostics) const;
+};
+
+#include "SnapshotCache.hxx"
+
+#endif // SNAPSHOTCACHE_H
@@ -0,0 +1,348 @@
+// ===================================================================================
+// File:        SnapshotCache.hxx
+// Author:      Group 4
+// Date:        2026-10-18
+// Description: Implementation of SnapshotKey and the templated class SnapshotCache<T>.
+// ===================================================================================
+// Group 4 | Joel Felipe Martinez | Xamuel Perez | Rafael Held
+
+#ifndef SNAPSHOTCACHE_HXX
+#define SNAPSHOTCACHE_HXX
+
+#include "SnapshotCache.h"
+#include <cstdio>     // For std::snprintf
+#include <algorithm>  // For std::min
+#include <cstring>    // For std::memcpy, std::memcmp
+#include <filesystem>
+#include <fstream>
+#include <random>     // For std::random_device
+#include <stdexcept>  // For std::runtime_error
+#include <vector>
+
+#ifdef SNAPSHOT_USE_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/**
+ * @brief Folds one 64-bit word into a hash (multiply-xorshift).
+ */
+inline uint64_t mixSnapshotWord(uint64_t hash, uint64_t word)
+{
+    hash = (hash ^ word) * 0xFF51AFD7ED558CCDULL;
+    return hash ^ (hash >> 32);
+}
+
+inline SnapshotKey::SnapshotKey(bool adaptiveMode, bool frozenMode)
+    : hash(SNAPSHOT_HASH_SEED), length(0), adaptive(adaptiveMode), frozen(frozenMode) {}
+
+/**
+ * @brief Feeds one line into the key, eight bytes at a time. The line length
+ *        is mixed in last so that moving a line break changes the hash.
+ * @param text Line contents, without the line break.
+ */
+inline void SnapshotKey::add(std::string_view text)
+{
+    size_t i = 0;
+    for (; i + sizeof(uint64_t) <= text.size(); i += sizeof(uint64_t))
+    {
+        uint64_t word;
+        std::memcpy(&word, text.data() + i, sizeof(word));
+        hash = mixSnapshotWord(hash, word);
+    }
+    if (i < text.size())
+    {
+        uint64_t word = 0;
+        std::memcpy(&word, text.data() + i, text.size() - i);
+        hash = mixSnapshotWord(hash, word);
+    }
+    hash = mixSnapshotWord(hash, text.size());
+    length += text.size() + 1;
+}
+
+inline SnapshotChecksum::SnapshotChecksum()
+    : hash(SNAPSHOT_HASH_SEED), length(0), pending(), pendingSize(0) {}
+
+/**
+ * @brief Feeds the next bytes: first completes the pending word, then mixes
+ *        whole words straight from the input and keeps the tail pending.
+ * @param bytes Start of the bytes.
+ * @param size Number of bytes.
+ */
+inline void SnapshotChecksum::add(const char *bytes, size_t size)
+{
+    length += size;
+    if (pendingSize > 0)
+    {
+        size_t fill = std::min(size, sizeof(pending) - pendingSize);
+        std::memcpy(pending + pendingSize, bytes, fill);
+        pendingSize += fill;
+        bytes += fill;
+        size -= fill;
+        if (pendingSize < sizeof(pending))
+        {
+            return;
+        }
+        uint64_t word;
+        std::memcpy(&word, pending, sizeof(word));
+        hash = mixSnapshotWord(hash, word);
+        pendingSize = 0;
+    }
+    for (; size >= sizeof(uint64_t); bytes += sizeof(uint64_t), size -= sizeof(uint64_t))
+    {
+        uint64_t word;
+        std::memcpy(&word, bytes, sizeof(word));
+        hash = mixSnapshotWord(hash, word);
+    }
+    std::memcpy(pending, bytes, size);
+    pendingSize = size;
+}
+
+/**
+ * @brief Mixes in the pending bytes (zero-padded) and the total length.
+ */
+inline uint64_t SnapshotChecksum::value() const
+{
+    uint64_t word = 0;
+    std::memcpy(&word, pending, pendingSize);
+    return mixSnapshotWord(mixSnapshotWord(hash, word), length);
+}
+
+template <typename T>
+SnapshotCache<T>::SnapshotCache(const std::string &folder) : directory(folder) {}
+
+/**
+ * @brief Returns "<directory>/defs-<hash>-<length>[-adaptive][-frozen].snap".
+ * @param key The definitions key.
+ * @return Path inside the cache directory.
+ */
+template <typename T>
+std::string SnapshotCache<T>::pathFor(const SnapshotKey &key) const
+{
+    char hex[17];
+    std::snprintf(hex, sizeof(hex), "%016llx", static_cast<unsigned long long>(key.hash));
+    std::string file = "defs-" + std::string(hex) + "-" + std::to_string(key.length) +
+                       (key.adaptive ? "-adaptive" : "") + (key.frozen ? "-frozen" : "") + ".snap";
+    return (std::filesystem::path(directory) / file).string();
+}
+
+/**
+ * @brief Loading mode byte of the header: bit 0 adaptive, bit 1 frozen.
+ */
+template <typename T>
+uint8_t SnapshotCache<T>::modeOf(const SnapshotKey &key)
+{
+    return static_cast<uint8_t>((key.adaptive ? 1 : 0) | (key.frozen ? 2 : 0));
+}
+
+/**
+ * @brief Checks the checksum and header of a snapshot against the key and
+ *        decodes its sets.
+ * @param data Snapshot bytes.
+ * @param size Number of bytes.
+ * @param key Expected key.
+ * @param sets Receives the decoded sets.
+ * @param diagnostics Receives the stored parse messages.
+ * @return False if the snapshot does not match the key or is damaged.
+ */
+template <typename T>
+bool SnapshotCache<T>::parse(const char *data, size_t size, const SnapshotKey &key,
+                             std::vector<DataSet<T>> &sets, std::string &diagnostics) const
+{
+    uint64_t stored;
+    if (size < sizeof(stored))
+    {
+        return false;
+    }
+    size -= sizeof(stored);
+    std::memcpy(&stored, data + size, sizeof(stored));
+    SnapshotChecksum checksum;
+    checksum.add(data, size);
+    if (checksum.value() != stored)
+    {
+        return false; // Truncated or corrupted on disk
+    }
+
+    const char *cursor = data;
+    const char *end = data + size;
+    auto read = [&cursor, end](void *bytes, size_t length)
+    {
+        if (static_cast<size_t>(end - cursor) < length)
+        {
+            return false;
+        }
+        std::memcpy(bytes, cursor, length);
+        cursor += length;
+        return true;
+    };
+
+    char magic[sizeof(MAGIC)];
+    uint32_t version;
+    uint32_t elementSize;
+    uint64_t hash;
+    uint64_t length;
+    uint8_t mode;
+    uint64_t diagnosticsLength;
+    if (!read(magic, sizeof(magic)) || std::memcmp(magic, MAGIC, sizeof(MAGIC)) != 0 ||
+        !read(&version, sizeof(version)) || version != SNAPSHOT_FORMAT_VERSION ||
+        !read(&elementSize, sizeof(elementSize)) || elementSize != sizeof(T) ||
+        !read(&hash, sizeof(hash)) || hash != key.hash ||
+        !read(&length, sizeof(length)) || length != key.length ||
+        !read(&mode, sizeof(mode)) || mode != modeOf(key) ||
+        !read(&diagnosticsLength, sizeof(diagnosticsLength)) ||
+        diagnosticsLength > static_cast<uint64_t>(end - cursor))
+    {
+        return false;
+    }
+    diagnostics.assign(cursor, diagnosticsLength);
+    cursor += diagnosticsLength;
+
+    uint64_t setCount;
+    if (!read(&setCount, sizeof(setCount)))
+    {
+        return false;
+    }
+    try
+    {
+        for (uint64_t i = 0; i < setCount; ++i)
+        {
+            sets.push_back(DataSet<T>::readSnapshot(cursor, end));
+        }
+    }
+    catch (const std::runtime_error &)
+    {
+        return false; // Damaged image: treat as a miss and rebuild
+    }
+    return cursor == end;
+}
+
+/**
+ * @brief Restores the sets cached under a key into the collection.
+ * @param key The definitions key.
+ * @param collection Receives the sets.
+ * @param diagnostics Receives the messages printed while the sets were parsed.
+ * @return True on a hit.
+ */
+template <typename T>
+bool SnapshotCache<T>::load(const SnapshotKey &key, DataSetCollection<T> &collection,
+                            std::string &diagnostics) const
+{
+    std::string path = pathFor(key);
+    std::vector<DataSet<T>> sets;
+    bool hit = false;
+#ifdef SNAPSHOT_USE_MMAP
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        return false;
+    }
+    struct stat info;
+    if (::fstat(fd, &info) != 0 || info.st_size <= 0)
+    {
+        ::close(fd);
+        return false;
+    }
+    size_t size = static_cast<size_t>(info.st_size);
+    void *mapped = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd); // The mapping keeps the file alive
+    if (mapped == MAP_FAILED)
+    {
+        return false;
+    }
+    ::madvise(mapped, size, MADV_SEQUENTIAL);
+    hit = parse(static_cast<const char *>(mapped), size, key, sets, diagnostics);
+    ::munmap(mapped, size);
+#else
+    std::ifstream in(path, std::ios::binary);
+    if (!in.is_open())
+    {
+        return false;
+    }
+    std::string bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    hit = parse(bytes.data(), bytes.size(), key, sets, diagnostics);
+#endif
+    if (!hit)
+    {
+        diagnostics.clear();
+        return false;
+    }
+    for (const DataSet<T> &set : sets)
+    {
+        collection.addSet(set);
+    }
+    return true;
+}
+
+/**
+ * @brief Writes the snapshot of a collection under a key.
+ * @param key The definitions key.
+ * @param collection The sets to store.
+ * @param diagnostics Messages printed while the sets were parsed.
+ * @throws std::runtime_error if the snapshot cannot be written.
+ */
+template <typename T>
+void SnapshotCache<T>::store(const SnapshotKey &key, const DataSetCollection<T> &collection,
+                             const std::string &diagnostics) const
+{
+    std::filesystem::create_directories(directory);
+    std::string path = pathFor(key);
+    std::string temporary = path + ".tmp" + std::to_string(std::random_device()());
+
+    std::ofstream out(temporary, std::ios::binary | std::ios::trunc);
+    if (!out.is_open())
+    {
+        throw std::runtime_error("Cannot write snapshot '" + temporary + "'.");
+    }
+
+    std::string buffer;
+    auto put = [&buffer](const void *bytes, size_t length)
+    { buffer.append(static_cast<const char *>(bytes), length); };
+    uint32_t version = SNAPSHOT_FORMAT_VERSION;
+    uint32_t elementSize = sizeof(T);
+    uint8_t mode = modeOf(key);
+    uint64_t diagnosticsLength = diagnostics.size();
+    std::vector<std::string> names = collection.getSetNames();
+    uint64_t setCount = names.size();
+    put(MAGIC, sizeof(MAGIC));
+    put(&version, sizeof(version));
+    put(&elementSize, sizeof(elementSize));
+    put(&key.hash, sizeof(key.hash));
+    put(&key.length, sizeof(key.length));
+    put(&mode, sizeof(mode));
+    put(&diagnosticsLength, sizeof(diagnosticsLength));
+    put(diagnostics.data(), diagnostics.size());
+    put(&setCount, sizeof(setCount));
+    SnapshotChecksum checksum;
+    checksum.add(buffer.data(), buffer.size());
+    out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+
+    try
+    {
+        // One set at a time, so the buffer never holds more than the largest image
+        for (const std::string &name : names)
+        {
+            buffer.clear();
+            collection.shareSet(name)->appendSnapshot(buffer); // Pinned: stays resident
+            checksum.add(buffer.data(), buffer.size());
+            out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        }
+        uint64_t trailer = checksum.value();
+        out.write(reinterpret_cast<const char *>(&trailer), sizeof(trailer));
+        out.close();
+        if (out.fail())
+        {
+            throw std::runtime_error("Cannot write snapshot '" + temporary + "'.");
+        }
+        std::filesystem::rename(temporary, path);
+    }
+    catch (...)
+    {
+        out.close();
+        std::filesystem::remove(temporary);
+        throw;
+    }
+}
+
+#endif // SNAPSHOTCACHE_HXX
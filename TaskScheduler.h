@@ -0,0 +1,177 @@
+// ===================================================================================
+// File:        TaskScheduler.h
+// Author:      Group 4
+// Date:        2026-10-18
+// Description: Declaration of TaskScheduler, the work-stealing thread pool shared
+//              by every parallel path of the simulator (set building, batched
+//              queries, parallel set operations). Each worker owns a deque: it
+//              pushes and pops its own tasks at the back while idle workers steal
+//              from the front of the others. A thread waiting in sync() runs
+//              pending tasks instead of blocking, so nested parallel regions reuse
+//              the same threads and never oversubscribe the machine.
+//
+//              Supported operations:
+//              ----------------------------------------------------------------------
+//              TaskScheduler(size_t threads)
+//                  Starts threads - 1 workers; the thread that waits is the last one.
+//
+//              size_t threadCount() const
+//                  Returns the degree of parallelism.
+//
+//              void parallelFor(size_t begin, size_t end, size_t grain, Fn body)
+//                  Calls body(lo, hi) on disjoint chunks of [begin, end) in
+//                  parallel and returns when all of them finished.
+//
+//              TaskGroup::spawn(Task task) / TaskGroup::sync()
+//                  Fork/join primitives: spawn queues a task, sync waits (helping)
+//                  until every task of the group finished and rethrows the first
+//                  exception one of them raised.
+// ===================================================================================
+
+#ifndef TASKSCHEDULER_H
+#define TASKSCHEDULER_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @class TaskScheduler
+ * @brief Work-stealing scheduler with fork/join task groups.
+ *        Queue 0 receives tasks spawned by threads outside the pool (such as
+ *        main); queue i > 0 belongs to worker i.
+ */
+class TaskScheduler
+{
+public:
+    typedef std::function<void()> Task;
+
+    /**
+     * @class TaskGroup
+     * @brief Set of tasks that is waited for as a unit (fork/join).
+     */
+    class TaskGroup
+    {
+    private:
+        TaskScheduler &scheduler;
+        std::atomic<size_t> pending; ///< Tasks spawned but not finished yet.
+        std::mutex errorMutex;
+        std::exception_ptr error; ///< First exception thrown by a task.
+
+        friend class TaskScheduler;
+        void finish(std::exception_ptr failure);
+
+    public:
+        /**
+         * @brief Creates an empty group bound to a scheduler.
+         */
+        explicit TaskGroup(TaskScheduler &owner);
+
+        TaskGroup(const TaskGroup &) = delete;
+        TaskGroup &operator=(const TaskGroup &) = delete;
+
+        /**
+         * @brief Waits for the remaining tasks (exceptions are dropped here;
+         *        call sync() to observe them).
+         */
+        ~TaskGroup();
+
+        /**
+         * @brief Queues a task on the calling thread's deque.
+         * @param task Callable to run on some thread of the pool.
+         */
+        void spawn(Task task);
+
+        /**
+         * @brief Runs queued tasks until every task of this group finished.
+         * @throws The first exception raised by a task of the group.
+         */
+        void sync();
+    };
+
+    /**
+     * @brief Starts the pool.
+     * @param threads Degree of parallelism (>= 1). threads - 1 workers are
+     *        started; with 1 every task runs on the thread calling sync().
+     */
+    explicit TaskScheduler(size_t threads);
+
+    TaskScheduler(const TaskScheduler &) = delete;
+    TaskScheduler &operator=(const TaskScheduler &) = delete;
+
+    /**
+     * @brief Stops and joins the workers. No task group may still be running.
+     */
+    ~TaskScheduler();
+
+    /**
+     * @brief Returns the degree of parallelism.
+     */
+    size_t threadCount() const;
+
+    /**
+     * @brief Number of hardware threads (at least 1).
+     */
+    static size_t hardwareThreads();
+
+    /**
+     * @brief Calls body(lo, hi) on disjoint chunks covering [begin, end), in parallel.
+     *        Chunks hold at least `grain` indices; ranges of at most `grain`
+     *        indices run inline. May be called from inside another task.
+     * @param begin First index.
+     * @param end One past the last index.
+     * @param grain Minimum chunk size.
+     * @param body Callable taking (size_t lo, size_t hi).
+     * @throws The first exception raised by a chunk.
+     */
+    template <typename Fn>
+    void parallelFor(size_t begin, size_t end, size_t grain, Fn &&body);
+
+private:
+    /**
+     * @brief A queued task and the group waiting for it.
+     */
+    struct Job
+    {
+        Task task;
+        TaskGroup *group;
+    };
+
+    /**
+     * @brief One deque of jobs; the owner uses the back, thieves the front.
+     */
+    struct Queue
+    {
+        std::mutex mutex;
+        std::deque<Job> jobs;
+    };
+
+    /// Chunks per thread parallelFor aims for, so that stealing can balance load.
+    static constexpr size_t CHUNKS_PER_THREAD = 4;
+
+    std::vector<std::unique_ptr<Queue>> queues; ///< queues[0] is for outside threads.
+    std::vector<std::thread> workers;
+    std::atomic<size_t> queued; ///< Jobs sitting in any queue.
+    std::mutex sleepMutex;
+    std::condition_variable wake;
+    bool stopping;
+
+    static thread_local TaskScheduler *currentScheduler; ///< Pool of the calling worker.
+    static thread_local size_t currentQueue;             ///< Queue of the calling worker.
+
+    size_t queueOfCaller() const;
+    void push(Job job);
+    bool tryRunOne(size_t self);
+    void workerLoop(size_t index);
+};
+
+#include "TaskScheduler.hxx"
+
+#endif // TASKSCHEDULER_H
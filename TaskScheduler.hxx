@@ -0,0 +1,295 @@
+// ===================================================================================
+// File:        TaskScheduler.hxx
+// Author:      Group 4
+// Date:        2026-10-18
+// Description: Implementation of TaskScheduler and TaskScheduler::TaskGroup.
+// ===================================================================================
+// Group 4 | Joel Felipe Martinez | Xamuel Perez | Rafael Held
+
+#ifndef TASKSCHEDULER_HXX
+#define TASKSCHEDULER_HXX
+
+#include "TaskScheduler.h"
+#include <algorithm> // For std::min, std::max
+
+inline thread_local TaskScheduler *TaskScheduler::currentScheduler = nullptr;
+inline thread_local size_t TaskScheduler::currentQueue = 0;
+
+/**
+ * @brief Creates an empty group bound to a scheduler.
+ */
+inline TaskScheduler::TaskGroup::TaskGroup(TaskScheduler &owner)
+    : scheduler(owner), pending(0), errorMutex(), error() {}
+
+/**
+ * @brief Waits for the remaining tasks (exceptions are dropped here;
+ *        call sync() to observe them).
+ */
+inline TaskScheduler::TaskGroup::~TaskGroup()
+{
+    try
+    {
+        sync();
+    }
+    catch (...)
+    {
+        // Already reported to whoever called sync(), or deliberately ignored
+    }
+}
+
+/**
+ * @brief Queues a task on the calling thread's deque.
+ * @param task Callable to run on some thread of the pool.
+ */
+inline void TaskScheduler::TaskGroup::spawn(Task task)
+{
+    pending.fetch_add(1, std::memory_order_relaxed);
+    scheduler.push(Job{std::move(task), this});
+}
+
+/**
+ * @brief Runs queued tasks until every task of this group finished.
+ *        Helping instead of blocking is what makes nested parallelism safe:
+ *        a worker waiting for its children executes them (or other work).
+ * @throws The first exception raised by a task of the group.
+ */
+inline void TaskScheduler::TaskGroup::sync()
+{
+    size_t self = scheduler.queueOfCaller();
+    while (pending.load(std::memory_order_acquire) > 0)
+    {
+        if (!scheduler.tryRunOne(self))
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    std::exception_ptr failure;
+    {
+        std::lock_guard<std::mutex> lock(errorMutex);
+        std::swap(failure, error);
+    }
+    if (failure)
+    {
+        std::rethrow_exception(failure);
+    }
+}
+
+/**
+ * @brief Marks one task of the group as finished, keeping its exception if any.
+ */
+inline void TaskScheduler::TaskGroup::finish(std::exception_ptr failure)
+{
+    if (failure)
+    {
+        std::lock_guard<std::mutex> lock(errorMutex);
+        if (!error)
+        {
+            error = failure;
+        }
+    }
+    pending.fetch_sub(1, std::memory_order_release);
+}
+
+/**
+ * @brief Starts the pool.
+ * @param threads Degree of parallelism (>= 1).
+ */
+inline TaskScheduler::TaskScheduler(size_t threads)
+    : queues(), workers(), queued(0), sleepMutex(), wake(), stopping(false)
+{
+    threads = std::max<size_t>(threads, 1);
+    for (size_t i = 0; i < threads; ++i)
+    {
+        queues.push_back(std::make_unique<Queue>());
+    }
+    for (size_t i = 1; i < threads; ++i)
+    {
+        workers.emplace_back([this, i]()
+                             { workerLoop(i); });
+    }
+}
+
+/**
+ * @brief Stops and joins the workers. No task group may still be running.
+ */
+inline TaskScheduler::~TaskScheduler()
+{
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        stopping = true;
+    }
+    wake.notify_all();
+    for (std::thread &worker : workers)
+    {
+        worker.join();
+    }
+}
+
+/**
+ * @brief Returns the degree of parallelism.
+ */
+inline size_t TaskScheduler::threadCount() const
+{
+    return queues.size();
+}
+
+/**
+ * @brief Number of hardware threads (at least 1).
+ */
+inline size_t TaskScheduler::hardwareThreads()
+{
+    return std::max<size_t>(std::thread::hardware_concurrency(), 1);
+}
+
+/**
+ * @brief Queue the calling thread pushes to and pops from.
+ */
+inline size_t TaskScheduler::queueOfCaller() const
+{
+    return currentScheduler == this ? currentQueue : 0;
+}
+
+/**
+ * @brief Pushes a job on the caller's deque and wakes one sleeping worker.
+ */
+inline void TaskScheduler::push(Job job)
+{
+    Queue &queue = *queues[queueOfCaller()];
+    {
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.jobs.push_back(std::move(job));
+    }
+    queued.fetch_add(1, std::memory_order_release);
+    {
+        // Pairs with the predicate check in workerLoop so no wake-up is lost
+        std::lock_guard<std::mutex> lock(sleepMutex);
+    }
+    wake.notify_one();
+}
+
+/**
+ * @brief Runs one job: the newest of the caller's own deque, or else the
+ *        oldest of another deque (stealing takes the largest pieces of work).
+ * @param self Queue of the calling thread.
+ * @return False if every deque was empty.
+ */
+inline bool TaskScheduler::tryRunOne(size_t self)
+{
+    Job job;
+    bool found = false;
+    {
+        Queue &own = *queues[self];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.jobs.empty())
+        {
+            job = std::move(own.jobs.back());
+            own.jobs.pop_back();
+            found = true;
+        }
+    }
+    for (size_t step = 1; !found && step < queues.size(); ++step)
+    {
+        Queue &victim = *queues[(self + step) % queues.size()];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.jobs.empty())
+        {
+            job = std::move(victim.jobs.front());
+            victim.jobs.pop_front();
+            found = true;
+        }
+    }
+    if (!found)
+    {
+        return false;
+    }
+
+    queued.fetch_sub(1, std::memory_order_relaxed);
+    std::exception_ptr failure;
+    try
+    {
+        job.task();
+    }
+    catch (...)
+    {
+        failure = std::current_exception();
+    }
+    job.group->finish(failure);
+    return true;
+}
+
+/**
+ * @brief Main loop of worker `index`: run or steal jobs, sleep when there are none.
+ */
+inline void TaskScheduler::workerLoop(size_t index)
+{
+    currentScheduler = this;
+    currentQueue = index;
+    while (true)
+    {
+        if (tryRunOne(index))
+        {
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(sleepMutex);
+        wake.wait(lock, [this]()
+                  { return stopping || queued.load(std::memory_order_acquire) > 0; });
+        if (stopping && queued.load(std::memory_order_acquire) == 0)
+        {
+            return;
+        }
+    }
+}
+
+/**
+ * @brief Calls body(lo, hi) on disjoint chunks covering [begin, end), in parallel.
+ *        Chunks hold at least `grain` indices; ranges of at most `grain`
+ *        indices run inline. May be called from inside another task.
+ * @param begin First index.
+ * @param end One past the last index.
+ * @param grain Minimum chunk size.
+ * @param body Callable taking (size_t lo, size_t hi).
+ * @throws The first exception raised by a chunk.
+ */
+template <typename Fn>
+void TaskScheduler::parallelFor(size_t begin, size_t end, size_t grain, Fn &&body)
+{
+    if (end <= begin)
+    {
+        return;
+    }
+    size_t count = end - begin;
+    grain = std::max<size_t>(grain, 1);
+    if (threadCount() == 1 || count <= grain)
+    {
+        body(begin, end);
+        return;
+    }
+
+    size_t chunks = std::min((count + grain - 1) / grain, threadCount() * CHUNKS_PER_THREAD);
+    TaskGroup group(*this);
+    for (size_t c = 1; c < chunks; ++c)
+    {
+        size_t lo = begin + count * c / chunks;
+        size_t hi = begin + count * (c + 1) / chunks;
+        group.spawn([&body, lo, hi]()
+                    { body(lo, hi); });
+    }
+    // The caller takes the first chunk itself, then helps with the rest
+    std::exception_ptr failure;
+    try
+    {
+        body(begin, begin + count / chunks);
+    }
+    catch (...)
+    {
+        failure = std::current_exception();
+    }
+    group.sync();
+    if (failure)
+    {
+        std::rethrow_exception(failure);
+    }
+}
+
+#endif // TASKSCHEDULER_HXX
@@ -0,0 +1,218 @@
+// ===================================================================================
+// File:        benchmark.cxx
+// Author:      Group 4
+// Date:        2026-10-18
+// Description: Standalone performance benchmarks for the set engine.
+//
+//              USAGE:
+//              $ g++ -std=c++20 -O2 -pthread benchmark.cxx -o benchmark
+//              $ ./benchmark concurrent [max_threads] [element_count]
+//              $ ./benchmark spill [set_count] [set_size] [accesses]
+//
+//              Modes:
+//              ----------------------------------------------------------------------
+//              concurrent [max_threads=64] [element_count=100000000]
+//                  Ingests element_count distinct integers into one HASH-backed
+//                  DataSet<int> with 1, 2, 4, ... max_threads threads of a
+//                  TaskScheduler and reports throughput for each thread count.
+//
+//              spill [set_count=64] [set_size=200000] [accesses=4000]
+//                  Loads set_count frozen sets into a DataSetCollection<int> and
+//                  runs the same skewed lookup workload (90% of the accesses go to
+//                  10% of the sets) under shrinking memory budgets, reporting
+//                  time, hit rate and evictions as sets spill to disk.
+// ===================================================================================
+// Group 4 | Joel Felipe Martinez | Xamuel Perez | Rafael Held
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "DataSet.h"
+#include "DataSetCollection.h"
+#include "TaskScheduler.h"
+
+/**
+ * @brief Maps i in [0, 2^32) to a distinct pseudo-random 32-bit value, so the
+ *        ingested keys are unique but not inserted in ascending order.
+ */
+static int scrambleKey(uint64_t i)
+{
+    return static_cast<int>(static_cast<uint32_t>(i * 2654435761ULL));
+}
+
+/**
+ * @brief Inserts `count` distinct keys into one HASH set using `threads` threads.
+ * @return Elapsed wall time in seconds.
+ */
+static double ingestConcurrently(size_t threads, uint64_t count)
+{
+    DataSet<int> set("S");
+    set.useRepresentation(SetRepresentation::HASH);
+
+    TaskScheduler pool(threads);
+    size_t grain = static_cast<size_t>((count + threads - 1) / threads); // One chunk per thread
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    pool.parallelFor(0, static_cast<size_t>(count), grain, [&set](size_t begin, size_t end)
+                     {
+        for (size_t i = begin; i < end; ++i)
+        {
+            set.insert(scrambleKey(i));
+        } });
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    if (set.size() != count)
+    {
+        std::cerr << "Error: expected " << count << " elements, found " << set.size() << std::endl;
+        std::exit(1);
+    }
+    return elapsed.count();
+}
+
+/**
+ * @brief Runs the concurrent-ingestion scaling benchmark.
+ */
+static void runConcurrentBenchmark(size_t maxThreads, uint64_t count)
+{
+    std::cout << "Concurrent insert into one set: " << count << " integers" << std::endl;
+    std::cout << std::setw(8) << "threads" << std::setw(12) << "seconds"
+              << std::setw(14) << "Mkeys/s" << std::setw(10) << "speedup" << std::endl;
+
+    double baseline = 0.0;
+    for (size_t threads = 1; threads <= maxThreads; threads *= 2)
+    {
+        double seconds = ingestConcurrently(threads, count);
+        if (threads == 1)
+        {
+            baseline = seconds;
+        }
+        std::cout << std::setw(8) << threads
+                  << std::setw(12) << std::fixed << std::setprecision(3) << seconds
+                  << std::setw(14) << std::setprecision(1) << count / seconds / 1e6
+                  << std::setw(10) << std::setprecision(2) << baseline / seconds << std::endl;
+    }
+}
+
+/**
+ * @brief Runs `accesses` batched lookups against the collection: 90% of them
+ *        hit one of the first tenth of the sets. The seed is fixed, so every
+ *        budget sees the same access sequence.
+ * @return Elapsed wall time in seconds.
+ */
+static double runSkewedWorkload(const DataSetCollection<int> &collection, size_t setCount,
+                                size_t accesses)
+{
+    std::mt19937_64 random(42);
+    size_t hotCount = setCount / 10 > 0 ? setCount / 10 : 1;
+    std::vector<int> keys(256);
+    std::vector<bool> found;
+    size_t members = 0;
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (size_t a = 0; a < accesses; ++a)
+    {
+        size_t target = random() % 10 < 9 ? random() % hotCount : random() % setCount;
+        for (int &key : keys)
+        {
+            key = scrambleKey(random() % (4 * setCount));
+        }
+        collection.containsMany("S" + std::to_string(target), keys, found);
+        for (bool hit : found)
+        {
+            members += hit;
+        }
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    if (members == SIZE_MAX)
+    {
+        std::cout << "unreachable" << std::endl; // Keeps the lookups observable
+    }
+    return elapsed.count();
+}
+
+/**
+ * @brief Runs the memory-budget benchmark: the same workload with the budget
+ *        set to 100%, 50%, 25%, ... of the collection's footprint.
+ */
+static void runSpillBenchmark(size_t setCount, size_t setSize, size_t accesses)
+{
+    DataSetCollection<int> collection;
+    for (size_t s = 0; s < setCount; ++s)
+    {
+        DataSet<int> set("S" + std::to_string(s));
+        set.useRepresentation(SetRepresentation::TREE);
+        for (size_t i = 0; i < setSize; ++i)
+        {
+            set.insert(scrambleKey(s * setSize + i));
+        }
+        set.freeze();
+        collection.addSet(set);
+    }
+    size_t total = collection.getMemoryStats().residentBytes;
+    std::string spillPath =
+        (std::filesystem::temp_directory_path() / "benchmark-sets.spill").string();
+
+    std::cout << "Skewed lookups over " << setCount << " sets of " << setSize
+              << " integers (" << total / (1024 * 1024) << " MiB), " << accesses
+              << " batches of 256" << std::endl;
+    std::cout << std::setw(8) << "budget" << std::setw(12) << "seconds"
+              << std::setw(12) << "hit rate" << std::setw(12) << "evictions"
+              << std::setw(10) << "slowdown" << std::endl;
+
+    double baseline = 0.0;
+    for (size_t percent = 100; percent >= 3; percent /= 2)
+    {
+        collection.setMemoryBudget(total * percent / 100, spillPath);
+        double seconds = runSkewedWorkload(collection, setCount, accesses);
+        DataSetCollection<int>::MemoryStats stats = collection.getMemoryStats();
+        if (percent == 100)
+        {
+            baseline = seconds;
+        }
+        double accessesSeen = static_cast<double>(stats.hits + stats.misses);
+        std::cout << std::setw(7) << percent << "%"
+                  << std::setw(12) << std::fixed << std::setprecision(3) << seconds
+                  << std::setw(11) << std::setprecision(1)
+                  << (accessesSeen > 0 ? 100.0 * stats.hits / accessesSeen : 100.0) << "%"
+                  << std::setw(12) << stats.evictions
+                  << std::setw(10) << std::setprecision(2) << seconds / baseline << std::endl;
+    }
+    collection.setMemoryBudget(0, spillPath);
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc < 2)
+    {
+        std::cerr << "Usage: " << argv[0] << " concurrent [max_threads] [element_count]" << std::endl;
+        std::cerr << "       " << argv[0] << " spill [set_count] [set_size] [accesses]" << std::endl;
+        return 1;
+    }
+
+    std::string mode = argv[1];
+    if (mode == "concurrent")
+    {
+        size_t maxThreads = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 64;
+        uint64_t count = argc > 3 ? std::strtoull(argv[3], nullptr, 10) : 100000000ULL;
+        runConcurrentBenchmark(maxThreads, count);
+    }
+    else if (mode == "spill")
+    {
+        size_t setCount = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 64;
+        size_t setSize = argc > 3 ? std::strtoul(argv[3], nullptr, 10) : 200000;
+        size_t accesses = argc > 4 ? std::strtoul(argv[4], nullptr, 10) : 4000;
+        runSpillBenchmark(setCount, setSize, accesses);
+    }
+    else
+    {
+        std::cerr << "Unknown benchmark: " << mode << std::endl;
+        return 1;
+    }
+    return 0;
+}
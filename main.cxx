@@ -8,32 +8,136 @@
 //              DataSetCollection<T>, and prints the results.
 //
 //              USAGE:
-//              $ ./simulador input_file.in
+//              $ g++ -std=c++20 -O2 main.cxx -o simulador
+//              $ ./simulador [--adaptive] [--freeze] [--threads N] [--cache DIR]
+//                            [--memory-budget BYTES] [--max-output N] [--max-work N]
+//                            [--on-limit reject|truncate|stream] [--sorted-output]
+//                            input_file.in
+//
+//              Options:
+//              --adaptive      Every set tracks its size, value span, runs and
+//                              insert/lookup mix and switches representation
+//                              by itself (see DataSet<T>::adapt).
+//              --freeze        Once loaded, sets of at least 64 elements switch
+//                              to the read-only FROZEN layout, or to INTERVAL
+//                              when they are mostly runs, for faster lookups
+//                              (see DataSetCollection<T>::freezeAll). Those
+//                              sets then print in ascending order.
+//              --threads N     Size of the work-stealing pool (default 1, 0 =
+//                              one per hardware thread). Sets are built and
+//                              queries answered in parallel, in bounded
+//                              batches; queries with large results run alone
+//                              and stream. The output is the same as with
+//                              one thread.
+//              --cache DIR     Keep a binary snapshot of the loaded sets in DIR,
+//                              keyed by a hash of the definitions section. A
+//                              later run over the same definitions (queries
+//                              may differ) maps the snapshot instead of
+//                              parsing the sets again (see SnapshotCache.h).
+//              --memory-budget BYTES
+//                              Keep at most about BYTES of sets in memory; the
+//                              least recently used ones are spilled to a
+//                              temporary file and read back when a query
+//                              needs them (see DataSetCollection<T>).
+//              --max-output N  Largest result a single query may print, in
+//                              items (elements, subsets or pairs). Every
+//                              query is estimated from its operand sizes
+//                              first (see CostEstimator.h).
+//              --max-work N    Largest number of values a query may read or
+//                              produce.
+//              --on-limit ACTION
+//                              What happens to a query beyond a limit:
+//                              reject (default) skips it, truncate prints its
+//                              first N items followed by "...", stream runs it
+//                              in full but writes it straight to the output
+//                              instead of buffering it with --threads. Each
+//                              case is reported on stderr.
+//              --sorted-output Print every set and every set operation result
+//                              in ascending order, as "print sorted" does.
 //
 //              Input format:
 //              ----------------------------------------------------------------------
 //              A <count>       # Name of set and number of elements
 //              <values...>     # Elements of the set (space-separated integers)
 //              B <count>
-//              <values...>
+//              1..500 700      # Range literals lo..hi (inclusive) may be mixed
+//                              # with single values; such sets are stored as
+//                              # runs and never expanded element by element
 //              ...
 //              Q               # Start of query section
 //              print A
+//              print sorted A  # Ascending order, whatever the representation
 //              union A B
 //              intersection A B
 //              difference A B
 //              symmetric_difference A B
+//              contains A x1 x2 ... xn
+//              stats A         # Representation and statistics of a set
+//              sum A / min A / max A / mean A
+//              quantile A 0.5  # Element of rank floor(q * (n - 1)), q in [0, 1]
+//              catalog         # Count, range, distinct estimate and hash of every set
+//              memory          # Memory budget: resident/spilled sets, hits, misses
+//              powerset A      # Subsets are enumerated lazily, one per line
+//              cartesian A B
+//              cartesian A B where first > 10   # Filters A (or B) first (==, !=, <,
+//                                              # <=, >, >= on first or second)
+//              filter A > 10   # Same comparisons on the elements, by SIMD kernels
+//              filter A mod 3 == 0             # Floored remainders, in [0, 3)
+//              map A *2        # Also +k and -k: an affine map of every element
+//              filter A > 10 as B              # "as <Name>" stores the result as a
+//                                              # new set instead of printing it
+//              partition A by mod 4            # Stores A_0 .. A_3 in one pass
+//              partition A by ranges 0..9 10..99 as D   # Stores D_0, D_1; values
+//                                              # outside every range are left out
+//
+//              Results of set operations are printed while they are generated
+//              (see SetGenerators.h); no result set is built in memory. filter
+//              and map build their result inside the engine; a query storing
+//              sets (filter/map ... as, partition) waits for the queries before
+//              it and runs alone.
 // ===================================================================================
 // Group 4 | Joel Felipe Martinez | Xamuel Perez | Rafael Held
 
+#include <charconv>
+#include <cstdint>
+#include <cstdio> // For std::snprintf
+#include <filesystem>
 #include <iostream>
 #include <fstream>
+#include <limits>
+#include <memory>
+#include <random>
 #include <sstream>
 #include <string>
+#include <string_view>
+#include <utility>
 #include <vector>
 
+#include "CostEstimator.h"
 #include "DataSet.h"
 #include "DataSetCollection.h"
+#include "Generator.h"
+#include "PairColumnSet.h"
+#include "SetGenerators.h"
+#include "SnapshotCache.h"
+#include "TaskScheduler.h"
+
+/// Queries per thread buffered before a parallel batch is answered and flushed.
+constexpr size_t BATCH_QUERIES_PER_THREAD = 8;
+
+/// Estimated output a batch may buffer before it is answered and flushed.
+/// Queries are only estimated under --max-output or --max-work.
+constexpr uint64_t BATCH_MAX_BYTES = 4 << 20;
+
+/// Queries estimated to print at least this much are never buffered: they
+/// run alone and write straight to the output.
+constexpr uint64_t STREAM_MIN_BYTES = 1 << 20;
+
+/// Bytes assumed per printed item (an int and its separator) in those estimates.
+constexpr uint64_t PRINTED_BYTES_PER_ITEM = 12;
+
+/// Digits printed after the decimal point by "mean" (fixed notation, never 5e+07).
+constexpr int MEAN_DECIMALS = 6;
 
 /**
  * @brief Removes leading and trailing whitespace from a string.
@@ -47,6 +151,34 @@ std::string trim(const std::string &str)
     return str.substr(first, last - first + 1);
 }
 
+/**
+ * @brief Returns the next whitespace-separated token of `rest` and drops it (and
+ *        the whitespace before it) from `rest`; empty once no token is left.
+ *        Tokens are views into the line, so tokenizing never copies.
+ */
+std::string_view nextToken(std::string_view &rest)
+{
+    size_t first = rest.find_first_not_of(" \t\r\n\v\f");
+    if (first == std::string_view::npos)
+    {
+        rest = std::string_view();
+        return rest;
+    }
+    size_t last = rest.find_first_of(" \t\r\n\v\f", first);
+    std::string_view token = rest.substr(first, last - first);
+    rest.remove_prefix(last == std::string_view::npos ? rest.size() : last);
+    return token;
+}
+
+/**
+ * @brief Parses a whole token as an int.
+ */
+bool parseInt(std::string_view text, int &value)
+{
+    std::from_chars_result parsed = std::from_chars(text.data(), text.data() + text.size(), value);
+    return !text.empty() && parsed.ec == std::errc() && parsed.ptr == text.data() + text.size();
+}
+
 /**
  * @brief Parses a line of space-separated integers and returns them in a vector.
  */
@@ -60,24 +192,946 @@ std::vector<int> parseIntList(const std::string &line)
     return result;
 }
 
+/**
+ * @brief Parses one token that is an integer or a range literal "lo..hi" with
+ *        lo <= hi; an integer v gives lo = hi = v.
+ */
+bool parseRange(std::string_view token, int &lo, int &hi)
+{
+    const char *begin = token.data();
+    const char *end = token.data() + token.size();
+    std::from_chars_result first = std::from_chars(begin, end, lo);
+    if (first.ec != std::errc())
+    {
+        return false;
+    }
+    if (first.ptr == end)
+    {
+        hi = lo;
+        return true;
+    }
+    if (end - first.ptr <= 2 || first.ptr[0] != '.' || first.ptr[1] != '.')
+    {
+        return false;
+    }
+    std::from_chars_result second = std::from_chars(first.ptr + 2, end, hi);
+    return second.ec == std::errc() && second.ptr == end && lo <= hi;
+}
+
+/**
+ * @brief Parses a line of space-separated integers and range literals "lo..hi".
+ *        Single values are appended to `values`, ranges to `ranges`.
+ * @return False if some token was neither an integer nor a range with lo <= hi
+ *         (that token is skipped; the rest of the line is still parsed).
+ */
+bool parseValueList(const std::string &line, std::vector<int> &values,
+                    std::vector<std::pair<int, int>> &ranges)
+{
+    bool valid = true;
+    std::string_view rest = line;
+    for (std::string_view token = nextToken(rest); !token.empty(); token = nextToken(rest))
+    {
+        int lo = 0, hi = 0;
+        if (!parseRange(token, lo, hi))
+        {
+            valid = false;
+        }
+        else if (lo == hi)
+        {
+            values.push_back(lo);
+        }
+        else
+        {
+            ranges.emplace_back(lo, hi);
+        }
+    }
+    return valid;
+}
+
+/**
+ * @brief Prints "name = {a, b, ...}" (just the braces for an empty name) while
+ *        the values are generated, in the format of DataSet<T>::print. At most
+ *        `limit` values are printed; a literal "..." marks any left out, and
+ *        the rest are never generated.
+ */
+void printValues(std::ostream &os, const std::string &name, Generator<int> values,
+                 uint64_t limit = std::numeric_limits<uint64_t>::max())
+{
+    if (!name.empty())
+    {
+        os << name << " = ";
+    }
+    os << "{";
+    uint64_t printed = 0;
+    for (int val : values)
+    {
+        if (printed != 0)
+        {
+            os << ", ";
+        }
+        if (printed == limit)
+        {
+            os << "...";
+            break;
+        }
+        os << val;
+        ++printed;
+    }
+    os << "}";
+}
+
+/**
+ * @brief Prints "{(a, b), ...}" followed by a newline while the pairs are
+ *        generated, stopping with "..." after `limit` pairs.
+ */
+void printPairs(std::ostream &os, Generator<std::pair<int, int>> pairs,
+                uint64_t limit = std::numeric_limits<uint64_t>::max())
+{
+    os << "{";
+    uint64_t printed = 0;
+    for (const std::pair<int, int> &pair : pairs)
+    {
+        if (printed != 0)
+            os << ", ";
+        if (printed == limit)
+        {
+            os << "...";
+            break;
+        }
+        os << "(" << pair.first << ", " << pair.second << ")";
+        ++printed;
+    }
+    os << "}" << std::endl;
+}
+
+/**
+ * @brief Prints the catalog fields of a statistics block:
+ *        "count=n, min=a, max=b, distinct~=d, hash=h" (no range for an empty set).
+ */
+void printStatistics(std::ostream &os, const SetStatistics<int> &statistics)
+{
+    os << "count=" << statistics.count();
+    if (statistics.hasRange())
+    {
+        os << ", min=" << statistics.minimum() << ", max=" << statistics.maximum();
+    }
+    char hash[17];
+    std::snprintf(hash, sizeof(hash), "%016llx",
+                  static_cast<unsigned long long>(statistics.contentHash()));
+    os << ", distinct~=" << static_cast<uint64_t>(statistics.distinctEstimate() + 0.5)
+       << ", hash=" << hash;
+}
+
+/**
+ * @brief Fills a set from its line of elements (integers and range literals).
+ *        Plain lists are sorted and deduplicated in one batch on `scheduler`.
+ *        Reports invalid tokens to `err`.
+ */
+void fillSet(DataSet<int> &set, const std::string &line, std::ostream &err,
+             TaskScheduler &scheduler)
+{
+    if (line.find("..") != std::string::npos)
+    {
+        // Range literals: keep every range as a single run
+        std::vector<int> values;
+        std::vector<std::pair<int, int>> ranges;
+        if (!parseValueList(line, values, ranges))
+        {
+            err << "Error: Invalid element or range in set '" << set.getName()
+                << "' (skipped)" << std::endl;
+        }
+        set.useRepresentation(SetRepresentation::INTERVAL);
+        for (const std::pair<int, int> &range : ranges)
+        {
+            set.insertRange(range.first, range.second);
+        }
+        for (int val : values)
+        {
+            set.insert(val);
+        }
+    }
+    else
+    {
+        set.insertMany(parseIntList(line), &scheduler); // Ensures uniqueness
+    }
+}
+
+/**
+ * @brief Returns the target of a "filter ... as <Name>" or "map ... as <Name>"
+ *        query, or an empty view for any other line.
+ */
+std::string_view storeTarget(std::string_view line)
+{
+    std::string_view rest = line;
+    std::string_view op = nextToken(rest);
+    if (op != "filter" && op != "map")
+    {
+        return std::string_view();
+    }
+    std::string_view previous, last;
+    for (std::string_view token = nextToken(rest); !token.empty(); token = nextToken(rest))
+    {
+        previous = last;
+        last = token;
+    }
+    return previous == "as" ? last : std::string_view();
+}
+
+/**
+ * @brief True for the queries that add sets to the collection: partition, and
+ *        filter or map with a storage target.
+ */
+bool storesSets(std::string_view line)
+{
+    std::string_view rest = line;
+    return nextToken(rest) == "partition" || !storeTarget(line).empty();
+}
+
+/**
+ * @brief Builds the result of "filter <A> [mod <m>] <op> <value>" or
+ *        "map <A> +k|-k|*k" from the tokens after the set name, which may end
+ *        in "as <Name>". `label` receives the query in normalized form, such as
+ *        "(filter A > 10)" or "(map A *2)".
+ * @throws std::runtime_error if the predicate or transform is malformed, or as
+ *         DataSet<T>::where, whereModulo and mapAffine do.
+ */
+DataSet<int> deriveSet(std::string_view op, std::string_view nameA, const DataSet<int> &A,
+                       std::string_view rest, std::string &label)
+{
+    // Only "as <Name>" may follow the predicate or transform
+    auto requireEnd = [&rest, &label]()
+    {
+        std::string_view extra = nextToken(rest);
+        std::string_view target = nextToken(rest);
+        if (!extra.empty() && (extra != "as" || target.empty() || !nextToken(rest).empty()))
+        {
+            throw std::runtime_error("Unexpected '" + std::string(extra) + "' after " + label + ".");
+        }
+    };
+    DataSet<int> result("");
+    if (op == "filter")
+    {
+        std::string_view first = nextToken(rest);
+        bool modulo = first == "mod";
+        std::string_view modulusText = modulo ? nextToken(rest) : std::string_view();
+        std::string_view symbol = modulo ? nextToken(rest) : first;
+        Comparison comparison;
+        int modulus = 0, value = 0;
+        if (!parseComparison(symbol, comparison) || !parseInt(nextToken(rest), value) ||
+            (modulo && !parseInt(modulusText, modulus)))
+        {
+            throw std::runtime_error("Expected 'filter <SetName> [mod <m>] <op> <value>'.");
+        }
+        label = "(filter " + std::string(nameA) +
+                (modulo ? " mod " + std::to_string(modulus) : std::string()) + " " +
+                comparisonSymbol(comparison) + " " + std::to_string(value) + ")";
+        requireEnd();
+        result = modulo ? A.whereModulo(modulus, comparison, value) : A.where(comparison, value);
+    }
+    else
+    {
+        // "+5" or "+ 5"; "-k" adds -k, so the int range limits k, not -k
+        std::string_view transform = nextToken(rest);
+        char symbol = transform.empty() ? '\0' : transform[0];
+        std::string_view amount = transform.size() > 1 ? transform.substr(1) : nextToken(rest);
+        int k = 0;
+        if ((symbol != '+' && symbol != '-' && symbol != '*') || !parseInt(amount, k) ||
+            (symbol == '-' && k == std::numeric_limits<int>::min()))
+        {
+            throw std::runtime_error("Expected 'map <SetName> +k|-k|*k'.");
+        }
+        label = "(map " + std::string(nameA) + " " + symbol + std::to_string(k) + ")";
+        requireEnd();
+        result = symbol == '*' ? A.mapAffine(k, 0) : A.mapAffine(1, symbol == '-' ? -k : k);
+    }
+    return result;
+}
+
+/**
+ * @brief Splits a set as "partition <A> by mod <K>" or "partition <A> by ranges
+ *        <lo..hi> ..." asks, from the tokens after the set name, which may end
+ *        in "as <Prefix>". Bucket i is named "<Prefix>_i" (the prefix defaults
+ *        to the set name); `label` receives the partition in normalized form.
+ * @throws std::runtime_error if the query is malformed, or as
+ *         DataSet<T>::partitionByModulo and partitionByRanges do.
+ */
+std::vector<DataSet<int>> partitionSet(std::string_view nameA, const DataSet<int> &A,
+                                       std::string_view rest, TaskScheduler &scheduler,
+                                       std::string &label)
+{
+    std::string_view by = nextToken(rest);
+    std::string_view kind = nextToken(rest);
+    std::string_view prefix = nameA;
+    std::vector<std::string_view> arguments;
+    for (std::string_view token = nextToken(rest); !token.empty(); token = nextToken(rest))
+    {
+        if (token == "as")
+        {
+            prefix = nextToken(rest);
+            if (prefix.empty() || !nextToken(rest).empty())
+            {
+                throw std::runtime_error("Expected 'as <Prefix>' at the end.");
+            }
+            break;
+        }
+        arguments.push_back(token);
+    }
+
+    std::vector<DataSet<int>> parts;
+    int modulus = 0;
+    std::vector<std::pair<int, int>> ranges(arguments.size());
+    bool rangesValid = !arguments.empty();
+    for (size_t i = 0; i < arguments.size() && rangesValid; ++i)
+    {
+        rangesValid = parseRange(arguments[i], ranges[i].first, ranges[i].second);
+    }
+    if (by == "by" && kind == "mod" && arguments.size() == 1 && parseInt(arguments[0], modulus))
+    {
+        label = std::string(nameA) + " by mod " + std::to_string(modulus);
+        parts = A.partitionByModulo(modulus, &scheduler);
+    }
+    else if (by == "by" && kind == "ranges" && rangesValid)
+    {
+        label = std::string(nameA) + " by ranges";
+        for (const std::pair<int, int> &range : ranges)
+        {
+            label += " " + std::to_string(range.first) + ".." + std::to_string(range.second);
+        }
+        parts = A.partitionByRanges(ranges, &scheduler);
+    }
+    else
+    {
+        throw std::runtime_error("Expected 'partition <SetName> by mod <K>' or "
+                                 "'partition <SetName> by ranges <lo..hi> ...'.");
+    }
+    for (size_t i = 0; i < parts.size(); ++i)
+    {
+        parts[i].setName(std::string(prefix) + "_" + std::to_string(i));
+    }
+    return parts;
+}
+
+/**
+ * @brief Predicts the output and work of one query line from the sizes of the
+ *        sets it names. Queries that name a missing set, or an unknown
+ *        operation, cost nothing: they only print an error.
+ */
+QueryCost estimateQuery(std::string_view line, const DataSetCollection<int> &collection)
+{
+    std::string_view rest = line;
+    std::string_view op = nextToken(rest);
+    std::string_view nameA = nextToken(rest);
+    std::string_view nameB = nextToken(rest);
+    if (op == "print" && nameA == "sorted" && !nameB.empty())
+    {
+        nameA = nameB; // print sorted <A>
+    }
+    if (!collection.hasSet(nameA))
+    {
+        return estimateScan(0, 0);
+    }
+    // Sizes come from the statistics catalog, so spilled sets stay on disk
+    SetStatistics<int> statsA = collection.getStatistics(nameA);
+    SetStatistics<int> statsB = collection.hasSet(nameB) ? collection.getStatistics(nameB)
+                                                         : SetStatistics<int>();
+    size_t sizeA = statsA.count();
+    size_t sizeB = statsB.count();
+    if (op == "print")
+    {
+        return estimateScan(sizeA, sizeA);
+    }
+    else if (op == "powerset")
+    {
+        return estimatePowerSet(sizeA);
+    }
+    else if (op == "cartesian")
+    {
+        return estimateCartesianProduct(sizeA, sizeB);
+    }
+    else if (op == "filter" || op == "map")
+    {
+        // A stored result prints a single line
+        return estimateScan(storeTarget(line).empty() ? sizeA : 1, sizeA);
+    }
+    else if (op == "partition")
+    {
+        return estimateScan(1, sizeA);
+    }
+    else if (op == "issubset" || op == "isequal" || op == "sum" || op == "min" ||
+             op == "max" || op == "mean" || op == "quantile")
+    {
+        return estimateScan(1, sizeA);
+    }
+    else if (op == "contains")
+    {
+        // Every remaining token after the set name is a key
+        size_t keys = nameB.empty() ? 0 : 1;
+        while (!nextToken(rest).empty())
+        {
+            ++keys;
+        }
+        return estimateScan(keys, keys);
+    }
+    return estimateSetOperation(op, sizeA, sizeB,
+                                SetStatistics<int>::estimateOverlap(statsA, statsB));
+}
+
+/**
+ * @brief Lazy result of a binary set operation ("union", "intersection",
+ *        "difference", otherwise the symmetric difference). With `sorted`, both
+ *        operands are read in ascending order (see ascending()) and merged, so
+ *        the result streams in ascending order whatever their layouts.
+ */
+Generator<int> lazyOperation(std::string_view op, const DataSet<int> &A, const DataSet<int> &B,
+                             bool sorted, TaskScheduler &scheduler)
+{
+    if (sorted)
+    {
+        Generator<int> a = ascending(A, &scheduler);
+        Generator<int> b = ascending(B, &scheduler);
+        return op == "union"          ? lazyUnion(std::move(a), std::move(b))
+               : op == "intersection" ? lazyIntersection(std::move(a), std::move(b))
+               : op == "difference"   ? lazyDifference(std::move(a), std::move(b))
+                                      : lazySymmetricDifference(std::move(a), std::move(b));
+    }
+    return op == "union"          ? lazyUnion(A, B)
+           : op == "intersection" ? lazyIntersection(A, B)
+           : op == "difference"   ? lazyDifference(A, B)
+                                  : lazySymmetricDifference(A, B);
+}
+
+/**
+ * @brief Executes a query that adds sets to the collection (see storesSets):
+ *        "filter ... as <Name>" and "map ... as <Name>" store their result
+ *        under <Name>, "partition" registers all its buckets in one addSets()
+ *        call; sets of the same name are replaced. Only the new sets' sizes
+ *        are printed. Writes the collection, so no other query may run at the
+ *        same time.
+ */
+void storeQuery(const std::string &line, DataSetCollection<int> &collection,
+                const AdmissionControl &limits, TaskScheduler &scheduler, std::ostream &out,
+                std::ostream &err)
+{
+    std::string_view rest = line;
+    std::string_view op = nextToken(rest);
+    std::string_view nameA = nextToken(rest);
+
+    // Stored results are never truncated: they print one line, so they are admitted in full or not at all
+    AdmissionControl::Decision decision = limits.admit(
+        limits.isUnlimited() ? estimateScan(0, 0) : estimateQuery(line, collection));
+    if (!decision.admitted)
+    {
+        err << "Error: " << line << ": " << decision.diagnostic << std::endl;
+        return;
+    }
+    if (!decision.diagnostic.empty())
+    {
+        err << "Warning: " << line << ": " << decision.diagnostic << std::endl;
+    }
+    try
+    {
+        std::string label;
+        std::vector<DataSet<int>> results;
+        {
+            std::shared_ptr<const DataSet<int>> A = collection.shareSet(nameA);
+            if (op == "partition")
+            {
+                results = partitionSet(nameA, *A, rest, scheduler, label);
+            }
+            else
+            {
+                results.push_back(deriveSet(op, nameA, *A, rest, label));
+                results.back().setName(std::string(storeTarget(line)));
+            }
+        } // Unpinned before the store, so that the memory budget may spill A
+
+        std::ostringstream summary;
+        for (size_t i = 0; i < results.size(); ++i)
+        {
+            summary << (i == 0 ? "" : ", ") << results[i].getName() << " (" << results[i].size()
+                    << " element(s))";
+        }
+        collection.addSets(std::move(results));
+        if (op == "partition")
+        {
+            out << "Partition of " << label << ": " << summary.str() << std::endl;
+        }
+        else
+        {
+            out << "Stored " << label << " as " << summary.str() << std::endl;
+        }
+    }
+    catch (const std::exception &ex)
+    {
+        err << "Error during " << op << ": " << ex.what() << std::endl;
+    }
+}
+
+/**
+ * @brief Executes one query line against the collection. Results go to `out`
+ *        and error messages to `err`; queries only read the collection, so
+ *        several may run at the same time. With limits set, the query is
+ *        estimated first and rejected or truncated as `limits` decides.
+ *        With sortedOutput, sets and set operation results print in ascending
+ *        order; unordered sets are sorted on `scheduler` while they stream.
+ */
+void executeQuery(const std::string &line, const DataSetCollection<int> &collection,
+                  const AdmissionControl &limits, bool sortedOutput, TaskScheduler &scheduler,
+                  std::ostream &out, std::ostream &err)
+{
+    std::string_view rest = line;
+    std::string_view op = nextToken(rest);
+    std::string_view nameA, nameB; // Views into `line`: names are never copied
+
+    AdmissionControl::Decision decision = limits.admit(
+        limits.isUnlimited() ? estimateScan(0, 0) : estimateQuery(line, collection));
+    if (!decision.admitted)
+    {
+        err << "Error: " << line << ": " << decision.diagnostic << std::endl;
+        return;
+    }
+    if (!decision.diagnostic.empty())
+    {
+        err << "Warning: " << line << ": " << decision.diagnostic << std::endl;
+    }
+    const uint64_t itemLimit = decision.itemLimit;
+
+    if (op == "print")
+    {
+        // Single-set operation: print the contents, "print sorted A" in ascending order
+        nameA = nextToken(rest);
+        bool sorted = sortedOutput;
+        if (nameA == "sorted" && !rest.empty())
+        {
+            nameA = nextToken(rest);
+            sorted = true;
+        }
+        if (collection.hasSet(nameA) && sorted)
+        {
+            // Ordered layouts stream in place; others are sorted, never printed twice
+            std::shared_ptr<const DataSet<int>> A = collection.shareSet(nameA);
+            printValues(out, A->getName(), ascending(*A, &scheduler), itemLimit);
+            out << std::endl;
+        }
+        else if (collection.hasSet(nameA) && itemLimit != std::numeric_limits<uint64_t>::max())
+        {
+            std::shared_ptr<const DataSet<int>> A = collection.shareSet(nameA);
+            printValues(out, A->getName(), A->values(), itemLimit);
+            out << std::endl;
+        }
+        else if (collection.hasSet(nameA))
+        {
+            collection.printSet(nameA, out);
+        }
+        else
+        {
+            err << "Set '" << nameA << "' not found." << std::endl;
+        }
+    }
+    else if (op == "union" || op == "intersection" ||
+             op == "difference" || op == "symmetric_difference")
+    {
+        // Binary operation: requires two set names
+        nameA = nextToken(rest);
+        nameB = nextToken(rest);
+        try
+        {
+            // Stream the result: elements are printed as they are produced
+            std::shared_ptr<const DataSet<int>> A = collection.shareSet(nameA); // Pinned in memory
+            std::shared_ptr<const DataSet<int>> B = collection.shareSet(nameB);
+            Generator<int> result = lazyOperation(op, *A, *B, sortedOutput, scheduler);
+            printValues(out, "(" + std::string(nameA) + " " + std::string(op) + " " +
+                                 std::string(nameB) + ")",
+                        std::move(result), itemLimit);
+            out << std::endl;
+        }
+        catch (const std::exception &ex)
+        {
+            err << "Error: " << ex.what() << std::endl;
+        }
+    }
+    else if (op == "issubset")
+    {
+        nameA = nextToken(rest);
+        nameB = nextToken(rest);
+        try
+        {
+            std::shared_ptr<const DataSet<int>> A = collection.shareSet(nameA);
+            std::shared_ptr<const DataSet<int>> B = collection.shareSet(nameB);
+            bool result = A->isSubsetOf(*B);
+            out << "Is " << nameA << " ⊆ " << nameB << "? "
+                      << (result ? "Yes ✅" : "No ❌") << std::endl;
+        }
+        catch (const std::exception &ex)
+        {
+            err << "Error during issubset: " << ex.what() << std::endl;
+        }
+    }
+
+    else if (op == "contains")
+    {
+        // Batched membership test: contains <SetName> <x1> ... <xn>
+        nameA = nextToken(rest);
+        try
+        {
+            std::vector<int> keys;
+            for (std::string_view token = nextToken(rest); !token.empty(); token = nextToken(rest))
+            {
+                int key = 0;
+                if (!parseInt(token, key))
+                {
+                    throw std::runtime_error("Expected an integer key, got '" + std::string(token) + "'.");
+                }
+                keys.push_back(key);
+            }
+            if (keys.size() > itemLimit)
+            {
+                keys.resize(itemLimit); // Truncated: only the first keys are answered
+            }
+            std::vector<bool> found;
+            collection.containsMany(nameA, keys, found);
+            for (size_t i = 0; i < keys.size(); ++i)
+            {
+                out << "Is " << keys[i] << " ∈ " << nameA << "? "
+                          << (found[i] ? "Yes ✅" : "No ❌") << std::endl;
+            }
+        }
+        catch (const std::exception &ex)
+        {
+            err << "Error during contains: " << ex.what() << std::endl;
+        }
+    }
+
+    else if (op == "stats")
+    {
+        // Representation chosen for a set and the statistics behind it
+        nameA = nextToken(rest);
+        try
+        {
+            DataSet<int>::Stats stats = collection.getStats(nameA);
+            out << "Stats of set " << nameA << ": representation="
+                      << representationName(stats.representation)
+                      << ", size=" << stats.size << ", span=" << stats.span
+                      << ", runs=" << stats.runs << ", inserts=" << stats.mutations
+                      << ", lookups=" << stats.queries
+                      << ", adaptive=" << (stats.adaptive ? "yes" : "no") << ", ";
+            printStatistics(out, stats.statistics);
+            out << std::endl;
+        }
+        catch (const std::exception &ex)
+        {
+            err << "Error during stats: " << ex.what() << std::endl;
+        }
+    }
+
+    else if (op == "catalog")
+    {
+        // Statistics of every set, without reading spilled sets back
+        for (const DataSetCollection<int>::CatalogEntry &entry : collection.getCatalog())
+        {
+            out << "Catalog " << entry.name << ": ";
+            printStatistics(out, entry.statistics);
+            out << std::endl;
+        }
+    }
+
+    else if (op == "memory")
+    {
+        // Memory budget: where the sets are and how often they had to be reloaded
+        DataSetCollection<int>::MemoryStats memory = collection.getMemoryStats();
+        out << "Memory: budget=";
+        if (memory.budget == 0)
+            out << "unlimited";
+        else
+            out << memory.budget;
+        out << ", resident=" << memory.residentBytes << " bytes in " << memory.residentSets
+            << " set(s), spilled=" << memory.spilledSets << " set(s), hits=" << memory.hits
+            << ", misses=" << memory.misses << ", evictions=" << memory.evictions << std::endl;
+    }
+
+    else if (op == "isequal")
+    {
+        nameA = nextToken(rest);
+        nameB = nextToken(rest);
+        try
+        {
+            std::shared_ptr<const DataSet<int>> A = collection.shareSet(nameA);
+            std::shared_ptr<const DataSet<int>> B = collection.shareSet(nameB);
+            bool result = A->isEqualTo(*B);
+            out << "Are " << nameA << " and " << nameB << " equal? "
+                      << (result ? "Yes ✅" : "No ❌") << std::endl;
+        }
+        catch (const std::exception &ex)
+        {
+            err << "Error during isequal: " << ex.what() << std::endl;
+        }
+    }
+    else if (op == "size")
+    {
+        nameA = nextToken(rest);
+        try
+        {
+            std::shared_ptr<const DataSet<int>> A = collection.shareSet(nameA);
+            out << "Size of set " << nameA << ": " << A->size() << " element(s)" << std::endl;
+        }
+        catch (const std::exception &ex)
+        {
+            err << "Error during size: " << ex.what() << std::endl;
+        }
+    }
+    else if (op == "sum" || op == "min" || op == "max" || op == "mean" || op == "quantile")
+    {
+        // Aggregates: sum|min|max|mean <SetName>, quantile <SetName> <q>
+        nameA = nextToken(rest);
+        try
+        {
+            // Each value is computed before anything is written, so errors leave no partial line
+            std::shared_ptr<const DataSet<int>> A = collection.shareSet(nameA);
+            if (op == "sum")
+            {
+                int64_t total = A->sum();
+                out << "Sum of " << nameA << ": " << total << std::endl;
+            }
+            else if (op == "min")
+            {
+                int lowest = A->minimum();
+                out << "Min of " << nameA << ": " << lowest << std::endl;
+            }
+            else if (op == "max")
+            {
+                int highest = A->maximum();
+                out << "Max of " << nameA << ": " << highest << std::endl;
+            }
+            else if (op == "mean")
+            {
+                char average[64]; // An int mean: at most 10 integral digits
+                std::snprintf(average, sizeof(average), "%.*f", MEAN_DECIMALS, A->mean());
+                out << "Mean of " << nameA << ": " << average << std::endl;
+            }
+            else
+            {
+                std::string_view text = nextToken(rest);
+                double q = 0;
+                std::from_chars_result parsed = std::from_chars(text.data(), text.data() + text.size(), q);
+                if (text.empty() || parsed.ec != std::errc() || parsed.ptr != text.data() + text.size())
+                {
+                    throw std::runtime_error("Expected 'quantile <SetName> <q>' with q in [0, 1].");
+                }
+                int value = A->quantile(q);
+                out << "Quantile " << text << " of " << nameA << ": " << value << std::endl;
+            }
+        }
+        catch (const std::exception &ex)
+        {
+            err << "Error during " << op << ": " << ex.what() << std::endl;
+        }
+    }
+    else if (op == "filter" || op == "map")
+    {
+        // filter <SetName> [mod <m>] <op> <value>, map <SetName> +k|-k|*k
+        // (main runs the forms ending in "as <Name>" through storeQuery)
+        nameA = nextToken(rest);
+        try
+        {
+            std::shared_ptr<const DataSet<int>> A = collection.shareSet(nameA);
+            std::string label;
+            DataSet<int> result = deriveSet(op, nameA, *A, rest, label);
+            printValues(out, label, sortedOutput ? ascending(result, &scheduler) : result.values(),
+                        itemLimit);
+            out << std::endl;
+        }
+        catch (const std::exception &ex)
+        {
+            err << "Error during " << op << ": " << ex.what() << std::endl;
+        }
+    }
+    else if (op == "powerset")
+    {
+        // Unary operation: powerset <SetName>
+        nameA = nextToken(rest);
+        try
+        {
+            // Compact subsets are enumerated one at a time; none is materialized
+            PowerSet<int> power = collection.shareSet(nameA)->powerSet();
+            out << "Power set of " << nameA << " contains " << power.size() << " subsets:\n";
+            uint64_t printed = 0;
+            for (const CompactSubset<int> &subset : power.subsets())
+            {
+                if (printed++ == itemLimit)
+                {
+                    out << "..." << std::endl; // Truncated: the rest are never enumerated
+                    break;
+                }
+                printValues(out, "", subset.values());
+                out << std::endl;
+            }
+        }
+        catch (const std::exception &ex)
+        {
+            err << "Error during powerset: " << ex.what() << std::endl;
+        }
+    }
+
+    else if (op == "cartesian")
+    {
+        // Binary operation: cartesian <SetA> <SetB> [where first|second <op> <value>]
+        nameA = nextToken(rest);
+        nameB = nextToken(rest);
+        try
+        {
+            std::shared_ptr<const DataSet<int>> A = collection.shareSet(nameA);
+            std::shared_ptr<const DataSet<int>> B = collection.shareSet(nameB);
+            if (nextToken(rest) == "where")
+            {
+                std::string_view component = nextToken(rest);
+                std::string_view symbol = nextToken(rest);
+                std::string_view text = nextToken(rest);
+                Comparison comparison;
+                int value = 0;
+                if ((component != "first" && component != "second") ||
+                    !parseComparison(symbol, comparison) || !parseInt(text, value))
+                {
+                    throw std::runtime_error("Expected 'where first|second <op> <value>'.");
+                }
+                // The predicate reads one component: filter that operand, then
+                // stream the smaller product; no pair is built only to be dropped
+                bool onFirst = component == "first";
+                DataSet<int> kept = (onFirst ? *A : *B).where(comparison, value);
+                const DataSet<int> &left = onFirst ? kept : *A;
+                const DataSet<int> &right = onFirst ? *B : kept;
+                out << "Cartesian product " << nameA << " × " << nameB << " where " << component
+                    << " " << comparisonSymbol(comparison) << " " << value
+                    << " (" << left.size() * right.size() << " pairs):\n";
+                printPairs(out, left.pairsWith(right), itemLimit);
+                return;
+            }
+            out << "Cartesian product " << nameA << " × " << nameB
+                << " (" << A->size() * B->size() << " pairs):\n";
+
+            // Pairs are printed as they are enumerated; the product is never built
+            printPairs(out, A->pairsWith(*B), itemLimit);
+        }
+        catch (const std::exception &ex)
+        {
+            err << "Error during cartesian product: " << ex.what() << std::endl;
+        }
+    }
+    else
+    {
+        // Unknown or unsupported operation
+        err << "Unknown operation: " << op << std::endl;
+    }
+}
+
 int main(int argc, char *argv[])
 {
-    // Check correct number of command-line arguments
-    if (argc != 2)
+    // Parse command-line options and the input file name
+    bool adaptive = false;
+    bool freezeSets = false;
+    bool sortedOutput = false;
+    size_t threads = 1;
+    std::string cacheDirectory;
+    size_t memoryBudget = 0;
+    uint64_t maxOutput = std::numeric_limits<uint64_t>::max();
+    uint64_t maxWork = std::numeric_limits<uint64_t>::max();
+    LimitAction onLimit = LimitAction::REJECT;
+    std::string inputPath;
+    bool validArgs = true;
+    for (int i = 1; i < argc && validArgs; ++i)
     {
-        std::cerr << "Usage: " << argv[0] << " input_file.in" << std::endl;
+        std::string arg = argv[i];
+        if (arg == "--adaptive")
+        {
+            adaptive = true;
+        }
+        else if (arg == "--freeze")
+        {
+            freezeSets = true;
+        }
+        else if (arg == "--sorted-output")
+        {
+            sortedOutput = true;
+        }
+        else if (arg == "--threads" && i + 1 < argc)
+        {
+            std::string value = argv[++i];
+            std::from_chars_result parsed =
+                std::from_chars(value.data(), value.data() + value.size(), threads);
+            validArgs = parsed.ec == std::errc() && parsed.ptr == value.data() + value.size();
+        }
+        else if (arg == "--memory-budget" && i + 1 < argc)
+        {
+            std::string value = argv[++i];
+            std::from_chars_result parsed =
+                std::from_chars(value.data(), value.data() + value.size(), memoryBudget);
+            validArgs = parsed.ec == std::errc() && parsed.ptr == value.data() + value.size() &&
+                        memoryBudget > 0;
+        }
+        else if ((arg == "--max-output" || arg == "--max-work") && i + 1 < argc)
+        {
+            std::string value = argv[++i];
+            uint64_t &limit = arg == "--max-output" ? maxOutput : maxWork;
+            std::from_chars_result parsed =
+                std::from_chars(value.data(), value.data() + value.size(), limit);
+            validArgs = parsed.ec == std::errc() && parsed.ptr == value.data() + value.size();
+        }
+        else if (arg == "--on-limit" && i + 1 < argc)
+        {
+            validArgs = parseLimitAction(argv[++i], onLimit);
+        }
+        else if (arg == "--cache" && i + 1 < argc)
+        {
+            cacheDirectory = argv[++i];
+            validArgs = !cacheDirectory.empty();
+        }
+        else if (arg.rfind("--", 0) == 0 || !inputPath.empty())
+        {
+            validArgs = false;
+        }
+        else
+        {
+            inputPath = arg;
+        }
+    }
+    if (!validArgs || inputPath.empty())
+    {
+        std::cerr << "Usage: " << argv[0] << " [--adaptive] [--freeze] [--threads N] [--cache DIR]"
+                  << " [--memory-budget BYTES] [--max-output N] [--max-work N]"
+                  << " [--on-limit reject|truncate|stream] [--sorted-output] input_file.in"
+                  << std::endl;
         return 1;
     }
 
     // Attempt to open the input file
-    std::ifstream fin(argv[1]);
+    std::ifstream fin(inputPath);
     if (!fin.is_open())
     {
-        std::cerr << "Error: Cannot open file '" << argv[1] << "'" << std::endl;
+        std::cerr << "Error: Cannot open file '" << inputPath << "'" << std::endl;
         return 1;
     }
 
+    // One pool for every parallel path; nested regions share its threads
+    TaskScheduler scheduler(threads == 0 ? TaskScheduler::hardwareThreads() : threads);
+
     DataSetCollection<int> collection; // Main structure holding all named sets
+    collection.setAdaptive(adaptive);
+    collection.setScheduler(&scheduler);
+    AdmissionControl limits(maxOutput, maxWork, onLimit);
+    collection.setAdmissionControl(limits);
+    if (memoryBudget > 0)
+    {
+        std::filesystem::path spillPath = std::filesystem::temp_directory_path() /
+                                          ("sets-" + std::to_string(std::random_device()()) + ".spill");
+        try
+        {
+            collection.setMemoryBudget(memoryBudget, spillPath.string());
+        }
+        catch (const std::exception &ex)
+        {
+            std::cerr << "Error: " << ex.what() << std::endl;
+            return 1;
+        }
+    }
     std::string line;
 
     // ============================
@@ -86,6 +1140,9 @@ int main(int argc, char *argv[])
     // Each set starts with a line: <name> <count>
     // Followed by a line of space-separated integers (the set elements)
     // Reading stops when the line "Q" is found
+    std::vector<DataSet<int>> definitions;
+    std::vector<std::string> elementLines;
+    SnapshotKey definitionsKey(adaptive, freezeSets); // Every definition line feeds the cache key
     while (std::getline(fin, line))
     {
         line = trim(line);
@@ -95,40 +1152,119 @@ int main(int argc, char *argv[])
             continue; // Skip comments
         if (line == "Q")
             break; // End of set definitions
+        definitionsKey.add(line);
 
         std::istringstream iss(line);
         std::string setName;
         int count;
 
-        // Parse set name and number oA 5f expected elements
+        // Parse set name and number of expected elements
         iss >> setName >> count;
 
         // Create empty set with that name
-        DataSet<int> set(setName);
+        definitions.emplace_back(setName);
+        definitions.back().setAdaptive(adaptive);
 
         // Read elements in the next line
+        elementLines.emplace_back();
         if (count > 0 && std::getline(fin, line))
         {
-            std::vector<int> values = parseIntList(line);
-            for (int val : values)
+            elementLines.back() = line;
+        }
+        definitionsKey.add(elementLines.back());
+    }
+
+    // A cached snapshot of the same definitions replaces parsing altogether
+    SnapshotCache<int> cache(cacheDirectory);
+    std::string buildMessages;
+    bool cached = !cacheDirectory.empty() && cache.load(definitionsKey, collection, buildMessages);
+    if (cached)
+    {
+        std::cerr << buildMessages; // Replay what the original parse reported
+    }
+    else
+    {
+        // Build the sets in parallel; errors are reported in input order afterwards
+        std::vector<std::string> buildErrors(definitions.size());
+        scheduler.parallelFor(0, definitions.size(), 1, [&](size_t lo, size_t hi)
+                              {
+            for (size_t i = lo; i < hi; ++i)
             {
-                set.insert(val); // Ensures uniqueness
-            }
+                std::ostringstream err;
+                fillSet(definitions[i], elementLines[i], err, scheduler);
+                buildErrors[i] = err.str();
+            } });
+        for (size_t i = 0; i < definitions.size(); ++i)
+        {
+            std::cerr << buildErrors[i];
+            buildMessages += buildErrors[i];
+            collection.addSet(definitions[i]); // Overwrites if already exists
         }
+    }
+    definitions.clear();
+    elementLines.clear();
 
-        // Add the set to the collection (overwrites if already exists)
-        collection.addSet(set);
+    // Sets are read-only from here on: with --freeze, switch large ones to the
+    // frozen layout (adaptive sets re-plan for a read-mostly workload instead).
+    // Snapshots store the final layouts, so for cached sets this changes nothing.
+    if (freezeSets || adaptive)
+    {
+        collection.freezeAll();
+    }
+    if (!cacheDirectory.empty() && !cached)
+    {
+        try
+        {
+            cache.store(definitionsKey, collection, buildMessages);
+        }
+        catch (const std::exception &ex)
+        {
+            std::cerr << "Warning: cannot cache the sets: " << ex.what() << std::endl;
+        }
     }
 
     // ============================
     // Phase 2: Execute operations
     // ============================
     // After line "Q", each line represents an operation:
-    // print <A>
+    // print [sorted] <A>
     // union <A> <B>
     // intersection <A> <B>
     // difference <A> <B>
     // symmetric_difference <A> <B>
+    // contains <A> <x1> <x2> ... <xn>
+    // stats <A>
+    // sum|min|max|mean <A>, quantile <A> <q>
+    // filter <A> [mod <m>] <op> <value> [as <B>], map <A> +k|-k|*k [as <B>]
+    // partition <A> by mod <K> | by ranges <lo..hi> ... [as <Prefix>]
+    std::vector<std::string> queries;
+    uint64_t batchBytes = 0; // Estimated output of the buffered queries
+    const size_t batchQueries = scheduler.threadCount() * BATCH_QUERIES_PER_THREAD;
+
+    // Answers the batch in parallel and prints the buffered results in input order
+    auto answerBatch = [&]()
+    {
+        std::vector<std::string> results(queries.size());
+        std::vector<std::string> errors(queries.size());
+        scheduler.parallelFor(0, queries.size(), 1, [&](size_t lo, size_t hi)
+                              {
+            for (size_t i = lo; i < hi; ++i)
+            {
+                std::ostringstream out;
+                std::ostringstream err;
+                executeQuery(queries[i], collection, limits, sortedOutput, scheduler, out, err);
+                results[i] = out.str();
+                errors[i] = err.str();
+            } });
+        for (size_t i = 0; i < queries.size(); ++i)
+        {
+            std::cout << results[i] << std::flush;
+            std::cerr << errors[i];
+        }
+        queries.clear();
+        batchBytes = 0;
+    };
+
     while (std::getline(fin, line))
     {
         line = trim(line);
@@ -140,134 +1276,47 @@ int main(int argc, char *argv[])
         if (line == "Q")
             break; // End of set definitions
 
-        std::istringstream iss(line);
-        std::string op, nameA, nameB;
-        iss >> op;
-
-        if (op == "print")
+        if (storesSets(line))
         {
-            // Single-set operation: print the contents
-            iss >> nameA;
-            collection.printSet(nameA);
+            // Defines sets later queries may read: finish the batch, then store alone
+            answerBatch();
+            storeQuery(line, collection, limits, scheduler, std::cout, std::cerr);
         }
-        else if (op == "union" || op == "intersection" ||
-                 op == "difference" || op == "symmetric_difference")
+        else if (scheduler.threadCount() == 1)
         {
-            // Binary operation: requires two set names
-            iss >> nameA >> nameB;
-            try
-            {
-                DataSet<int> result = collection.operate(nameA, op, nameB);
-                result.print(std::cout); // Print result
-                std::cout << std::endl;
-            }
-            catch (const std::exception &ex)
-            {
-                std::cerr << "Error: " << ex.what() << std::endl;
-            }
+            executeQuery(line, collection, limits, sortedOutput, scheduler, std::cout, std::cerr); // Stream results directly
         }
-        else if (op == "issubset")
-        {
-            iss >> nameA >> nameB;
-            try
-            {
-                DataSet<int> A = collection.getSet(nameA);
-                DataSet<int> B = collection.getSet(nameB);
-                bool result = A.isSubsetOf(B);
-                std::cout << "Is " << nameA << " ⊆ " << nameB << "? "
-                          << (result ? "Yes ✅" : "No ❌") << std::endl;
-            }
-            catch (const std::exception &ex)
-            {
-                std::cerr << "Error during issubset: " << ex.what() << std::endl;
-            }
-        }
-
-        else if (op == "isequal")
-        {
-            iss >> nameA >> nameB;
-            try
-            {
-                DataSet<int> A = collection.getSet(nameA);
-                DataSet<int> B = collection.getSet(nameB);
-                bool result = A.isEqualTo(B);
-                std::cout << "Are " << nameA << " and " << nameB << " equal? "
-                          << (result ? "Yes ✅" : "No ❌") << std::endl;
-            }
-            catch (const std::exception &ex)
-            {
-                std::cerr << "Error during isequal: " << ex.what() << std::endl;
-            }
-        }
-        else if (op == "size")
-        {
-            iss >> nameA;
-            try
-            {
-                DataSet<int> A = collection.getSet(nameA);
-                std::cout << "Size of set " << nameA << ": " << A.size() << " element(s)" << std::endl;
-            }
-            catch (const std::exception &ex)
-            {
-                std::cerr << "Error during size: " << ex.what() << std::endl;
-            }
-        }
-        else if (op == "powerset")
+        else
         {
-            // Unary operation: powerset <SetName>
-            iss >> nameA;
+            QueryCost cost = estimateScan(0, 0);
             try
             {
-                DataSet<DataSet<int>> result = collection.operateUnarySet(nameA, "powerset");
-
-                std::cout << "Power set of " << nameA << " contains "
-                          << result.size() << " subsets:\n";
-
-                std::vector<DataSet<int>> subsets = result.getElements();
-                for (const auto &subset : subsets)
+                if (!limits.isUnlimited())
                 {
-                    subset.print(std::cout);
-                    std::cout << std::endl;
+                    cost = estimateQuery(line, collection);
                 }
             }
-            catch (const std::exception &ex)
+            catch (const std::exception &)
             {
-                std::cerr << "Error during powerset: " << ex.what() << std::endl;
+                // Unestimable: buffer it, executeQuery reports the error in order
             }
-        }
-
-        else if (op == "cartesian")
-        {
-            // Binary operation: cartesian <SetA> <SetB>
-            iss >> nameA >> nameB;
-            try
+            uint64_t bytes = saturatingMultiply(cost.items, PRINTED_BYTES_PER_ITEM);
+            if (bytes >= STREAM_MIN_BYTES || (!limits.isUnlimited() && limits.admit(cost).streamed))
             {
-                DataSet<std::pair<int, int>> result = collection.cartesianProduct(nameA, nameB);
-
-                std::cout << "Cartesian product " << nameA << " × " << nameB
-                          << " (" << result.size() << " pairs):\n";
-
-                std::vector<std::pair<int, int>> pairs = result.getElements();
-                std::cout << "{";
-                for (size_t i = 0; i < pairs.size(); ++i)
-                {
-                    std::cout << "(" << pairs[i].first << ", " << pairs[i].second << ")";
-                    if (i < pairs.size() - 1)
-                        std::cout << ", ";
-                }
-                std::cout << "}" << std::endl;
+                // Too large to buffer: finish the batch so far, then write it directly
+                answerBatch();
+                executeQuery(line, collection, limits, sortedOutput, scheduler, std::cout, std::cerr);
+                continue;
             }
-            catch (const std::exception &ex)
+            queries.push_back(line);
+            batchBytes = saturatingAdd(batchBytes, bytes);
+            if (queries.size() >= batchQueries || batchBytes >= BATCH_MAX_BYTES)
             {
-                std::cerr << "Error during cartesian product: " << ex.what() << std::endl;
+                answerBatch(); // Bounded batches: output keeps flowing and memory stays flat
             }
         }
-        else
-        {
-            // Unknown or unsupported operation
-            std::cerr << "Unknown operation: " << op << std::endl;
-        }
     }
+    answerBatch();
 
     fin.close();
     return 0;